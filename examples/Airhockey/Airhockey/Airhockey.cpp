@@ -278,11 +278,30 @@ void Airhockey_Scene::viewportDraw(Viewport* ctx) const
     current_state.m1.draw(ctx);
     current_state.m2.draw(ctx);
 
-    for (const GameState& state : preview_states)
+    // Previews are drawn in batches (mallet bodies, mallet centers, pucks) rather than per state
+    if (!preview_states.empty())
     {
-        state.m1.draw(ctx, 50);
-        state.m2.draw(ctx, 50);
-        state.puck.draw(ctx, 50);
+        std::vector<DVec2> mallets, pucks;
+        std::vector<Color> puck_colors;
+        mallets.reserve(preview_states.size() * 2);
+        pucks.reserve(preview_states.size());
+        puck_colors.reserve(preview_states.size());
+
+        for (const GameState& state : preview_states)
+        {
+            mallets.push_back({ state.m1.x, state.m1.y });
+            mallets.push_back({ state.m2.x, state.m2.y });
+            pucks.push_back({ state.puck.x, state.puck.y });
+            puck_colors.push_back(state.puck.color(50));
+        }
+
+        const double mallet_r = preview_states.front().m1.r;
+
+        ctx->setFillStyle(100, 120, 100, 50);
+        ctx->drawCircles(mallets, mallet_r);
+        ctx->setFillStyle(100, 150, 100, 50);
+        ctx->drawCircles(mallets, mallet_r / 2);
+        ctx->drawCircles(pucks, Puck::radius, puck_colors);
     }
 
     for (const GameState& state : scenario_states)
@@ -45,9 +45,14 @@ struct Puck
         }
     }
 
+    Color color(int alpha = 255) const
+    {
+        return Color(hit ? 255 : 100, 120, 100, alpha);
+    }
+
     void draw(Viewport* ctx, int alpha=255) const
     {
-        ctx->setFillStyle(hit ? 255 : 100, 120, 100, alpha);
+        ctx->setFillStyle(color(alpha));
         ctx->fillEllipse(x, y, Puck::radius);
     }
 };
@@ -30,6 +30,9 @@ inline double qualityFromIterLimit(int iter_lim, double zoom_x)
 
 void Mandelbrot_Project::projectPrepare(Layout& layout)
 {
+    // Fields are sized to the render resolution, so navigating recomputes far fewer pixels
+    dynamic_resolution = true;
+
     Mandelbrot_Scene::Config config1;
     create<Mandelbrot_Scene>(config1)->mountTo(layout);
 }
@@ -359,6 +362,11 @@ void Mandelbrot_Data::populate()
     else
         ImGui::DragDouble("Max Iterations", &quality, 1000.0, 1.0, 1000000.0, "%.0f", ImGuiSliderFlags_Logarithmic);
 
+    // Plain float already runs as deep as float can resolve pixels in the iteration plane, so
+    // mixed precision only has zooms to cover (in place of double) once the distance plane is on
+    if (smooth_iter_dist_ratio > std::numeric_limits<double>::epsilon())
+        ImGui::Checkbox("Mixed Precision", &mixed_precision);
+
     ImGui::SeparatorText("Smoothing");
     ImGui::SliderDouble("Iter/Dist Mix", &smooth_iter_dist_ratio, 0.0, 1.0, "%.2f");
 
@@ -728,6 +736,11 @@ void Mandelbrot_Scene::sceneStart()
     // todo: Stop this getting called twice on startup
 
     cardioid_lerper.create(Math::TWO_PI / 5760.0, 0.005);
+
+    // Benchmark unrolled kernel variants up-front (cached per precision) so it doesn't stall a later frame
+    fastestUnroll<float>();
+    fastestUnroll<double>();
+    fastestUnroll<flt128>();
 }
 
 void Mandelbrot_Scene::sceneMounted(Viewport* ctx)
@@ -935,18 +948,22 @@ void Mandelbrot_Scene::viewportProcess(Viewport* ctx, double dt)
 
 
     // Ensure size divisble by 9 for perfect result forwarding from: [9x9] to [3x3] to [1x1]
-    int iw = (static_cast<int>(ceil(ctx->width() / 9))) * 9;
-    int ih = (static_cast<int>(ceil(ctx->height() / 9))) * 9;
+    int sw = (static_cast<int>(ceil(ctx->width() / 9))) * 9;
+    int sh = (static_cast<int>(ceil(ctx->height() / 9))) * 9;
 
-    world_quad = camera->toWorldQuad(0, 0, iw, ih);
+    // Field resolution follows the canvas' dynamic resolution (stretched over the same stage rect)
+    const double res_scale = resolutionScale();
+    render_w = std::max(9, (static_cast<int>(ceil(sw * res_scale / 9))) * 9);
+    render_h = std::max(9, (static_cast<int>(ceil(sh * res_scale / 9))) * 9);
+
+    world_quad = camera->toWorldQuad(0, 0, sw, sh);
 
     // ======== Determine smoothing mode ========
-    //if (smooth_iter_dist_ratio <= std::numeric_limits<double>::epsilon())
-    //    smoothing_type = (int)MandelSmoothing::ITER;
-    //else if (smooth_iter_dist_ratio >= 1.0 - std::numeric_limits<double>::epsilon())
-    //    smoothing_type = (int)MandelSmoothing::DIST;
-    //else
-    //    smoothing_type = (int)MandelSmoothing::MIX;
+    // Depth is always smoothed, the distance plane is only computed once it's visible
+    if (smooth_iter_dist_ratio <= std::numeric_limits<double>::epsilon())
+        smoothing_type = (int)MandelSmoothing::ITER;
+    else
+        smoothing_type = (int)MandelSmoothing::MIX;
 
     if (Changed(smooth_iter_dist_ratio))
         colors_updated = true;
@@ -954,14 +971,17 @@ void Mandelbrot_Scene::viewportProcess(Viewport* ctx, double dt)
     // Does depth field need recalculating?
     bool mandel_changed = first_frame || Changed(
         world_quad,
+        render_w,
+        render_h,
         quality,
-        ///smoothing_type,
+        smoothing_type,
         dynamic_iter_lim,
+        mixed_precision,
         flatten,
         show_period2_bulb,
         cardioid_lerp_amount,
-        x_spline.hash(),
-        y_spline.hash()
+        x_spline,
+        y_spline
     );
 
     // Presented Mandelbrot *actually* changed? Restart on 9x9 bmp (phase 0)
@@ -1005,18 +1025,18 @@ void Mandelbrot_Scene::viewportProcess(Viewport* ctx, double dt)
     // ======== Bitmap / Depth-field dimensions and view rect ========
     {
         //BL::print("COMPUTING FROM CAMERA: %.2f, %.2f", (double)camera->x, (double)camera->y);
-        pending_bmp->setStageRect(0, 0, iw, ih);
+        pending_bmp->setStageRect(0, 0, sw, sh);
 
         auto stagePos = pending_bmp->stagePos();
         auto stageSize = pending_bmp->stageSize();
 
-        bmp_9x9.setBitmapSize(iw / 9, ih / 9);
-        bmp_3x3.setBitmapSize(iw / 3, ih / 3);
-        bmp_1x1.setBitmapSize(iw, ih);
+        bmp_9x9.setBitmapSize(render_w / 9, render_h / 9);
+        bmp_3x3.setBitmapSize(render_w / 3, render_h / 3);
+        bmp_1x1.setBitmapSize(render_w, render_h);
 
-        field_9x9.setDimensions(iw / 9, ih / 9);
-        field_3x3.setDimensions(iw / 3, ih / 3);
-        field_1x1.setDimensions(iw, ih);
+        field_9x9.setDimensions(render_w / 9, render_h / 9);
+        field_3x3.setDimensions(render_w / 3, render_h / 3);
+        field_1x1.setDimensions(render_w, render_h);
     }
 
     finished_compute = false;
@@ -1033,7 +1053,9 @@ void Mandelbrot_Scene::viewportProcess(Viewport* ctx, double dt)
             double MAX_ZOOM_FLOAT;
             double MAX_DOUBLE_ZOOM;
 
-            if (smoothing != MandelSmoothing::DIST)
+            bool dist_plane = (int)smoothing & (int)MandelSmoothing::DIST;
+
+            if (!dist_plane)
             {
                 MAX_ZOOM_FLOAT = 10000;
                 MAX_DOUBLE_ZOOM = 2e12;
@@ -1047,10 +1069,50 @@ void Mandelbrot_Scene::viewportProcess(Viewport* ctx, double dt)
             bool b32 = (cam_zoom < MAX_ZOOM_FLOAT);// && (smoothing != MandelSmoothing::DIST);
             bool b64 = (cam_zoom < MAX_DOUBLE_ZOOM);
 
+            // Mixed precision only takes over from double once plain float is too coarse for the
+            // plane (past MAX_ZOOM_FLOAT), and only while float can still tell neighbouring pixels
+            // apart. Past that, c rounds to the same float for neighbours and every pixel would be
+            // re-run in double anyway. Phase 0 always measures how many pixels needed double, and
+            // later phases skip the float pass when most pixels would be re-run anyway.
+            constexpr double min_float_ulps_per_pixel = 4.0;
+            double pixel_spacing = (world_quad.a - world_quad.b).magnitude() / render_w;
+            double c_max = 1.0;
+            for (const DVec2& p : { world_quad.a, world_quad.b, world_quad.c, world_quad.d })
+                c_max = std::max({ c_max, std::abs(p.x), std::abs(p.y) });
+            double float_spacing = min_float_ulps_per_pixel * c_max * std::numeric_limits<float>::epsilon();
+            double MAX_ZOOM_MIXED = cam_zoom * pixel_spacing / float_spacing;
+            bool mixed = mixed_precision && !b32 && (cam_zoom < MAX_ZOOM_MIXED) &&
+                (computing_phase == 0 || mixed_promoted_ratio < 0.5);
+
+            // Smoothing/flatten are applied when shading, so only precision and unroll are dispatched
+            // Unroll not compiled for this precision/plane? Fall back to X1, which always is
+            auto fallback_f32 = [&](MandelUnroll, bool, bool dist) {
+                return dist ? mandelbrot<float, MandelUnroll::X1, false, true>() : mandelbrot<float, MandelUnroll::X1, false, false>();
+            };
+            auto fallback_f64 = [&](MandelUnroll, bool mixed, bool dist) {
+                if (mixed) return dist ? mandelbrot<double, MandelUnroll::X1, true, true>() : mandelbrot<double, MandelUnroll::X1, true, false>();
+                return dist ? mandelbrot<double, MandelUnroll::X1, false, true>() : mandelbrot<double, MandelUnroll::X1, false, false>();
+            };
+            auto fallback_f128 = [&](MandelUnroll, bool, bool dist) {
+                return dist ? mandelbrot<flt128, MandelUnroll::X1, false, true>() : mandelbrot<flt128, MandelUnroll::X1, false, false>();
+            };
+
+            if (b32)        finished_compute = table_invoke_sparse<MandelKernelFilter, float>(build_table(mandelbrot, [&]), fallback_f32, fastestUnroll<float>(), false, dist_plane);
+            else if (mixed) finished_compute = table_invoke_sparse<MandelKernelFilter, double>(build_table(mandelbrot, [&]), fallback_f64, fastestUnroll<float>(), true, dist_plane);
+            else if (b64)   finished_compute = table_invoke_sparse<MandelKernelFilter, double>(build_table(mandelbrot, [&]), fallback_f64, fastestUnroll<double>(), false, dist_plane);
+            else
+            {
+                // Perturb from a reference orbit at the view centre, reused between frames and viewports
+                Quad<flt128> quad = static_cast<Quad<flt128>>(world_quad);
+                flt128 ref_x = (quad.a.x + quad.c.x) / flt128(2);
+                flt128 ref_y = (quad.a.y + quad.c.y) / flt128(2);
+                double view_size = (world_quad.a - world_quad.c).magnitude();
 
-            if (b32)      finished_compute = table_invoke<float>(build_table(mandelbrot, [&]), smoothing, flatten);
-            else if (b64) finished_compute = table_invoke<double>(build_table(mandelbrot, [&]), smoothing, flatten);
-            else          finished_compute = table_invoke<flt128>(build_table(mandelbrot, [&]), smoothing, flatten);
+                auto* mandel_project = static_cast<Mandelbrot_Project*>(project);
+                ref_orbit = mandel_project->orbit_cache.acquire(ref_x, ref_y, view_size, iter_lim);
+
+                finished_compute = table_invoke_sparse<MandelKernelFilter, flt128>(build_table(mandelbrot, [&]), fallback_f128, fastestUnroll<flt128>(), false, dist_plane);
+            }
 
 
             // Continue progress calculating depth field for "pending"
@@ -1097,16 +1159,26 @@ void Mandelbrot_Scene::viewportProcess(Viewport* ctx, double dt)
         // ======== Result forwarding ========
         if (finished_compute)
         {
+            // With a distance plane, pixels far from the boundary are interpolated instead of computed
+            bool dist_plane = smoothing_type & (int)MandelSmoothing::DIST;
+            double world_px = std::max(
+                (world_quad.a - world_quad.b).magnitude() / render_w,
+                (world_quad.b - world_quad.c).magnitude() / render_h);
+
             switch (computing_phase)
             {
                 case 0:
                     field_3x3.setAllDepth(-1.0);
                     bmp_9x9.forEachPixel([this](int x, int y) { field_3x3(x*3+1, y*3+1) = field_9x9(x, y); });
+                    if (dist_plane)
+                        interpolateFarFromBoundary(field_9x9, bmp_9x9, field_3x3, bmp_3x3, world_px * 9.0);
                     break;
 
                 case 1:
                     field_1x1.setAllDepth(-1.0);
                     bmp_3x3.forEachPixel([this](int x, int y) { field_1x1(x*3+1, y*3+1) = field_3x3(x, y); });
+                    if (dist_plane)
+                        interpolateFarFromBoundary(field_3x3, bmp_3x3, field_1x1, bmp_1x1, world_px * 3.0);
                     break;
 
                 case 2:
@@ -1301,7 +1373,7 @@ void Mandelbrot_Scene::viewportDraw(Viewport* ctx) const
 
         int px = (int)mouse->stage_x;
         int py = (int)mouse->stage_y;
-        if (px >= 0 && py >= 0 && px < active_bmp->width() && py < active_bmp->height())
+        if (px >= 0 && py >= 0 && px < ctx->width() && py < ctx->height())
         {
             IVec2 pos = active_bmp->pixelPosFromWorld(DVec2(mouse->world_x, mouse->world_y));
             EscapeFieldPixel* p = active_field->get(pos.x, pos.y);
@@ -1340,7 +1412,7 @@ void Mandelbrot_Scene::viewportDraw(Viewport* ctx) const
 
     ctx->print().precision(1);
     ctx->print() << "\nfps: " << std::fixed << fps(60);
-    ctx->print() << "\nthreads: " << Thread::idealThreadCount();
+    ctx->print() << "\nthreads: " << Thread::workerCount();
 
 
     ctx->print() << "\n\ncomputing_phase: " << computing_phase;
@@ -3,6 +3,7 @@
 #include "Cardioid/Cardioid.h"
 #include <math.h>
 #include <cmath>
+#include <atomic>
 
 
 SIM_BEG(Mandelbrot)
@@ -10,7 +11,8 @@ SIM_BEG(Mandelbrot)
 using namespace BL;
 
 #include "types.h"
-#include "kernel.h"
+#include "kernel_common.h"
+#include "reference_orbit.h"
 #include "shading.h"
 
 
@@ -120,6 +122,8 @@ struct Mandelbrot_Data : public VarBuffer, public TweenableMandelState
     
     int iter_lim = 0; // Actual iter limit
 
+    bool mixed_precision = true; // Float with per-pixel double fallback (distance plane, past the plain float zoom)
+
     bool colors_updated = false;
 
     ImSpline::Spline x_spline = ImSpline::Spline(100, {
@@ -181,6 +185,7 @@ struct Mandelbrot_Data : public VarBuffer, public TweenableMandelState
         sync(quality);
         sync(smoothing_type);
         sync(iter_lim);
+        sync(mixed_precision);
         sync(x_spline);
         sync(y_spline);
         sync(dynamic_color_cycle_limit);
@@ -363,7 +368,11 @@ struct Mandelbrot_Scene : public Scene<Mandelbrot_Data>
 {
     // --- Custom Launch Config ---
     struct Config {};
-    Mandelbrot_Scene(Config&) {}
+    Mandelbrot_Scene(Config&)
+    {
+        // Fields/bitmaps are per scene, and the shared orbit cache is thread-safe
+        parallel_viewport_process = true;
+    }
     
     int current_row = 0;
     EscapeField field_9x9 = EscapeField(0); // Processed in a single frame
@@ -381,6 +390,7 @@ struct Mandelbrot_Scene : public Scene<Mandelbrot_Data>
     EscapeField* active_field = nullptr;
 
     DQuad world_quad;
+    int render_w = 0, render_h = 0; // 1x1 field size, follows the canvas' resolution scale
 
     Cardioid::CardioidLerper cardioid_lerper;
 
@@ -388,11 +398,22 @@ struct Mandelbrot_Scene : public Scene<Mandelbrot_Data>
 
     // 0 = 9x smaller, 1 = 3x smaller, 2 = full resolution
     int computing_phase = 0;
+    bool phase0_cut_short = false; // Last phase 0 pass ran out of frame budget
+    static constexpr int PHASE0_CUT_SHORT_BUDGET_SCALE = 4; // Budget multiplier for the pass after one was cut short
     bool first_frame = true;
     bool finished_compute = false;
 
     std::chrono::steady_clock::time_point compute_t0;
     Math::MovingAverage::MA timer_ma = Math::MovingAverage::MA(10);
+
+    // Mixed precision, fraction of float pixels re-run in double (measured per phase). Counted
+    // per row, as each row is only ever computed by one task, and summed once the phase completes
+    struct MixedRowCount { int checked = 0, promoted = 0; };
+    std::vector<MixedRowCount> mixed_row_counts;
+    double mixed_promoted_ratio = 0.0;
+
+    // Deep zoom reference orbit (shared with other scenes through Mandelbrot_Project)
+    std::shared_ptr<const ReferenceOrbit> ref_orbit;
     
     /// std::vector< std::vector<DVec2> > boundary_paths;
     /// 
@@ -465,90 +486,15 @@ struct Mandelbrot_Scene : public Scene<Mandelbrot_Data>
     }
 
 
-    //bool Use_Splines
+    // Defined in Mandelbrot_kernels.inl, which only the kernel translation units include
+    // (explicitly instantiated per precision, see the extern declarations below)
     template<
         typename T,
-        MandelSmoothing Smooth_Iter,
-        bool flatten
+        MandelUnroll Unroll,
+        bool Mixed, // Iterate in float, re-running in T only where the float error is too large
+        bool Dist   // Also fill the distance estimate plane
     >
-    bool mandelbrot()
-    {
-        int timeout;
-
-        switch (computing_phase)
-        {
-        case 0: timeout = 0; break;
-        default: timeout = 16; break;
-        }
-
-        bool frame_complete = pending_bmp->forEachWorldPixel<T>(
-            current_row, [&](int x, int y, T wx, T wy)
-        {
-            // Result already calculated in previous phase? (forwarded to active_bmp)
-            EscapeFieldPixel& field_pixel = pending_field->at(x, y);
-            double depth = field_pixel.depth;
-            if (depth >= 0)
-                return;
-
-            double dist;
-
-            /// ------------------------ Compute -------------------------
-            ///-----------------------------------------------------------
-            ///if constexpr (Use_Splines)
-            ///{
-            ///    v = mandelbrot_spline_iter<Smooth_Iter>(wx, wy, iter_lim, x_spline, y_spline);
-            ///
-            ///    // Extreme splines can return infinite
-            ///    if (!std::isfinite(v)) v = iter_lim;
-            ///}
-            ///else // linear
-            {
-                //mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth, dist);
-                // 
-                //mandelbrot_ex<T, MandelSmoothing::ITER>(wx, wy, iter_lim, depth, dist);
-                mandel_kernel<T, MandelSmoothing::ITER>(wx, wy, iter_lim, depth, dist);
-
-                ///if (isnan(depth))
-                ///{
-                ///    //mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth, dist);
-                ///    depth = mandelbrot_iter_ex<T, Smooth_Iter>(wx, wy, iter_lim);
-                ///    mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth, dist);
-                ///
-                ///    dist = 0;
-                ///}
-
-                /*if constexpr (Smooth_Iter == MandelSmoothing::DIST)
-                {
-                    // Distance to edge smoothing
-                    UNUSED(wx);
-                    UNUSED(wy);
-                    //depth = (double)mandelbrot_dist(wx, wy, iter_lim);
-                }
-                else
-                //if constexpr (Smooth_Iter == MandelSmoothing::ITER)
-                {
-                    // If Smooth_Iter *or* all smoothing options are disabled, handle here
-                    //v = mandelbrot_iter<Smooth_Iter>(wx, wy, iter_lim);
-
-                    //depth = mandelbrot_iter_ex<T, Smooth_Iter>(wx, wy, iter_lim);
-                    mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth);
-                }*/
-            }
-
-            
-
-            field_pixel.depth = depth;
-            field_pixel.dist = dist;
- 
-        }, (int)(1.5f*(float)Thread::idealThreadCount()), timeout);
-
-        if (frame_complete)
-        {
-            refreshFieldDepthNormalized();
-        }
-
-        return frame_complete;
-    };
+    bool mandelbrot();
 
     void refreshFieldDepthNormalized()
     {
@@ -665,6 +611,48 @@ struct Mandelbrot_Scene : public Scene<Mandelbrot_Data>
         });
     }
 
+    // Fill next-phase pixels lying between 4 coarse samples that are all far from the boundary
+    // (by distance estimate). Smooth depth is close to linear there, so bilinear interpolation
+    // is indistinguishable from computing them and the compute goes to pixels near the boundary
+    void interpolateFarFromBoundary(
+        EscapeField& coarse, CanvasImage& coarse_bmp,
+        EscapeField& fine, CanvasImage& fine_bmp,
+        double coarse_spacing)
+    {
+        constexpr double far_samples = 8.0; // Min distance to boundary, in coarse samples
+        const double far_dist = far_samples * coarse_spacing;
+
+        fine_bmp.forEachPixel([&](int fx, int fy)
+        {
+            EscapeFieldPixel& field_pixel = fine(fx, fy);
+            if (field_pixel.depth >= 0 || fx < 1 || fy < 1)
+                return;
+
+            // Coarse sample (cx, cy) was forwarded to fine pixel (cx*3+1, cy*3+1)
+            int cx = (fx - 1) / 3;
+            int cy = (fy - 1) / 3;
+            if (cx + 1 >= coarse_bmp.width() || cy + 1 >= coarse_bmp.height())
+                return;
+
+            const EscapeFieldPixel& a = coarse(cx, cy);
+            const EscapeFieldPixel& b = coarse(cx + 1, cy);
+            const EscapeFieldPixel& c = coarse(cx, cy + 1);
+            const EscapeFieldPixel& d = coarse(cx + 1, cy + 1);
+
+            for (const EscapeFieldPixel* p : { &a, &b, &c, &d })
+            {
+                if (p->depth >= INSIDE_MANDELBROT_SET_SKIPPED || p->dist < far_dist)
+                    return;
+            }
+
+            double tx = (double)(fx - 1 - cx * 3) / 3.0;
+            double ty = (double)(fy - 1 - cy * 3) / 3.0;
+
+            field_pixel.depth = Math::lerp(Math::lerp(a.depth, b.depth, tx), Math::lerp(c.depth, d.depth, tx), ty);
+            field_pixel.dist = Math::lerp(Math::lerp(a.dist, b.dist, tx), Math::lerp(c.dist, d.dist, tx), ty);
+        });
+    }
+
     template<
         bool Smooth,
         bool Show_Period2_Bulb
@@ -731,6 +719,35 @@ struct Mandelbrot_Scene : public Scene<Mandelbrot_Data>
     void onEvent(Event e) override;
 };
 
+// Kernel variants given a dispatch table entry (see unroll_supported), mixed precision is float/double only
+struct MandelKernelFilter
+{
+    template<typename T, MandelUnroll U, bool Mixed, bool Dist>
+    static constexpr bool allow =
+        unroll_supported<T, kernel_smoothing(Dist), U> &&
+        (!Mixed || (std::is_same_v<T, double> && unroll_supported<float, kernel_smoothing(Dist), U>));
+};
+
+// Each precision is instantiated in its own translation unit (Mandelbrot_f32.cpp, etc.)
+extern template bool Mandelbrot_Scene::mandelbrot<float,  MandelUnroll::X1, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<float,  MandelUnroll::X2, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<float,  MandelUnroll::X4, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<float,  MandelUnroll::X1, false, true>();
+extern template bool Mandelbrot_Scene::mandelbrot<float,  MandelUnroll::X2, false, true>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X4, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, false, true>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, false, true>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X4, false, true>();
+extern template bool Mandelbrot_Scene::mandelbrot<flt128, MandelUnroll::X1, false, false>();
+extern template bool Mandelbrot_Scene::mandelbrot<flt128, MandelUnroll::X1, false, true>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, true,  false>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, true,  false>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X4, true,  false>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, true,  true>();
+extern template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, true,  true>();
+
 struct Mandelbrot_Project : public BasicProject
 {
     //static std::vector<std::string> categorize() {
@@ -742,6 +759,9 @@ struct Mandelbrot_Project : public BasicProject
         return ProjectInfo({ "Fractal", "Mandelbrot", "Mandelbrot Viewer" });
     }
 
+    // Reference orbits shared by every scene/viewport of the project
+    ReferenceOrbitCache orbit_cache;
+
     void projectPrepare(Layout& layout) override;
 };
 
@@ -0,0 +1,11 @@
+#include "Mandelbrot_kernels.inl"
+
+SIM_BEG(Mandelbrot)
+
+// flt128 kernels, compiled separately from Mandelbrot.cpp
+template bool Mandelbrot_Scene::mandelbrot<flt128, MandelUnroll::X1, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<flt128, MandelUnroll::X1, false, true>();
+
+template MandelUnroll fastestUnroll<flt128>();
+
+SIM_END(Mandelbrot)
@@ -0,0 +1,14 @@
+#include "Mandelbrot_kernels.inl"
+
+SIM_BEG(Mandelbrot)
+
+// float kernels, compiled separately from Mandelbrot.cpp
+template bool Mandelbrot_Scene::mandelbrot<float, MandelUnroll::X1, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<float, MandelUnroll::X2, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<float, MandelUnroll::X4, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<float, MandelUnroll::X1, false, true>();
+template bool Mandelbrot_Scene::mandelbrot<float, MandelUnroll::X2, false, true>();
+
+template MandelUnroll fastestUnroll<float>();
+
+SIM_END(Mandelbrot)
@@ -0,0 +1,15 @@
+#include "Mandelbrot_kernels.inl"
+
+SIM_BEG(Mandelbrot)
+
+// double kernels, compiled separately from Mandelbrot.cpp
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X4, false, false>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, false, true>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, false, true>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X4, false, true>();
+
+template MandelUnroll fastestUnroll<double>();
+
+SIM_END(Mandelbrot)
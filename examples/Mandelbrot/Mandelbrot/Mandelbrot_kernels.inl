@@ -0,0 +1,155 @@
+#pragma once
+
+// Mandelbrot_Scene::mandelbrot() and the kernels it runs. Only included by the translation units
+// instantiating it (Mandelbrot_f32.cpp, etc.), so Mandelbrot.cpp sees declarations only
+
+#include "Mandelbrot.h"
+#include <chrono>
+#include <limits>
+#include <utility>
+
+SIM_BEG(Mandelbrot)
+
+#include "kernel.h"
+
+template<
+    typename T,
+    MandelUnroll Unroll,
+    bool Mixed, // Iterate in float, re-running in T only where the float error is too large
+    bool Dist   // Also fill the distance estimate plane
+>
+bool Mandelbrot_Scene::mandelbrot()
+{
+    int timeout;
+    Thread::Priority priority;
+
+    // Phase 0 is what the user sees while interacting, later phases only refine it.
+    // Both are bounded by the frame budget, but if a phase 0 pass was cut short (and
+    // restarted by further interaction), give the next one a few frames' worth so the view
+    // can't freeze, while a slow pass still can't stall the worker indefinitely
+    switch (computing_phase)
+    {
+    case 0:
+        timeout = frameBudgetRemainingMs() * (phase0_cut_short ? PHASE0_CUT_SHORT_BUDGET_SCALE : 1);
+        priority = Thread::Priority::INTERACTIVE;
+        break;
+    default:
+        timeout = frameBudgetRemainingMs();
+        priority = Thread::Priority::PROGRESSIVE;
+        break;
+    }
+
+    if constexpr (Mixed)
+    {
+        if (current_row == 0 || mixed_row_counts.size() != (size_t)pending_bmp->height())
+            mixed_row_counts.assign(pending_bmp->height(), {});
+    }
+
+    bool frame_complete = pending_bmp->forEachWorldPixel<T>(
+        current_row, [&](int x, int y, T wx, T wy)
+    {
+        // Result already calculated in previous phase? (forwarded to active_bmp)
+        EscapeFieldPixel& field_pixel = pending_field->at(x, y);
+        double depth = field_pixel.depth;
+        if (depth >= 0)
+            return;
+
+        double dist = 0.0;
+
+        /// ------------------------ Compute -------------------------
+        ///-----------------------------------------------------------
+        ///if constexpr (Use_Splines)
+        ///{
+        ///    v = mandelbrot_spline_iter<Smooth_Iter>(wx, wy, iter_lim, x_spline, y_spline);
+        ///
+        ///    // Extreme splines can return infinite
+        ///    if (!std::isfinite(v)) v = iter_lim;
+        ///}
+        ///else // linear
+        {
+            //mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth, dist);
+            // 
+            //mandelbrot_ex<T, MandelSmoothing::ITER>(wx, wy, iter_lim, depth, dist);
+            constexpr MandelSmoothing S = kernel_smoothing(Dist);
+
+            if constexpr (std::is_same_v<T, flt128>)
+            {
+                // Perturbation, only the offset from the reference orbit is iterated (in double)
+                if (interiorCheck(wx, wy))
+                    depth = INSIDE_MANDELBROT_SET_SKIPPED;
+                else
+                    mandel_kernel_perturbed<S>(*ref_orbit, (double)(wx - ref_orbit->cx), (double)(wy - ref_orbit->cy), iter_lim, depth, dist);
+            }
+            else if constexpr (Mixed)
+            {
+                MixedRowCount& row_count = mixed_row_counts[y];
+                row_count.checked++;
+                if (!mandel_kernel<float, S, Unroll, true>((float)wx, (float)wy, iter_lim, depth, dist))
+                {
+                    row_count.promoted++;
+                    mandel_kernel<T, S, Unroll>(wx, wy, iter_lim, depth, dist);
+                }
+            }
+            else
+            {
+                mandel_kernel<T, S, Unroll>(wx, wy, iter_lim, depth, dist);
+            }
+
+            ///if (isnan(depth))
+            ///{
+            ///    //mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth, dist);
+            ///    depth = mandelbrot_iter_ex<T, Smooth_Iter>(wx, wy, iter_lim);
+            ///    mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth, dist);
+            ///
+            ///    dist = 0;
+            ///}
+
+            /*if constexpr (Smooth_Iter == MandelSmoothing::DIST)
+            {
+                // Distance to edge smoothing
+                UNUSED(wx);
+                UNUSED(wy);
+                //depth = (double)mandelbrot_dist(wx, wy, iter_lim);
+            }
+            else
+            //if constexpr (Smooth_Iter == MandelSmoothing::ITER)
+            {
+                // If Smooth_Iter *or* all smoothing options are disabled, handle here
+                //v = mandelbrot_iter<Smooth_Iter>(wx, wy, iter_lim);
+
+                //depth = mandelbrot_iter_ex<T, Smooth_Iter>(wx, wy, iter_lim);
+                mandelbrot_ex<T, Smooth_Iter>(wx, wy, iter_lim, depth);
+            }*/
+        }
+
+        
+
+        field_pixel.depth = depth;
+        field_pixel.dist = dist;
+ 
+    }, Thread::workerCount(), timeout, nullptr, priority);
+
+    if (computing_phase == 0)
+        phase0_cut_short = !frame_complete;
+
+    if (frame_complete)
+    {
+        if constexpr (Mixed)
+        {
+            int checked = 0, promoted = 0;
+            for (const MixedRowCount& row_count : mixed_row_counts)
+            {
+                checked += row_count.checked;
+                promoted += row_count.promoted;
+            }
+            if (checked > 0)
+                mixed_promoted_ratio = (double)promoted / (double)checked;
+        }
+
+        refreshFieldDepthNormalized();
+    }
+
+    return frame_complete;
+}
+
+SIM_END(Mandelbrot)
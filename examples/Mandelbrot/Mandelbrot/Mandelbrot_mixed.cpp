@@ -0,0 +1,12 @@
+#include "Mandelbrot_kernels.inl"
+
+SIM_BEG(Mandelbrot)
+
+// Mixed float/double kernels, compiled separately from Mandelbrot.cpp
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, true, false>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, true, false>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X4, true, false>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X1, true, true>();
+template bool Mandelbrot_Scene::mandelbrot<double, MandelUnroll::X2, true, true>();
+
+SIM_END(Mandelbrot)
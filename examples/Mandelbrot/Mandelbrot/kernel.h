@@ -1,8 +1,14 @@
+#pragma once
+
 #ifdef _MSC_VER
 #pragma float_control(precise, off)
 #endif
 
-#include "shading.h"
+#include "kernel_common.h"
+#include "reference_orbit.h"
+
+// Included inside the SIM namespace (see Mandelbrot_kernels.inl), so standard headers it needs
+// (<chrono>, <limits>, <utility>) must be included by the includer before the namespace opens
 
 inline int mandelbrot_depth(double x0, double y0, int iter_lim)
 {
@@ -21,62 +27,7 @@ inline int mandelbrot_depth(double x0, double y0, int iter_lim)
     return iter;
 }
 
-namespace detail
-{
-    /* ---------------------------------------------------------------- */
-    /*      Complex helpers                                             */
-    /* ---------------------------------------------------------------- */
-    template<class T> struct cplx { T x, y; };
-
-    template<class T>
-    FAST_INLINE constexpr void step(cplx<T>& z, const cplx<T>& c)
-    {
-        T xx = z.x * z.x;
-        T yy = z.y * z.y;
-        T xy = z.x * z.y;
-
-        z.x = xx - yy + c.x;
-        z.y = (xy + xy) + c.y;           // 2*x*y + cy
-    }
-
-    template<class T>
-    FAST_INLINE constexpr void step_d(const cplx<T>& z, cplx<T>& dz) // dz in/out
-    {
-        const T zx_dzx = z.x * dz.x;
-        const T zy_dzy = z.y * dz.y;
-        const T zx_dzy = z.x * dz.y;
-        const T zy_dzx = z.y * dz.x;
-
-        dz.x = ((zx_dzx - zy_dzy) + (zx_dzx - zy_dzy)) + T(1);
-        dz.y = (zx_dzy + zy_dzx) + (zx_dzy + zy_dzx);
-    }
-
-    template<class T>
-    FAST_INLINE constexpr T mag2(const cplx<T>& z)
-    {
-        return z.x * z.x + z.y * z.y;
-    }
-
-
-} // namespace detail
-
-
-
-constexpr double INSIDE_MANDELBROT_SET = std::numeric_limits<double>::max();
-const double INSIDE_MANDELBROT_SET_SKIPPED = std::nextafter(INSIDE_MANDELBROT_SET, 0.0);
-
-template<MandelSmoothing Smooth_Iter>
-constexpr double escape_radius()
-{
-    return (((int)Smooth_Iter & (int)MandelSmoothing::DIST) ? 512.0 : 64.0);
-}
 
-template<MandelSmoothing Smooth_Iter>
-constexpr double mandelbrot_smoothing_offset()
-{
-    constexpr double r2 = escape_radius<Smooth_Iter>();
-    return log2(log2(r2)) - 1.0;
-}
 
 template<typename T>
 FAST_INLINE bool interiorCheck(T x0, T y0)
@@ -100,25 +51,67 @@ FAST_INLINE bool interiorCheck(T x0, T y0)
     return false;
 }
 
-template<class T, MandelSmoothing S>
-FAST_INLINE void mandel_kernel(const T& x0, const T& y0,
+namespace detail
+{
+    // Smooth depth and distance estimate from the final orbit state
+    template<class T, MandelSmoothing S>
+    FAST_INLINE void mandel_result(int iter, int iter_lim, const T& r2, const cplx<T>& dz, double& depth, double& dist)
+    {
+        constexpr bool NEED_DIST = (bool)((int)S & (int)MandelSmoothing::DIST);
+        constexpr bool NEED_ITER = (bool)((int)S & (int)MandelSmoothing::ITER);
+
+        constexpr T zero = T(0);
+        constexpr T one = T(1);
+        constexpr T two = T(2);
+        constexpr T eps = std::numeric_limits<T>::epsilon();
+
+        if constexpr (NEED_DIST)
+        {
+            // d = |z| log|z| / |dz|, folded into a single sqrt and log
+            T dz2 = mag2(dz);
+            T d = (dz2 == zero) ? zero : T(0.5) * sqrt(r2 / dz2) * log(r2);
+            if (d < eps) d = eps;
+            dist = static_cast<double>(d);
+        }
+
+        if (iter == iter_lim)
+        {
+            depth = INSIDE_MANDELBROT_SET;
+        }
+        else if constexpr (NEED_ITER)
+        {
+            T t = log2(r2) / two;
+            T s = log2(t);
+            depth = static_cast<double>(iter + (one - s)) - mandelbrot_smoothing_offset<S>();
+        }
+        else
+        {
+            depth = static_cast<double>(iter);
+        }
+    }
+}
+
+
+// Checked: Also bound the accumulated rounding error, returning false if the result
+//          could be off by more than mixed_precision_tolerance (caller re-runs at higher precision)
+template<class T, MandelSmoothing S, MandelUnroll U = MandelUnroll::X1, bool Checked = false>
+FAST_INLINE bool mandel_kernel(const T& x0, const T& y0,
     int iter_lim,
     double& depth, double& dist)
 {
     if (interiorCheck(x0, y0))
     {
         depth = INSIDE_MANDELBROT_SET_SKIPPED;
-        return;
+        return true;
     }
 
     using detail::cplx;
     constexpr bool NEED_DIST = (bool)((int)S & (int)MandelSmoothing::DIST);
-    constexpr bool NEED_ITER = (bool)((int)S & (int)MandelSmoothing::ITER);
+    constexpr bool NEED_DZ = NEED_DIST || Checked;
 
     constexpr T escape_radius_squared = T(escape_radius<S>());
     constexpr T zero = T(0);
     constexpr T one = T(1);
-    constexpr T two = T(2);
     constexpr T eps = std::numeric_limits<T>::epsilon();
 
     cplx<T> z{ zero, zero };
@@ -126,13 +119,46 @@ FAST_INLINE void mandel_kernel(const T& x0, const T& y0,
     cplx<T> dz{ one, zero };
 
     int iter = 0;
-    T xx, yy, r2;
+    T xx, yy, r2 = zero;
 
+    if constexpr (unroll_iterations(U) > 1)
+    {
+        constexpr int N = unroll_iterations(U);
+
+        // Run N iterations per escape check. Once |z| passes the escape radius it keeps
+        // growing, so only the end of each block needs testing. On escape, roll back to
+        // the start of the block and let the exact loop below find the escape iteration.
+        while (iter <= iter_lim - N)
+        {
+            const cplx<T> z0 = z;
+            const cplx<T> dz0 = dz;
+
+            detail::repeat<N>([&]
+            {
+                if constexpr (NEED_DZ)
+                    detail::step_d(z, dz);              // dz = 2 z dz + 1 (uses z before stepping)
+                detail::step(z, c);                     // z = z² + c
+            });
+
+            // Negated so an orbit which overflowed to inf/nan mid-block also rolls back
+            r2 = detail::mag2(z);
+            if (!(r2 <= escape_radius_squared))
+            {
+                z = z0;
+                dz = dz0;
+                break;
+            }
+
+            iter += N;
+        }
+    }
+
+    // Exact loop (finishes the remaining < N iterations, or locates the escape after a rollback)
     while (iter < iter_lim)
     {
+        if constexpr (NEED_DZ)
+            detail::step_d(z, dz);                      // dz = 2 z dz + 1 (uses z before stepping)
         detail::step(z, c);                             // z = z² + c
-        if constexpr (NEED_DIST)
-            detail::step_d(z, dz);                      // dz = 2 z dz + 1
 
         xx = z.x * z.x;
         yy = z.y * z.y;
@@ -142,33 +168,172 @@ FAST_INLINE void mandel_kernel(const T& x0, const T& y0,
         ++iter;
     }
 
-    if constexpr (NEED_DIST)
+    detail::mandel_result<T, S>(iter, iter_lim, r2, dz, depth, dist);
+
+    if constexpr (Checked)
     {
-        //T r2 = xx + yy;
-        T r = sqrt(r2);
-        T dz_abs = sqrt(detail::mag2(dz));
-        T d = (dz_abs == zero) ? zero : r * log(r) / dz_abs;
-        if (d < eps) d = eps;
-        dist = static_cast<double>(d);
+        // dz sums the amplification of a unit perturbation made at each step, so rounding
+        // c and each step by ~eps gives an orbit error of roughly eps*|dz|. The smooth depth
+        // moves by about orbit_err / |z|. Negated so an overflowed dz (inf/nan) is rejected.
+        T orbit_err = eps * sqrt(detail::mag2(dz));
+        T z_abs = sqrt(r2 > one ? r2 : one);
+        if (!(orbit_err < T(mixed_precision_tolerance) * z_abs))
+            return false;
     }
 
-    if (iter == iter_lim)
+    return true;
+}
+
+
+
+namespace detail
+{
+    /* ---------------------------------------------------------------- */
+    /*      Unroll selection                                            */
+    /* ---------------------------------------------------------------- */
+
+    template<class T, MandelUnroll U>
+    double timeUnrolledKernel(int iter_lim)
     {
-        depth = INSIDE_MANDELBROT_SET;
+        if constexpr (!unroll_supported<T, MandelSmoothing::ITER, U>)
+        {
+            return std::numeric_limits<double>::max();
+        }
+        else
+        {
+            constexpr int sample_w = 48;
+            constexpr int sample_h = 32;
+
+            volatile double sink = 0.0;
+            double best_ms = std::numeric_limits<double>::max();
+
+            // Best of 3 to reject scheduler noise
+            for (int run = 0; run < 3; run++)
+            {
+                auto t0 = std::chrono::steady_clock::now();
+
+                // Sample grid over seahorse valley, where most time is spent once zoomed in
+                for (int py = 0; py < sample_h; py++)
+                {
+                    for (int px = 0; px < sample_w; px++)
+                    {
+                        T x0 = T(-0.755 + 0.02 * (px + 0.5) / sample_w);
+                        T y0 = T(0.1 + 0.02 * (py + 0.5) / sample_h);
+
+                        double depth, dist;
+                        mandel_kernel<T, MandelSmoothing::ITER, U>(x0, y0, iter_lim, depth, dist);
+                        sink = sink + depth;
+                    }
+                }
+
+                auto elapsed = std::chrono::steady_clock::now() - t0;
+                best_ms = std::min(best_ms, std::chrono::duration<double, std::milli>(elapsed).count());
+            }
+
+            return best_ms;
+        }
     }
-    else if constexpr (NEED_ITER)
+
+    // Unrolled variants benchmarkUnroll() would time for T
+    template<class T>
+    constexpr int supportedUnrollCount()
+    {
+        return unroll_supported<T, MandelSmoothing::ITER, MandelUnroll::X1> +
+               unroll_supported<T, MandelSmoothing::ITER, MandelUnroll::X2> +
+               unroll_supported<T, MandelSmoothing::ITER, MandelUnroll::X4>;
+    }
+
+    template<class T>
+    MandelUnroll benchmarkUnroll()
+    {
+        constexpr int iter_lim = 1000;
+
+        double ms[(int)MandelUnroll::COUNT] = {
+            timeUnrolledKernel<T, MandelUnroll::X1>(iter_lim),
+            timeUnrolledKernel<T, MandelUnroll::X2>(iter_lim),
+            timeUnrolledKernel<T, MandelUnroll::X4>(iter_lim)
+        };
+
+        int best = 0;
+        for (int i = 1; i < (int)MandelUnroll::COUNT; i++)
+        {
+            if (ms[i] < ms[best])
+                best = i;
+        }
+        return static_cast<MandelUnroll>(best);
+    }
+
+} // namespace detail
+
+// Fastest kernel variant for this CPU, benchmarked once per precision on first call
+// (unless X1 is the only variant compiled for T, e.g. software float types)
+template<class T>
+MandelUnroll fastestUnroll()
+{
+    if constexpr (detail::supportedUnrollCount<T>() <= 1)
     {
-        T t = log2(r2) / two;
-        T s = log2(t);
-        depth = static_cast<double>(iter + (one - s)) - mandelbrot_smoothing_offset<S>();
+        return MandelUnroll::X1;
     }
     else
     {
-        depth = static_cast<double>(iter);
+        static const MandelUnroll best = detail::benchmarkUnroll<T>();
+        return best;
     }
 }
 
+/// ======== Perturbation kernel ========
 
+// Iterates the offset d = z - Z from the reference orbit:  d' = 2Zd + d² + dc
+// Rebases onto the start of the reference (Zhuoran) whenever |z| < |d|, or when the
+// reference runs out, which avoids glitches without needing secondary references.
+template<MandelSmoothing S>
+FAST_INLINE void mandel_kernel_perturbed(const ReferenceOrbit& ref,
+    double dcx, double dcy,
+    int iter_lim,
+    double& depth, double& dist)
+{
+    using detail::cplx;
+    constexpr bool NEED_DIST = (bool)((int)S & (int)MandelSmoothing::DIST);
+    constexpr double escape_radius_squared = escape_radius<S>();
+
+    const cplx<double>* Z = ref.z.data();
+    const int ref_last = (int)ref.z.size() - 1;
+
+    cplx<double> d{ 0.0, 0.0 };
+    cplx<double> dc{ dcx, dcy };
+    cplx<double> z{ 0.0, 0.0 };
+    cplx<double> dz{ 1.0, 0.0 };
+
+    int iter = 0;
+    int ref_i = 0;
+    double r2 = 0.0;
+
+    while (iter < iter_lim)
+    {
+        if constexpr (NEED_DIST)
+            detail::step_d(z, dz);                      // dz = 2 z dz + 1 (uses z before stepping)
+
+        const cplx<double>& Zi = Z[ref_i];
+        const double dx = 2.0 * (Zi.x * d.x - Zi.y * d.y) + (d.x * d.x - d.y * d.y) + dc.x;
+        const double dy = 2.0 * (Zi.x * d.y + Zi.y * d.x) + 2.0 * d.x * d.y + dc.y;
+        d = { dx, dy };
+        ref_i++;
+
+        z = { Z[ref_i].x + d.x, Z[ref_i].y + d.y };
+        r2 = detail::mag2(z);
+        if (r2 > escape_radius_squared) break;
+
+        ++iter;
+
+        if (r2 < detail::mag2(d) || ref_i == ref_last)
+        {
+            d = z;
+            ref_i = 0;
+        }
+    }
+
+    detail::mandel_result<double, S>(iter, iter_lim, r2, dz, depth, dist);
+}
 
 
 template<bool smooth>
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "shading.h"
+#include <limits>
+#include <utility>
+
+// Kernel types, constants and variant traits, shared by the kernels and the scene. The kernels
+// themselves (kernel.h) are only included where they're instantiated (Mandelbrot_kernels.inl)
+
+namespace detail
+{
+    /* ---------------------------------------------------------------- */
+    /*      Complex helpers                                             */
+    /* ---------------------------------------------------------------- */
+    template<class T> struct cplx { T x, y; };
+
+    template<class T>
+    FAST_INLINE constexpr void step(cplx<T>& z, const cplx<T>& c)
+    {
+        T xx = z.x * z.x;
+        T yy = z.y * z.y;
+        T xy = z.x * z.y;
+
+        z.x = xx - yy + c.x;
+        z.y = (xy + xy) + c.y;           // 2*x*y + cy
+    }
+
+    template<class T>
+    FAST_INLINE constexpr void step_d(const cplx<T>& z, cplx<T>& dz) // dz in/out
+    {
+        const T zx_dzx = z.x * dz.x;
+        const T zy_dzy = z.y * dz.y;
+        const T zx_dzy = z.x * dz.y;
+        const T zy_dzx = z.y * dz.x;
+
+        dz.x = ((zx_dzx - zy_dzy) + (zx_dzx - zy_dzy)) + T(1);
+        dz.y = (zx_dzy + zy_dzx) + (zx_dzy + zy_dzx);
+    }
+
+    template<class T>
+    FAST_INLINE constexpr T mag2(const cplx<T>& z)
+    {
+        return z.x * z.x + z.y * z.y;
+    }
+
+    // Invoke f() exactly N times without a loop counter
+    template<int N, class F>
+    FAST_INLINE constexpr void repeat(F&& f)
+    {
+        [&]<int... K>(std::integer_sequence<int, K...>) {
+            ((void(K), f()), ...);
+        }(std::make_integer_sequence<int, N>{});
+    }
+
+
+} // namespace detail
+
+
+
+constexpr double INSIDE_MANDELBROT_SET = std::numeric_limits<double>::max();
+const double INSIDE_MANDELBROT_SET_SKIPPED = std::nextafter(INSIDE_MANDELBROT_SET, 0.0);
+
+template<MandelSmoothing Smooth_Iter>
+constexpr double escape_radius()
+{
+    return (((int)Smooth_Iter & (int)MandelSmoothing::DIST) ? 512.0 : 64.0);
+}
+
+template<MandelSmoothing Smooth_Iter>
+constexpr double mandelbrot_smoothing_offset()
+{
+    constexpr double r2 = escape_radius<Smooth_Iter>();
+    return log2(log2(r2)) - 1.0;
+}
+
+// Estimated smooth depth error (in iterations) accepted from a checked kernel.
+// Rounding errors mostly cancel, so the real error is typically ~10x smaller
+constexpr double mixed_precision_tolerance = 0.1;
+
+namespace detail
+{
+    template<class T, MandelSmoothing S, MandelUnroll U>
+    consteval bool unrollSupported()
+    {
+        if (U == MandelUnroll::X1)
+            return true;
+
+        // Software float types are bound by the per-block state copy
+        if (!std::is_floating_point_v<T>)
+            return false;
+
+        // After escaping, |z|² roughly squares every iteration, so a block can reach (r²)^(2^N).
+        // That mustn't overflow T before the end-of-block check, as inf - inf gives a nan
+        // which fast-math comparisons can't be trusted to catch
+        int log2_r2 = 0;
+        for (double r2 = escape_radius<S>() + 4.0; r2 >= 1.0; r2 /= 2.0)
+            log2_r2++;
+
+        return (log2_r2 << unroll_iterations(U)) < std::numeric_limits<T>::max_exponent;
+    }
+}
+
+// Unrolled variants which are worth compiling (and safe) for T and escape radius
+template<class T, MandelSmoothing S, MandelUnroll U>
+constexpr bool unroll_supported = detail::unrollSupported<T, S, U>();
+
+// Smoothing computed by mandel_kernel for the scene, depth is always smoothed and dist is optional
+constexpr MandelSmoothing kernel_smoothing(bool dist)
+{
+    return dist ? MandelSmoothing::MIX : MandelSmoothing::ITER;
+}
+
+// Fastest kernel variant for this CPU (see kernel.h), instantiated with the kernels of each precision
+template<class T>
+MandelUnroll fastestUnroll();
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "kernel_common.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// ======== Reference orbit ========
+
+// High-precision orbit of a single reference point. Stored at double precision,
+// since only the (small) offset of each pixel from it is iterated per pixel
+struct ReferenceOrbit
+{
+    flt128 cx, cy;
+    double view_size = 0.0;     // Diagonal of the view it was computed for
+    int iter_lim = 0;           // Iteration limit it was computed for
+    bool escaped = false;       // Escaped before iter_lim (valid for any iter_lim)
+
+    std::vector<detail::cplx<double>> z; // Z_0 (= 0) .. Z_n
+};
+
+inline std::shared_ptr<ReferenceOrbit> computeReferenceOrbit(flt128 cx, flt128 cy, double view_size, int iter_lim)
+{
+    auto orbit = std::make_shared<ReferenceOrbit>();
+    orbit->cx = cx;
+    orbit->cy = cy;
+    orbit->view_size = view_size;
+    orbit->iter_lim = iter_lim;
+    orbit->z.reserve(iter_lim + 1);
+
+    // Reference escapes long before |Z|² can lose precision as a double, so use a generous bailout
+    constexpr double ref_escape_radius_squared = 1e6;
+
+    detail::cplx<flt128> z{ flt128(0), flt128(0) };
+    detail::cplx<flt128> c{ cx, cy };
+    orbit->z.push_back({ 0.0, 0.0 });
+
+    for (int i = 0; i < iter_lim; i++)
+    {
+        detail::step(z, c);
+        orbit->z.push_back({ (double)z.x, (double)z.y });
+
+        if ((double)detail::mag2(z) > ref_escape_radius_squared)
+        {
+            orbit->escaped = true;
+            break;
+        }
+    }
+
+    return orbit;
+}
+
+/// ======== Cache ========
+
+// Owned by the project, so every viewport/scene (split views) and consecutive frames
+// (navigation, tweens) share reference orbits rather than each recomputing them
+class ReferenceOrbitCache
+{
+    static constexpr int max_orbits = 4;
+
+    // Reference may drift this many view diagonals from the view centre before it's replaced
+    static constexpr double max_offset_views = 1.0;
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<const ReferenceOrbit>> orbits; // Most recently used first
+
+public:
+
+    std::shared_ptr<const ReferenceOrbit> acquire(flt128 cx, flt128 cy, double view_size, int iter_lim)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (size_t i = 0; i < orbits.size(); i++)
+        {
+            std::shared_ptr<const ReferenceOrbit> orbit = orbits[i];
+
+            double ox = (double)(orbit->cx - cx);
+            double oy = (double)(orbit->cy - cy);
+            bool near = (ox * ox + oy * oy) <= (max_offset_views * view_size) * (max_offset_views * view_size);
+            bool deep_enough = orbit->escaped || orbit->iter_lim >= iter_lim;
+
+            if (near && deep_enough)
+            {
+                orbits.erase(orbits.begin() + i);
+                orbits.insert(orbits.begin(), orbit);
+                return orbit;
+            }
+        }
+
+        std::shared_ptr<const ReferenceOrbit> orbit = computeReferenceOrbit(cx, cy, view_size, iter_lim);
+        orbits.insert(orbits.begin(), orbit);
+        if ((int)orbits.size() > max_orbits)
+            orbits.pop_back();
+
+        return orbit;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        orbits.clear();
+    }
+};
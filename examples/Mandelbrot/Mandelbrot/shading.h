@@ -11,6 +11,24 @@ enum class MandelSmoothing
     COUNT
 };
 
+enum class MandelUnroll
+{
+    X1, // Escape check every iteration
+    X2, // Escape check every 2 iterations
+    X4, // Escape check every 4 iterations
+    COUNT
+};
+
+constexpr int unroll_iterations(MandelUnroll unroll)
+{
+    switch (unroll)
+    {
+    case MandelUnroll::X2: return 2;
+    case MandelUnroll::X4: return 4;
+    default:               return 1;
+    }
+}
+
 enum class MandelTransform
 {
     NONE,
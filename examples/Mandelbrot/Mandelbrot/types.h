@@ -31,8 +31,11 @@ struct EscapeFieldPixel
     double final_dist;
 };
 
-struct EscapeField : public std::vector<EscapeFieldPixel>
+// Written by every worker, so pages are first-touched in parallel (spread across NUMA nodes)
+struct EscapeField : public std::vector<EscapeFieldPixel, Thread::FirstTouchAllocator<EscapeFieldPixel>>
 {
+    using Storage = std::vector<EscapeFieldPixel, Thread::FirstTouchAllocator<EscapeFieldPixel>>;
+
     int compute_phase;
 
     double min_depth = 0.0;
@@ -47,8 +50,7 @@ struct EscapeField : public std::vector<EscapeFieldPixel>
 
     void setAllDepth(double value)
     {
-        for (int i = 0; i < size(); i++)
-            std::vector<EscapeFieldPixel>::at(i) = { value, value };
+        Thread::parallelFill(data(), size(), EscapeFieldPixel{ value, value });
     }
     void setDimensions(int _w, int _h)
     {
@@ -56,17 +58,20 @@ struct EscapeField : public std::vector<EscapeFieldPixel>
             return;
         w = _w;
         h = _h;
-        resize(w * h, { -1.0, -1.0 });
+
+        size_t old_size = size();
+        resize(w * h);
+        Thread::parallelFill(data() + old_size, size() - old_size, EscapeFieldPixel{ -1.0, -1.0 });
     }
 
     EscapeFieldPixel& operator ()(int x, int y)
     {
-        return std::vector<EscapeFieldPixel>::at(y * w + x);
+        return Storage::at(y * w + x);
     }
 
     EscapeFieldPixel& at(int x, int y)
     {
-        return std::vector<EscapeFieldPixel>::at(y * w + x);
+        return Storage::at(y * w + x);
     }
 
     EscapeFieldPixel* get(int x, int y)
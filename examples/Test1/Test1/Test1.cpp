@@ -222,12 +222,7 @@ void Test1_Scene::viewportDraw(Viewport* ctx) const
     ///ctx->drawSurface(obj);
 
     ctx->setFillStyle(255, 0, 255);
-    ctx->beginPath();
-    for (const Particle& p : particles)
-    {
-        ctx->circle(p.x, p.y, 0.5);
-    }
-    ctx->fill();
+    ctx->drawCircles(particles, 0.5);
 
     
     /*ctx->setFillStyle(255, 255, 255);
@@ -1,5 +1,4 @@
 #include "Tiger.h"
-#include "draw_tiger.h"
 
 SIM_DECLARE(Tiger)
 
@@ -38,7 +37,11 @@ void Tiger_Scene_Data::populate()
 }
 
 void Tiger_Scene::sceneStart()
-{}
+{
+    // Packed from Tiger/tiger.svg at build time (see CMakeLists.txt)
+    if (!tiger.load(Platform()->path("/data/tiger.blvg")))
+        print("Could not load tiger.blvg\n");
+}
 
 void Tiger_Scene::sceneMounted(Viewport*)
 {
@@ -70,7 +73,8 @@ void Tiger_Scene::viewportDraw(Viewport* ctx) const
     camera->scalingLines(scale_lines);
     camera->scalingSizes(scale_sizes);
 
-    draw_tiger(ctx);
+    // Static geometry, so captured once (per viewport) and redrawn from the cache
+    ctx->drawVectorPaths(tiger);
 }
 
 void Tiger_Scene::onEvent(Event e)
@@ -30,7 +30,13 @@ struct Tiger_Scene : public Scene<Tiger_Scene_Data>
 {
     // --- Custom Launch Config Example ---
     struct Config {};
-    Tiger_Scene(Config&) {}
+    Tiger_Scene(Config&)
+    {
+        // Each viewport has its own scene, which only updates its own camera
+        parallel_viewport_process = true;
+    }
+
+    VectorPaths tiger;
 
     // Scene management
     void sceneStart() override;
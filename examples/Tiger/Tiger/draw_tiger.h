@@ -1,4459 +0,0 @@
-// Auto-generated from SVG: tiger.svg
-void draw_tiger(BL::Painter* ctx) {
-    auto path_0 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(108.969, 403.827);
-        ctx->bezierTo(108.969, 403.827, 109.145, 407.171, 107.68, 407.138);
-        ctx->bezierTo(106.232, 407.104, 77.187, 322.221, 40.938, 326.181);
-        ctx->bezierTo(40.938, 326.181, 72.331, 313.198, 108.969, 403.827);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_0();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_0();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_1 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(115.201, 398.489);
-        ctx->bezierTo(115.201, 398.489, 114.23, 401.696, 112.871, 401.168);
-        ctx->bezierTo(111.511, 400.642, 113.065, 310.936, 77.646, 302.331);
-        ctx->bezierTo(77.646, 302.331, 111.582, 300.805, 115.201, 398.489);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_1();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_1();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_2 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(163.732, 473.226);
-        ctx->bezierTo(163.732, 473.226, 166.621, 474.921, 165.791, 476.121);
-        ctx->bezierTo(164.959, 477.304, 78.14, 454.704, 61.437, 487.121);
-        ctx->bezierTo(61.437, 487.121, 67.935, 453.768, 163.732, 473.226);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_2();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_2();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_3 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(158.772, 491.253);
-        ctx->bezierTo(158.772, 491.253, 162.049, 491.959, 161.636, 493.354);
-        ctx->bezierTo(161.225, 494.749, 71.696, 500.646, 66.063, 536.665);
-        ctx->bezierTo(66.063, 536.665, 61.72, 502.977, 158.772, 491.253);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_3();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_3();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_4 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(151.337, 481.507);
-        ctx->bezierTo(151.337, 481.507, 154.476, 482.672, 153.865, 483.996);
-        ctx->bezierTo(153.255, 485.32, 63.821, 478.099, 52.998, 512.9);
-        ctx->bezierTo(52.998, 512.9, 53.616, 478.929, 151.337, 481.507);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_4();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_4();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_5 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(132.434, 449.354);
-        ctx->bezierTo(132.434, 449.354, 134.747, 451.791, 133.617, 452.709);
-        ctx->bezierTo(132.487, 453.627, 55.258, 407.974, 30.274, 434.54);
-        ctx->bezierTo(30.274, 434.54, 45.706, 404.265, 132.434, 449.354);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_5();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_5();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_6 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(119.121, 456.752);
-        ctx->bezierTo(119.121, 456.752, 121.681, 458.906, 120.675, 459.948);
-        ctx->bezierTo(119.651, 460.99, 37.742, 424.374, 15.937, 453.592);
-        ctx->bezierTo(15.937, 453.592, 27.837, 421.769, 119.121, 456.752);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_6();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_6();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_7 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(114.53, 463.956);
-        ctx->bezierTo(114.53, 463.956, 117.355, 465.722, 116.49, 466.905);
-        ctx->bezierTo(115.625, 468.07, 29.497, 442.962, 11.876, 474.868);
-        ctx->bezierTo(11.876, 474.868, 19.327, 441.727, 114.53, 463.956);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_7();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_7();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_8 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(133.476, 465.033);
-        ctx->bezierTo(133.476, 465.033, 135.453, 467.734, 134.217, 468.511);
-        ctx->bezierTo(132.981, 469.271, 62.232, 414.098, 34.052, 437.242);
-        ctx->bezierTo(34.052, 437.242, 53.245, 409.196, 133.476, 465.033);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_8();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_8();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_9 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(98.551, 413.918);
-        ctx->bezierTo(98.551, 413.918, 99.611, 417.096, 98.198, 417.449);
-        ctx->bezierTo(96.786, 417.802, 46.288, 343.645, 12.388, 357.064);
-        ctx->bezierTo(12.388, 357.064, 39.226, 336.229, 98.551, 413.918);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_9();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_9();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_10 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(99.787, 426.24);
-        ctx->bezierTo(99.787, 426.24, 101.5, 429.116, 100.193, 429.764);
-        ctx->bezierTo(98.887, 430.414, 33.593, 368.892, 3.383, 389.306);
-        ctx->bezierTo(3.383, 389.306, 25.1, 363.175, 99.787, 426.24);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_10();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_10();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_11 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(99.575, 433.958);
-        ctx->bezierTo(99.575, 433.958, 101.553, 436.659, 100.317, 437.436);
-        ctx->bezierTo(99.081, 438.195, 28.332, 383.022, 0.152, 406.161);
-        ctx->bezierTo(0.152, 406.161, 19.344, 378.121, 99.575, 433.958);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.304);
-    path_11();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_11();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_12 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(95.673, 436.977);
-        ctx->bezierTo(96.556, 447.659, 98.304, 459.259, 101.376, 464.768);
-        ctx->bezierTo(101.376, 464.768, 95.02, 486.662, 110.558, 509.969);
-        ctx->bezierTo(110.558, 509.969, 109.851, 522.681, 112.676, 528.331);
-        ctx->bezierTo(112.676, 528.331, 119.739, 543.163, 128.214, 544.575);
-        ctx->bezierTo(135.065, 545.723, 150.474, 551.144, 167.885, 553.616);
-        ctx->bezierTo(167.885, 553.616, 198.134, 578.476, 192.484, 601.076);
-        ctx->bezierTo(192.484, 601.076, 191.777, 630.033, 185.421, 632.858);
-        ctx->bezierTo(185.421, 632.858, 205.903, 613.082, 188.952, 642.745);
-        ctx->lineTo(181.184, 675.939);
-        ctx->bezierTo(181.184, 675.939, 226.384, 637.802, 198.84, 670.289);
-        ctx->lineTo(181.184, 716.196);
-        ctx->bezierTo(181.184, 716.196, 215.79, 683.708, 203.078, 698.54);
-        ctx->lineTo(197.427, 714.077);
-        ctx->bezierTo(197.427, 714.077, 273.703, 666.052, 219.322, 718.315);
-        ctx->bezierTo(219.322, 718.315, 233.447, 711.959, 241.216, 716.902);
-        ctx->bezierTo(241.216, 716.902, 253.222, 714.784, 251.809, 717.609);
-        ctx->bezierTo(251.809, 717.609, 215.084, 735.971, 208.728, 768.459);
-        ctx->bezierTo(208.728, 768.459, 223.559, 750.803, 217.909, 769.872);
-        ctx->lineTo(218.615, 790.353);
-        ctx->bezierTo(218.615, 790.353, 225.678, 752.215, 224.972, 818.604);
-        ctx->bezierTo(224.972, 818.604, 258.872, 786.822, 238.39, 823.548);
-        ctx->lineTo(238.39, 853.21);
-        ctx->bezierTo(238.39, 853.21, 265.228, 824.254, 253.928, 846.854);
-        ctx->bezierTo(253.928, 846.854, 271.585, 831.316, 264.522, 858.154);
-        ctx->bezierTo(264.522, 858.154, 263.11, 876.517, 270.878, 856.742);
-        ctx->bezierTo(270.878, 856.742, 299.129, 802.713, 288.535, 848.973);
-        ctx->bezierTo(288.535, 848.973, 287.122, 882.873, 295.597, 856.742);
-        ctx->bezierTo(295.597, 856.742, 296.304, 875.104, 312.548, 887.817);
-        ctx->bezierTo(312.548, 887.817, 310.429, 798.122, 333.029, 861.685);
-        ctx->lineTo(340.092, 890.642);
-        ctx->bezierTo(340.092, 890.642, 345.036, 874.398, 344.329, 865.217);
-        ctx->lineTo(358.454, 879.342);
-        ctx->bezierTo(358.454, 879.342, 385.292, 839.085, 379.642, 862.392);
-        ctx->bezierTo(379.642, 862.392, 366.223, 890.642, 369.048, 899.117);
-        ctx->bezierTo(369.048, 899.117, 398.711, 837.673, 400.83, 834.848);
-        ctx->bezierTo(400.83, 834.848, 397.299, 909.711, 416.368, 846.148);
-        ctx->bezierTo(416.368, 846.148, 426.255, 867.336, 421.311, 875.104);
-        ctx->bezierTo(421.311, 875.104, 435.437, 860.979, 434.024, 855.329);
-        ctx->bezierTo(434.024, 855.329, 442.146, 840.851, 447.09, 864.864);
-        ctx->bezierTo(447.09, 864.864, 450.268, 881.461, 453.093, 875.811);
-        ctx->bezierTo(453.093, 875.811, 460.156, 918.186, 462.274, 877.929);
-        ctx->bezierTo(462.274, 877.929, 465.099, 853.917, 452.387, 833.435);
-        ctx->bezierTo(452.387, 833.435, 453.799, 827.785, 448.856, 820.722);
-        ctx->bezierTo(448.856, 820.722, 472.868, 858.86, 460.156, 808.01);
-        ctx->bezierTo(460.156, 808.01, 479.933, 822.135, 482.051, 822.135);
-        ctx->bezierTo(482.051, 822.135, 458.037, 781.172, 473.575, 789.647);
-        ctx->bezierTo(473.575, 789.647, 464.393, 771.284, 496.177, 792.472);
-        ctx->bezierTo(496.177, 792.472, 467.925, 764.222, 499.002, 781.172);
-        ctx->bezierTo(499.002, 781.172, 513.125, 792.472, 499.708, 774.816);
-        ctx->bezierTo(499.708, 774.816, 474.281, 746.565, 513.125, 778.347);
-        ctx->bezierTo(513.125, 778.347, 533.607, 807.304, 535.019, 812.247);
-        ctx->bezierTo(535.019, 812.247, 517.363, 760.691, 509.594, 755.747);
-        ctx->bezierTo(509.594, 755.747, 524.425, 691.477, 597.17, 719.021);
-        ctx->bezierTo(597.17, 719.021, 609.176, 749.39, 616.945, 716.902);
-        ctx->bezierTo(616.945, 716.902, 639.545, 705.602, 659.321, 754.334);
-        ctx->bezierTo(659.321, 754.334, 666.383, 730.321, 664.971, 725.378);
-        ctx->bezierTo(664.971, 725.378, 676.977, 727.496, 675.565, 725.378);
-        ctx->bezierTo(675.565, 725.378, 698.871, 733.146, 700.99, 731.734);
-        ctx->bezierTo(700.99, 731.734, 712.996, 743.74, 713.702, 737.384);
-        ctx->bezierTo(713.702, 737.384, 729.946, 742.328, 726.415, 735.971);
-        ctx->bezierTo(726.415, 735.971, 741.953, 763.516, 742.659, 769.872);
-        ctx->lineTo(746.897, 745.153);
-        ctx->lineTo(750.428, 750.097);
-        ctx->bezierTo(750.428, 750.097, 753.253, 736.678, 751.84, 734.559);
-        ctx->bezierTo(750.428, 732.44, 787.153, 746.565, 795.628, 783.291);
-        ctx->lineTo(799.16, 798.122);
-        ctx->bezierTo(799.16, 798.122, 809.754, 771.991, 806.929, 764.928);
-        ctx->bezierTo(806.929, 764.928, 816.11, 766.341, 816.816, 774.109);
-        ctx->bezierTo(816.816, 774.109, 823.879, 733.146, 815.404, 722.553);
-        ctx->bezierTo(815.404, 722.553, 823.173, 721.14, 825.291, 727.496);
-        ctx->lineTo(825.291, 714.784);
-        ctx->bezierTo(825.291, 714.784, 838.004, 716.196, 838.004, 711.959);
-        ctx->bezierTo(838.004, 711.959, 845.773, 704.896, 849.304, 713.371);
-        ctx->bezierTo(849.304, 713.371, 827.41, 651.22, 859.898, 685.121);
-        ctx->bezierTo(859.898, 685.121, 872.611, 704.19, 866.254, 670.996);
-        ctx->bezierTo(859.898, 637.802, 852.835, 634.977, 861.311, 634.27);
-        ctx->bezierTo(861.311, 634.27, 862.723, 627.914, 859.192, 625.089);
-        ctx->bezierTo(855.66, 622.264, 861.311, 625.089, 861.311, 625.089);
-        ctx->bezierTo(861.311, 625.089, 869.786, 632.151, 860.604, 593.307);
-        ctx->bezierTo(860.604, 593.307, 871.904, 596.132, 850.717, 544.575);
-        ctx->bezierTo(850.717, 544.575, 855.66, 540.338, 848.598, 525.506);
-        ctx->bezierTo(848.598, 525.506, 862.723, 533.275, 867.667, 530.45);
-        ctx->bezierTo(867.667, 530.45, 866.961, 527.625, 861.311, 520.563);
-        ctx->bezierTo(861.311, 520.563, 823.173, 423.805, 859.192, 462.649);
-        ctx->bezierTo(859.192, 462.649, 880.115, 486.574, 868.815, 446.317);
-        ctx->bezierTo(868.815, 446.317, 852.729, 403.926, 854.107, 396.341);
-        ctx->lineTo(95.673, 436.977);
-        ctx->closePath();
-    };
-    path_12();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_12();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_13 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(854.107, 396.694);
-        ctx->bezierTo(855.201, 397.013, 859.103, 398.998, 861.311, 401.911);
-        ctx->bezierTo(861.311, 401.911, 873.317, 420.98, 864.136, 388.492);
-        ctx->bezierTo(864.136, 388.492, 847.892, 337.642, 863.429, 357.417);
-        ctx->bezierTo(863.429, 357.417, 874.023, 370.13, 868.373, 346.117);
-        ctx->bezierTo(861.558, 317.112, 857.073, 305.86, 857.073, 305.86);
-        ctx->bezierTo(857.073, 305.86, 877.554, 314.335, 830.235, 244.416);
-        ctx->lineTo(845.773, 250.772);
-        ctx->bezierTo(845.773, 250.772, 811.166, 180.852, 773.028, 171.671);
-        ctx->lineTo(758.903, 161.077);
-        ctx->bezierTo(758.903, 161.077, 826.704, 93.982, 804.104, 29.007);
-        ctx->bezierTo(804.104, 29.007, 792.097, 19.825, 775.147, 36.069);
-        ctx->bezierTo(775.147, 36.069, 763.847, 44.544, 753.253, 41.719);
-        ctx->bezierTo(753.253, 41.719, 698.871, 43.838, 695.34, 43.838);
-        ctx->bezierTo(691.808, 43.838, 630.364, -21.844, 514.538, 9.231);
-        ctx->bezierTo(514.538, 9.231, 505.356, 12.763, 497.589, 10.644);
-        ctx->bezierTo(497.589, 10.644, 465.099, -17.606, 378.936, 22.65);
-        ctx->bezierTo(378.936, 22.65, 361.279, 26.182, 358.454, 26.182);
-        ctx->bezierTo(355.629, 26.182, 350.686, 26.182, 336.56, 37.482);
-        ctx->bezierTo(322.435, 48.782, 321.729, 50.194, 318.198, 53.019);
-        ctx->bezierTo(318.198, 53.019, 289.241, 72.795, 280.766, 74.207);
-        ctx->bezierTo(280.766, 74.207, 260.285, 85.507, 252.516, 103.164);
-        ctx->lineTo(246.159, 105.283);
-        ctx->bezierTo(246.159, 105.283, 243.334, 117.995, 242.628, 120.114);
-        ctx->bezierTo(242.628, 120.114, 234.153, 126.47, 232.74, 136.358);
-        ctx->bezierTo(232.74, 136.358, 217.203, 146.952, 217.909, 154.721);
-        ctx->bezierTo(217.909, 154.721, 215.084, 163.902, 213.671, 172.377);
-        ctx->bezierTo(213.671, 172.377, 200.959, 180.852, 202.371, 185.796);
-        ctx->bezierTo(202.371, 185.796, 188.952, 210.515, 191.071, 222.522);
-        ctx->bezierTo(191.071, 222.522, 179.771, 221.815, 174.827, 226.053);
-        ctx->bezierTo(174.827, 226.053, 173.415, 234.528, 170.59, 235.234);
-        ctx->bezierTo(170.59, 235.234, 165.646, 237.353, 169.883, 244.416);
-        ctx->bezierTo(169.883, 244.416, 167.058, 249.359, 166.352, 252.184);
-        ctx->bezierTo(166.352, 252.184, 167.765, 257.128, 159.996, 267.016);
-        ctx->bezierTo(159.996, 267.016, 148.696, 300.21, 152.227, 309.391);
-        ctx->bezierTo(152.227, 309.391, 152.933, 317.866, 147.989, 320.691);
-        ctx->bezierTo(147.989, 320.691, 141.633, 319.985, 156.465, 341.173);
-        ctx->bezierTo(156.465, 341.173, 157.877, 343.292, 152.227, 347.529);
-        ctx->bezierTo(152.227, 347.529, 121.858, 353.886, 117.62, 382.842);
-        ctx->bezierTo(117.62, 382.842, 93.607, 408.974, 93.607, 418.155);
-        ctx->bezierTo(93.607, 422.225, 94.084, 427.781, 95.32, 435.918);
-        ctx->bezierTo(95.32, 435.918, 94.314, 450.643, 143.046, 452.056);
-        ctx->bezierTo(191.777, 453.468, 854.107, 396.694, 854.107, 396.694);
-        ctx->closePath();
-    };
-    path_13();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-    path_13();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_14 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(120.798, 436.165);
-        ctx->bezierTo(76.657, 366.598, 102.083, 466.181, 102.083, 466.181);
-        ctx->bezierTo(117.62, 526.919, 346.448, 460.531, 346.448, 460.531);
-        ctx->bezierTo(346.448, 460.531, 644.489, 406.855, 664.264, 399.792);
-        ctx->bezierTo(684.04, 392.73, 852.129, 404.03, 852.129, 404.03);
-        ctx->lineTo(842.242, 374.367);
-        ctx->bezierTo(727.828, 292.441, 693.927, 333.404, 669.914, 326.342);
-        ctx->bezierTo(645.902, 319.279, 650.139, 336.229, 644.489, 337.642);
-        ctx->bezierTo(638.839, 339.054, 569.626, 295.266, 558.326, 296.679);
-        ctx->bezierTo(547.025, 298.091, 502.284, 256.155, 528.663, 312.216);
-        ctx->bezierTo(556.913, 372.248, 425.549, 381.43, 395.886, 361.654);
-        ctx->bezierTo(366.223, 341.879, 408.599, 394.142, 408.599, 394.142);
-        ctx->bezierTo(441.087, 429.455, 380.348, 399.792, 380.348, 399.792);
-        ctx->bezierTo(319.61, 377.192, 277.235, 422.393, 271.585, 423.805);
-        ctx->bezierTo(265.935, 425.218, 257.459, 430.868, 256.047, 419.568);
-        ctx->bezierTo(254.634, 408.268, 241.374, 378.779, 185.421, 425.218);
-        ctx->bezierTo(150.108, 454.527, 125.742, 415.683, 125.742, 415.683);
-        ctx->lineTo(120.798, 436.165);
-        ctx->closePath();
-    };
-    path_14();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_15 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(560.639, 299.761);
-        ctx->bezierTo(549.338, 301.174, 504.544, 259.259, 530.976, 315.299);
-        ctx->bezierTo(560.285, 377.45, 427.862, 384.513, 398.199, 364.737);
-        ctx->bezierTo(368.535, 344.962, 410.912, 397.225, 410.912, 397.225);
-        ctx->bezierTo(443.4, 432.545, 382.66, 402.875, 382.66, 402.875);
-        ctx->bezierTo(321.921, 380.275, 279.546, 425.476, 273.896, 426.888);
-        ctx->bezierTo(268.246, 428.301, 259.771, 433.958, 258.358, 422.65);
-        ctx->bezierTo(256.946, 411.35, 243.917, 382.157, 187.732, 428.301);
-        ctx->bezierTo(150.237, 458.924, 126.413, 421.046, 126.413, 421.046);
-        ctx->lineTo(120.763, 438.901);
-        ctx->bezierTo(76.622, 368.622, 103.23, 471.584, 103.23, 471.584);
-        ctx->bezierTo(118.786, 532.322, 348.761, 463.621, 348.761, 463.621);
-        ctx->bezierTo(348.761, 463.621, 646.802, 409.938, 666.577, 402.875);
-        ctx->bezierTo(686.353, 395.813, 852.906, 406.984, 852.906, 406.984);
-        ctx->lineTo(843.142, 376.422);
-        ctx->bezierTo(728.728, 294.496, 696.24, 336.487, 672.227, 329.424);
-        ctx->bezierTo(648.215, 322.362, 652.452, 339.312, 646.802, 340.724);
-        ctx->bezierTo(641.152, 342.137, 571.939, 298.349, 560.639, 299.761);
-        ctx->closePath();
-    };
-    path_15();
-    ctx->setFillStyle(232, 127, 58, 255);
-    ctx->fill();
-
-    auto path_16 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(562.952, 302.843);
-        ctx->bezierTo(551.651, 304.255, 507.969, 261.828, 533.289, 318.38);
-        ctx->bezierTo(561.892, 382.298, 430.173, 387.595, 400.51, 367.82);
-        ctx->bezierTo(370.848, 348.045, 413.223, 400.308, 413.223, 400.308);
-        ctx->bezierTo(445.711, 435.617, 384.973, 405.958, 384.973, 405.958);
-        ctx->bezierTo(324.234, 383.358, 281.857, 428.558, 276.207, 429.971);
-        ctx->bezierTo(270.557, 431.383, 262.082, 437.03, 260.669, 425.733);
-        ctx->bezierTo(259.257, 414.433, 246.459, 385.535, 190.044, 431.383);
-        ctx->bezierTo(150.364, 463.32, 127.084, 426.408, 127.084, 426.408);
-        ctx->lineTo(120.728, 441.621);
-        ctx->bezierTo(78.705, 372.764, 104.396, 476.969, 104.396, 476.969);
-        ctx->bezierTo(119.933, 537.707, 351.074, 466.693, 351.074, 466.693);
-        ctx->bezierTo(351.074, 466.693, 649.115, 413.021, 668.89, 405.958);
-        ctx->bezierTo(688.666, 398.895, 853.665, 409.938, 853.665, 409.938);
-        ctx->lineTo(844.042, 378.478);
-        ctx->bezierTo(729.629, 296.552, 698.553, 339.568, 674.54, 332.505);
-        ctx->bezierTo(650.528, 325.443, 654.765, 342.393, 649.115, 343.807);
-        ctx->bezierTo(643.465, 345.22, 574.252, 301.43, 562.952, 302.843);
-        ctx->closePath();
-    };
-    path_16();
-    ctx->setFillStyle(234, 140, 77, 255);
-    ctx->fill();
-
-    auto path_17 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(565.265, 305.925);
-        ctx->bezierTo(553.964, 307.338, 510.3, 264.906, 535.602, 321.463);
-        ctx->bezierTo(565.265, 387.774, 431.542, 390.05, 402.822, 370.901);
-        ctx->bezierTo(373.159, 351.126, 415.534, 403.389, 415.534, 403.389);
-        ctx->bezierTo(448.022, 438.707, 387.284, 409.039, 387.284, 409.039);
-        ctx->bezierTo(326.546, 386.439, 284.17, 431.645, 278.52, 433.057);
-        ctx->bezierTo(272.87, 434.47, 264.395, 440.12, 262.982, 428.814);
-        ctx->bezierTo(261.57, 417.514, 249.004, 388.914, 192.355, 434.47);
-        ctx->bezierTo(150.493, 467.717, 127.755, 431.768, 127.755, 431.768);
-        ctx->lineTo(120.693, 444.357);
-        ctx->bezierTo(82.201, 379.376, 105.543, 482.354, 105.543, 482.354);
-        ctx->bezierTo(121.081, 543.092, 353.387, 469.783, 353.387, 469.783);
-        ctx->bezierTo(353.387, 469.783, 651.428, 416.102, 671.203, 409.039);
-        ctx->bezierTo(690.979, 401.977, 854.442, 412.892, 854.442, 412.892);
-        ctx->lineTo(844.943, 380.533);
-        ctx->bezierTo(730.529, 298.605, 700.866, 342.651, 676.853, 335.588);
-        ctx->bezierTo(652.841, 328.526, 657.078, 345.476, 651.428, 346.888);
-        ctx->bezierTo(645.778, 348.301, 576.565, 304.513, 565.265, 305.925);
-        ctx->closePath();
-    };
-    path_17();
-    ctx->setFillStyle(236, 153, 97, 255);
-    ctx->fill();
-
-    auto path_18 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(567.578, 309.008);
-        ctx->bezierTo(556.277, 310.421, 513.496, 267.597, 537.915, 324.546);
-        ctx->bezierTo(567.578, 393.759, 434.796, 393.759, 405.133, 373.984);
-        ctx->bezierTo(375.47, 354.209, 417.845, 406.472, 417.845, 406.472);
-        ctx->bezierTo(450.333, 441.779, 389.595, 412.122, 389.595, 412.122);
-        ctx->bezierTo(328.857, 389.522, 286.481, 434.717, 280.831, 436.129);
-        ctx->bezierTo(275.181, 437.542, 266.706, 443.192, 265.294, 431.892);
-        ctx->bezierTo(263.881, 420.597, 251.548, 392.292, 194.668, 437.542);
-        ctx->bezierTo(150.622, 472.113, 128.444, 437.136, 128.444, 437.136);
-        ctx->lineTo(120.675, 447.076);
-        ctx->bezierTo(85.715, 385.635, 106.709, 487.757, 106.709, 487.757);
-        ctx->bezierTo(122.246, 548.495, 355.7, 472.855, 355.7, 472.855);
-        ctx->bezierTo(355.7, 472.855, 653.741, 419.185, 673.516, 412.122);
-        ctx->bezierTo(693.292, 405.059, 855.219, 415.846, 855.219, 415.846);
-        ctx->lineTo(845.843, 382.586);
-        ctx->bezierTo(731.43, 300.66, 703.179, 345.734, 679.166, 338.671);
-        ctx->bezierTo(655.154, 331.608, 659.391, 348.559, 653.741, 349.971);
-        ctx->bezierTo(648.091, 351.384, 578.878, 307.596, 567.578, 309.008);
-        ctx->closePath();
-    };
-    path_18();
-    ctx->setFillStyle(238, 165, 117, 255);
-    ctx->fill();
-
-    auto path_19 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(569.891, 312.089);
-        ctx->bezierTo(558.59, 313.502, 512.737, 272.096, 540.228, 327.627);
-        ctx->bezierTo(574.128, 396.134, 437.107, 396.84, 407.444, 377.065);
-        ctx->bezierTo(377.781, 357.29, 420.157, 409.553, 420.157, 409.553);
-        ctx->bezierTo(452.645, 444.869, 391.906, 415.203, 391.906, 415.203);
-        ctx->bezierTo(331.168, 392.603, 288.793, 437.807, 283.143, 439.219);
-        ctx->bezierTo(277.492, 440.632, 269.017, 446.282, 267.605, 434.982);
-        ctx->bezierTo(266.192, 423.678, 254.091, 395.67, 196.979, 440.632);
-        ctx->bezierTo(150.751, 476.527, 129.115, 442.486, 129.115, 442.486);
-        ctx->lineTo(120.64, 449.813);
-        ctx->bezierTo(88.858, 391.19, 107.856, 493.142, 107.856, 493.142);
-        ctx->bezierTo(123.394, 553.88, 358.013, 475.945, 358.013, 475.945);
-        ctx->bezierTo(358.013, 475.945, 656.054, 422.266, 675.829, 415.203);
-        ctx->bezierTo(695.605, 408.14, 855.978, 418.798, 855.978, 418.798);
-        ctx->lineTo(846.744, 384.641);
-        ctx->bezierTo(732.33, 302.715, 705.492, 348.815, 681.479, 341.752);
-        ctx->bezierTo(657.467, 334.69, 661.704, 351.64, 656.054, 353.052);
-        ctx->bezierTo(650.404, 354.465, 581.191, 310.677, 569.891, 312.089);
-        ctx->closePath();
-    };
-    path_19();
-    ctx->setFillStyle(241, 178, 136, 255);
-    ctx->fill();
-
-    auto path_20 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(572.204, 315.17);
-        ctx->bezierTo(560.903, 316.583, 514.379, 275.514, 542.541, 330.708);
-        ctx->bezierTo(578.56, 401.336, 439.418, 399.923, 409.755, 380.148);
-        ctx->bezierTo(380.092, 360.373, 422.468, 412.636, 422.468, 412.636);
-        ctx->bezierTo(454.956, 447.942, 394.218, 418.286, 394.218, 418.286);
-        ctx->bezierTo(333.479, 395.686, 291.104, 440.879, 285.454, 442.292);
-        ctx->bezierTo(279.804, 443.704, 271.329, 449.354, 269.916, 438.054);
-        ctx->bezierTo(268.504, 426.761, 256.633, 399.047, 199.29, 443.704);
-        ctx->bezierTo(150.878, 480.924, 129.786, 447.853, 129.786, 447.853);
-        ctx->lineTo(120.604, 452.532);
-        ctx->bezierTo(92.354, 399.217, 109.022, 498.545, 109.022, 498.545);
-        ctx->bezierTo(124.559, 559.283, 360.308, 479.017, 360.308, 479.017);
-        ctx->bezierTo(360.308, 479.017, 658.349, 425.348, 678.125, 418.286);
-        ctx->bezierTo(697.9, 411.223, 856.737, 421.752, 856.737, 421.752);
-        ctx->lineTo(847.627, 386.697);
-        ctx->bezierTo(733.213, 304.771, 707.788, 351.897, 683.775, 344.835);
-        ctx->bezierTo(659.762, 337.771, 664, 354.723, 658.349, 356.135);
-        ctx->bezierTo(652.699, 357.548, 583.486, 313.758, 572.186, 315.17);
-        ctx->closePath();
-    };
-    path_20();
-    ctx->setFillStyle(243, 191, 156, 255);
-    ctx->fill();
-
-    auto path_21 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(574.499, 318.253);
-        ctx->bezierTo(563.199, 319.666, 514.749, 279.63, 544.836, 333.791);
-        ctx->bezierTo(583.68, 403.71, 441.729, 403.004, 412.067, 383.229);
-        ctx->bezierTo(382.404, 363.454, 424.779, 415.717, 424.779, 415.717);
-        ctx->bezierTo(457.267, 451.031, 396.529, 421.367, 396.529, 421.367);
-        ctx->bezierTo(335.791, 398.767, 293.415, 443.969, 287.765, 445.381);
-        ctx->bezierTo(282.115, 446.794, 273.64, 452.444, 272.227, 441.144);
-        ctx->bezierTo(270.815, 429.842, 259.177, 402.427, 201.601, 446.794);
-        ctx->bezierTo(151.007, 485.32, 130.457, 453.221, 130.457, 453.221);
-        ctx->lineTo(120.569, 455.269);
-        ctx->bezierTo(95.144, 405.123, 110.169, 503.93, 110.169, 503.93);
-        ctx->bezierTo(125.707, 564.668, 362.621, 482.107, 362.621, 482.107);
-        ctx->bezierTo(362.621, 482.107, 660.662, 428.429, 680.438, 421.367);
-        ctx->bezierTo(700.213, 414.304, 857.532, 424.706, 857.532, 424.706);
-        ctx->lineTo(848.527, 388.75);
-        ctx->bezierTo(734.113, 306.824, 710.101, 354.979, 686.088, 347.916);
-        ctx->bezierTo(662.075, 340.853, 666.313, 357.804, 660.662, 359.216);
-        ctx->bezierTo(655.012, 360.629, 585.799, 316.841, 574.499, 318.253);
-        ctx->closePath();
-    };
-    path_21();
-    ctx->setFillStyle(245, 204, 176, 255);
-    ctx->fill();
-
-    auto path_22 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(576.812, 321.336);
-        ctx->bezierTo(565.512, 322.748, 517.062, 282.711, 547.149, 336.874);
-        ctx->bezierTo(585.993, 406.793, 444.042, 406.087, 414.38, 386.312);
-        ctx->bezierTo(384.717, 366.536, 427.092, 418.8, 427.092, 418.8);
-        ctx->bezierTo(459.58, 454.104, 398.842, 424.45, 398.842, 424.45);
-        ctx->bezierTo(338.102, 401.849, 295.726, 447.041, 290.076, 448.454);
-        ctx->bezierTo(284.426, 449.866, 275.951, 455.516, 274.539, 444.216);
-        ctx->bezierTo(273.126, 432.916, 261.722, 405.804, 203.913, 449.866);
-        ctx->bezierTo(151.136, 489.717, 131.145, 458.571, 131.145, 458.571);
-        ctx->lineTo(120.551, 457.988);
-        ctx->bezierTo(96.521, 411.382, 111.335, 509.333, 111.335, 509.333);
-        ctx->bezierTo(126.872, 570.071, 364.934, 485.179, 364.934, 485.179);
-        ctx->bezierTo(364.934, 485.179, 662.975, 431.512, 682.751, 424.45);
-        ctx->bezierTo(702.526, 417.387, 858.291, 427.66, 858.291, 427.66);
-        ctx->lineTo(849.445, 390.805);
-        ctx->bezierTo(735.014, 308.879, 712.414, 358.061, 688.401, 350.999);
-        ctx->bezierTo(664.388, 343.936, 668.626, 360.886, 662.975, 362.299);
-        ctx->bezierTo(657.325, 363.711, 588.112, 319.923, 576.812, 321.336);
-        ctx->closePath();
-    };
-    path_22();
-    ctx->setFillStyle(248, 216, 196, 255);
-    ctx->fill();
-
-    auto path_23 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(579.125, 324.417);
-        ctx->bezierTo(567.825, 325.829, 520.064, 285.419, 549.462, 339.955);
-        ctx->bezierTo(588.306, 411.993, 446.354, 409.168, 416.691, 389.393);
-        ctx->bezierTo(387.028, 369.618, 429.403, 421.881, 429.403, 421.881);
-        ctx->bezierTo(461.891, 457.194, 401.153, 427.531, 401.153, 427.531);
-        ctx->bezierTo(340.415, 404.93, 298.039, 450.131, 292.389, 451.544);
-        ctx->bezierTo(286.737, 452.956, 278.262, 458.606, 276.85, 447.306);
-        ctx->bezierTo(275.437, 436.006, 264.264, 409.182, 206.224, 452.956);
-        ctx->bezierTo(151.265, 494.113, 131.816, 463.938, 131.816, 463.938);
-        ctx->lineTo(120.516, 460.725);
-        ctx->bezierTo(97.563, 418.349, 112.482, 514.718, 112.482, 514.718);
-        ctx->bezierTo(128.02, 575.457, 367.247, 488.269, 367.247, 488.269);
-        ctx->bezierTo(367.247, 488.269, 665.288, 434.593, 685.064, 427.531);
-        ctx->bezierTo(704.839, 420.468, 859.068, 430.614, 859.068, 430.614);
-        ctx->lineTo(850.328, 392.86);
-        ctx->bezierTo(735.914, 310.933, 714.727, 361.142, 690.714, 354.08);
-        ctx->bezierTo(666.701, 347.017, 670.939, 363.967, 665.288, 365.38);
-        ctx->bezierTo(659.638, 366.792, 590.425, 323.004, 579.125, 324.417);
-        ctx->closePath();
-    };
-    path_23();
-    ctx->setFillStyle(250, 229, 215, 255);
-    ctx->fill();
-
-    auto path_24 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(581.438, 327.498);
-        ctx->bezierTo(570.138, 328.911, 524.284, 287.517, 551.775, 343.036);
-        ctx->bezierTo(589.207, 418.607, 448.665, 412.251, 419.002, 392.476);
-        ctx->bezierTo(389.339, 372.7, 431.715, 424.963, 431.715, 424.963);
-        ctx->bezierTo(464.203, 460.283, 403.464, 430.614, 403.464, 430.614);
-        ctx->bezierTo(342.726, 408.013, 300.351, 453.221, 294.7, 454.633);
-        ctx->bezierTo(289.05, 456.046, 280.575, 461.696, 279.163, 450.396);
-        ctx->bezierTo(277.75, 439.096, 266.809, 412.562, 208.537, 456.046);
-        ctx->bezierTo(151.392, 498.51, 132.487, 469.288, 132.487, 469.288);
-        ctx->lineTo(120.481, 463.462);
-        ctx->bezierTo(97.88, 422.492, 113.648, 520.121, 113.648, 520.121);
-        ctx->bezierTo(129.185, 580.859, 369.56, 491.359, 369.56, 491.359);
-        ctx->bezierTo(369.56, 491.359, 667.601, 437.683, 687.377, 430.614);
-        ctx->bezierTo(707.152, 423.551, 859.827, 433.569, 859.827, 433.569);
-        ctx->lineTo(851.229, 394.914);
-        ctx->bezierTo(736.815, 312.988, 717.04, 364.225, 693.027, 357.163);
-        ctx->bezierTo(669.014, 350.098, 673.252, 367.05, 667.601, 368.463);
-        ctx->bezierTo(661.951, 369.875, 592.738, 326.086, 581.438, 327.498);
-        ctx->closePath();
-    };
-    path_24();
-    ctx->setFillStyle(252, 242, 235, 255);
-    ctx->fill();
-
-    auto path_25 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(120.445, 466.181);
-        ctx->bezierTo(97.845, 427.336, 114.795, 525.506, 114.795, 525.506);
-        ctx->bezierTo(130.333, 586.245, 371.873, 494.431, 371.873, 494.431);
-        ctx->bezierTo(371.873, 494.431, 669.914, 440.755, 689.69, 433.693);
-        ctx->bezierTo(709.465, 426.63, 860.604, 436.518, 860.604, 436.518);
-        ctx->lineTo(852.129, 396.967);
-        ctx->bezierTo(737.715, 315.041, 719.353, 367.305, 695.34, 360.242);
-        ctx->bezierTo(671.327, 353.179, 675.565, 370.13, 669.914, 371.542);
-        ctx->bezierTo(664.264, 372.955, 595.051, 329.167, 583.751, 330.579);
-        ctx->bezierTo(572.451, 331.992, 527.921, 289.957, 554.088, 346.117);
-        ctx->bezierTo(593.338, 430.35, 446.809, 412.553, 421.311, 395.555);
-        ctx->bezierTo(391.649, 375.78, 434.024, 428.043, 434.024, 428.043);
-        ctx->bezierTo(466.512, 463.356, 405.774, 433.693, 405.774, 433.693);
-        ctx->bezierTo(345.036, 411.093, 302.66, 456.293, 297.01, 457.706);
-        ctx->bezierTo(291.36, 459.118, 282.885, 464.768, 281.472, 453.468);
-        ctx->bezierTo(280.06, 442.168, 269.351, 415.937, 210.846, 459.118);
-        ctx->bezierTo(151.521, 502.906, 133.158, 474.656, 133.158, 474.656);
-        ctx->lineTo(120.445, 466.181);
-        ctx->closePath();
-    };
-    path_25();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_26 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(193.896, 519.15);
-        ctx->bezierTo(193.896, 519.15, 181.184, 539.632, 217.909, 562.938);
-        ctx->bezierTo(217.909, 562.938, 220.381, 565.41, 188.599, 557.994);
-        ctx->bezierTo(188.599, 557.994, 177.652, 554.463, 174.827, 536.1);
-        ctx->bezierTo(174.827, 536.1, 166.352, 528.331, 157.877, 518.444);
-        ctx->bezierTo(149.402, 508.556, 193.896, 519.15, 193.896, 519.15);
-        ctx->closePath();
-    };
-    path_26();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_27 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(441.087, 435.105);
-        ctx->bezierTo(441.087, 435.105, 472.335, 482.46, 471.279, 490.9);
-        ctx->bezierTo(468.984, 509.262, 468.631, 526.213, 474.281, 533.275);
-        ctx->bezierTo(479.933, 540.338, 495.47, 598.957, 495.47, 598.957);
-        ctx->bezierTo(495.47, 598.957, 494.764, 601.076, 516.656, 533.982);
-        ctx->bezierTo(516.656, 533.982, 537.138, 505.731, 501.825, 473.243);
-        ctx->bezierTo(501.825, 473.243, 439.674, 422.393, 441.087, 435.105);
-        ctx->closePath();
-    };
-    path_27();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_28 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(229.209, 566.469);
-        ctx->bezierTo(229.209, 566.469, 248.984, 579.182, 223.559, 634.27);
-        ctx->lineTo(234.859, 630.033);
-        ctx->bezierTo(234.859, 630.033, 233.447, 649.808, 227.797, 654.045);
-        ctx->lineTo(240.509, 648.395);
-        ctx->bezierTo(240.509, 648.395, 248.984, 662.521, 241.922, 670.996);
-        ctx->bezierTo(241.922, 670.996, 271.585, 685.121, 270.172, 696.421);
-        ctx->bezierTo(270.172, 696.421, 281.472, 682.296, 274.41, 670.996);
-        ctx->bezierTo(267.347, 659.696, 254.634, 666.758, 256.047, 634.27);
-        ctx->lineTo(240.509, 639.92);
-        ctx->bezierTo(240.509, 639.92, 250.397, 624.383, 250.397, 613.082);
-        ctx->lineTo(236.272, 617.32);
-        ctx->bezierTo(236.272, 617.32, 263.584, 570.389, 244.747, 567.882);
-        ctx->bezierTo(234.153, 566.469, 229.209, 566.469, 229.209, 566.469);
-        ctx->closePath();
-    };
-    path_28();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_29 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(286.416, 596.132);
-        ctx->bezierTo(286.416, 596.132, 291.36, 588.363, 286.416, 589.776);
-        ctx->bezierTo(281.472, 591.188, 226.384, 617.32, 215.79, 634.27);
-        ctx->bezierTo(215.79, 634.27, 276.528, 591.188, 286.416, 596.132);
-        ctx->closePath();
-    };
-    path_29();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_30 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(304.779, 610.257);
-        ctx->bezierTo(304.779, 610.257, 309.723, 602.489, 304.779, 603.901);
-        ctx->bezierTo(299.835, 605.314, 244.747, 631.445, 234.153, 648.395);
-        ctx->bezierTo(234.153, 648.395, 294.891, 605.314, 304.779, 610.257);
-        ctx->closePath();
-    };
-    path_30();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_31 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(328.085, 583.42);
-        ctx->bezierTo(328.085, 583.42, 333.029, 575.651, 328.085, 577.063);
-        ctx->bezierTo(323.142, 578.476, 268.053, 604.607, 257.459, 621.558);
-        ctx->bezierTo(257.459, 621.558, 318.198, 578.476, 328.085, 583.42);
-        ctx->closePath();
-    };
-    path_31();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_32 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(287.122, 660.402);
-        ctx->bezierTo(287.122, 660.402, 287.122, 649.808, 282.179, 651.22);
-        ctx->bezierTo(277.235, 652.633, 213.671, 683.708, 203.078, 700.659);
-        ctx->bezierTo(203.078, 700.659, 277.235, 655.458, 287.122, 660.402);
-        ctx->closePath();
-    };
-    path_32();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_33 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(289.241, 641.333);
-        ctx->bezierTo(289.241, 641.333, 291.36, 632.858, 286.416, 634.27);
-        ctx->bezierTo(282.885, 634.27, 236.272, 654.752, 225.678, 671.702);
-        ctx->bezierTo(225.678, 671.702, 277.941, 633.564, 289.241, 641.333);
-        ctx->closePath();
-    };
-    path_33();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_34 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(263.816, 725.378);
-        ctx->lineTo(246.159, 738.797);
-        ctx->bezierTo(246.159, 738.797, 264.522, 725.378, 270.878, 727.496);
-        ctx->bezierTo(270.878, 727.496, 258.872, 747.272, 257.459, 756.453);
-        ctx->bezierTo(257.459, 756.453, 275.822, 733.853, 285.71, 734.559);
-        ctx->bezierTo(285.71, 734.559, 299.129, 735.265, 299.129, 754.334);
-        ctx->bezierTo(299.129, 754.334, 309.016, 735.971, 314.666, 736.678);
-        ctx->bezierTo(314.666, 736.678, 316.785, 747.978, 314.666, 759.984);
-        ctx->bezierTo(314.666, 759.984, 321.729, 746.565, 328.792, 749.39);
-        ctx->bezierTo(328.792, 749.39, 340.092, 745.859, 338.679, 766.341);
-        ctx->bezierTo(338.679, 766.341, 338.679, 784.703, 337.267, 789.647);
-        ctx->bezierTo(337.267, 789.647, 347.154, 743.034, 351.392, 742.328);
-        ctx->bezierTo(351.392, 742.328, 365.517, 740.209, 373.992, 755.747);
-        ctx->bezierTo(373.992, 755.747, 366.93, 742.328, 375.405, 745.859);
-        ctx->bezierTo(375.405, 745.859, 394.474, 748.684, 400.124, 760.691);
-        ctx->bezierTo(400.124, 760.691, 388.117, 739.503, 398.005, 745.153);
-        ctx->lineTo(412.13, 756.453);
-        ctx->bezierTo(412.13, 756.453, 426.962, 793.885, 430.493, 796.71);
-        ctx->bezierTo(430.493, 796.71, 417.074, 758.572, 419.899, 758.572);
-        ctx->bezierTo(419.899, 758.572, 416.368, 737.384, 425.549, 763.516);
-        ctx->bezierTo(425.549, 763.516, 419.899, 738.797, 429.787, 740.209);
-        ctx->bezierTo(439.674, 741.622, 447.443, 759.278, 462.274, 755.04);
-        ctx->bezierTo(462.274, 755.04, 479.226, 764.928, 482.758, 642.745);
-        ctx->lineTo(263.818, 725.378);
-        ctx->closePath();
-    };
-    path_34();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_35 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(272.291, 561.526);
-        ctx->bezierTo(272.291, 561.526, 298.422, 550.932, 369.048, 561.526);
-        ctx->bezierTo(369.048, 561.526, 381.761, 562.232, 393.767, 546.694);
-        ctx->bezierTo(405.774, 531.157, 453.093, 518.444, 464.393, 521.975);
-        ctx->lineTo(481.345, 533.275);
-        ctx->lineTo(482.758, 535.394);
-        ctx->bezierTo(482.758, 535.394, 504.65, 553.757, 505.356, 567.176);
-        ctx->bezierTo(506.062, 580.595, 479.933, 665.346, 462.981, 693.596);
-        ctx->bezierTo(446.03, 721.846, 429.08, 743.74, 395.18, 739.503);
-        ctx->bezierTo(395.18, 739.503, 358.454, 732.44, 313.254, 739.503);
-        ctx->bezierTo(313.254, 739.503, 261.697, 736.678, 256.753, 722.553);
-        ctx->bezierTo(251.809, 708.427, 276.528, 681.59, 276.528, 681.59);
-        ctx->bezierTo(276.528, 681.59, 284.297, 666.758, 282.179, 641.333);
-        ctx->bezierTo(280.06, 615.908, 280.766, 566.469, 272.291, 561.526);
-        ctx->closePath();
-    };
-    path_35();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_36 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(311.135, 565.057);
-        ctx->bezierTo(325.967, 597.545, 273.703, 712.665, 273.703, 712.665);
-        ctx->bezierTo(270.172, 715.49, 296.056, 726.172, 313.96, 721.846);
-        ctx->bezierTo(333.287, 717.185, 404.361, 724.671, 404.361, 724.671);
-        ctx->bezierTo(446.03, 697.127, 468.631, 618.733, 468.631, 618.733);
-        ctx->bezierTo(468.631, 618.733, 486.995, 576.357, 455.918, 570.707);
-        ctx->bezierTo(424.843, 565.057, 311.135, 565.057, 311.135, 565.057);
-        ctx->closePath();
-    };
-    path_36();
-    ctx->setFillStyle(229, 102, 140, 255);
-    ctx->fill();
-
-    auto path_37 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(307.549, 619.615);
-        ctx->bezierTo(313.422, 597.033, 316.218, 576.198, 311.135, 565.057);
-        ctx->bezierTo(311.135, 565.057, 421.311, 576.357, 441.087, 539.632);
-        ctx->bezierTo(448.575, 525.736, 474.636, 579.888, 473.928, 596.839);
-        ctx->bezierTo(473.928, 596.839, 362.692, 622.264, 336.56, 602.489);
-        ctx->lineTo(307.549, 619.615);
-        ctx->closePath();
-    };
-    path_37();
-    ctx->setFillStyle(178, 50, 89, 255);
-    ctx->fill();
-
-    auto path_38 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(315.373, 648.395);
-        ctx->bezierTo(315.373, 648.395, 318.904, 661.108, 314.666, 668.171);
-        ctx->bezierTo(314.666, 668.171, 311.841, 669.583, 309.723, 670.289);
-        ctx->bezierTo(309.723, 670.289, 311.841, 676.646, 322.435, 679.471);
-        ctx->bezierTo(322.435, 679.471, 325.967, 687.24, 330.204, 687.946);
-        ctx->bezierTo(334.442, 688.652, 342.917, 698.54, 349.979, 696.421);
-        ctx->bezierTo(357.042, 694.302, 376.817, 687.24, 376.817, 687.24);
-        ctx->bezierTo(376.817, 687.24, 386.705, 681.59, 402.242, 687.946);
-        ctx->bezierTo(402.242, 687.946, 406.436, 686.533, 407.186, 679.471);
-        ctx->bezierTo(408.069, 671.172, 413.543, 664.639, 417.074, 661.108);
-        ctx->bezierTo(420.605, 657.577, 437.555, 634.977, 435.437, 634.27);
-        ctx->bezierTo(433.318, 633.564, 315.373, 648.395, 315.373, 648.395);
-        ctx->closePath();
-    };
-    path_38();
-    ctx->setFillStyle(165, 38, 76, 255);
-    ctx->fill();
-
-    auto path_39 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(307.604, 562.938);
-        ctx->bezierTo(307.604, 562.938, 302.66, 602.489, 308.31, 617.32);
-        ctx->bezierTo(313.96, 632.151, 312.548, 635.683, 311.135, 642.745);
-        ctx->bezierTo(309.723, 649.808, 317.491, 667.464, 327.379, 678.058);
-        ctx->lineTo(348.567, 680.883);
-        ctx->bezierTo(348.567, 680.883, 375.405, 674.527, 391.649, 679.471);
-        ctx->bezierTo(391.649, 679.471, 407.529, 681.837, 413.543, 655.458);
-        ctx->bezierTo(413.543, 655.458, 422.018, 644.158, 434.73, 639.214);
-        ctx->bezierTo(447.443, 634.27, 460.156, 560.819, 453.093, 546.694);
-        ctx->bezierTo(446.03, 532.569, 420.605, 524.8, 392.355, 552.344);
-        ctx->bezierTo(364.105, 579.888, 360.573, 550.225, 307.604, 562.938);
-        ctx->closePath();
-    };
-    path_39();
-    ctx->setFillStyle(255, 114, 127, 255);
-    ctx->fill();
-    path_39();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_40 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(310.429, 695.008);
-        ctx->bezierTo(310.429, 695.008, 309.016, 691.477, 301.247, 690.771);
-        ctx->bezierTo(301.247, 690.771, 261.697, 684.415, 246.866, 662.521);
-        ctx->bezierTo(246.866, 662.521, 234.859, 652.633, 242.628, 673.114);
-        ctx->bezierTo(242.628, 673.114, 260.991, 709.134, 272.997, 714.077);
-        ctx->bezierTo(272.997, 714.077, 301.954, 721.14, 310.429, 695.008);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_40();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_40();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_41 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(451.578, 582.06);
-        ctx->bezierTo(452.742, 568.094, 456.19, 552.892, 453.093, 546.694);
-        ctx->bezierTo(441.712, 523.935, 411.743, 533.452, 392.355, 552.344);
-        ctx->bezierTo(364.105, 579.888, 360.573, 550.225, 307.604, 562.938);
-        ctx->bezierTo(307.604, 562.938, 304.523, 587.587, 306.006, 605.278);
-        ctx->bezierTo(306.006, 605.278, 371.873, 584.832, 373.286, 594.72);
-        ctx->bezierTo(373.286, 594.72, 376.111, 589.07, 392.355, 589.07);
-        ctx->bezierTo(408.599, 589.07, 448.753, 587.004, 451.578, 582.06);
-        ctx->closePath();
-    };
-    path_41();
-    ctx->setFillStyle(204, 63, 76, 255);
-    ctx->fill();
-
-    auto path_42 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(375.405, 564.351);
-        ctx->bezierTo(375.405, 564.351, 383.88, 572.826, 377.523, 589.776);
-        ctx->bezierTo(377.523, 589.776, 352.098, 618.026, 355.629, 642.745);
-    };
-    ctx->setLineWidth(3.531);
-    path_42();
-    ctx->setStrokeStyle(165, 25, 38, 255);
-    ctx->stroke();
-
-    auto path_43 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(290.654, 714.077);
-        ctx->bezierTo(290.654, 714.077, 282.885, 691.477, 298.422, 703.484);
-        ctx->lineTo(304.779, 709.84);
-        ctx->bezierTo(302.66, 712.665, 292.772, 719.728, 290.654, 714.077);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_43();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_43();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_44 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(299.552, 716.196);
-        ctx->bezierTo(299.552, 716.196, 293.337, 698.116, 305.768, 707.721);
-        ctx->lineTo(310.853, 712.806);
-        ctx->bezierTo(302.801, 715.066, 310.853, 719.586, 299.552, 716.196);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_44();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_44();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_45 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(308.028, 716.196);
-        ctx->bezierTo(308.028, 716.196, 301.813, 698.116, 314.243, 707.721);
-        ctx->lineTo(319.328, 712.806);
-        ctx->bezierTo(313.395, 715.066, 319.328, 719.586, 308.028, 716.196);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_45();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_45();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_46 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(319.681, 716.549);
-        ctx->bezierTo(319.681, 716.549, 313.466, 698.469, 325.896, 708.074);
-        ctx->bezierTo(325.896, 708.074, 333.635, 712.188, 330.983, 713.159);
-        ctx->bezierTo(325.755, 715.066, 330.983, 719.939, 319.681, 716.549);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_46();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_46();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_47 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(331.122, 716.408);
-        ctx->bezierTo(331.122, 716.408, 324.907, 698.328, 337.339, 707.933);
-        ctx->lineTo(342.424, 713.018);
-        ctx->bezierTo(340.729, 715.278, 342.424, 719.798, 331.122, 716.408);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_47();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_47();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_48 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(342.917, 717.609);
-        ctx->bezierTo(342.917, 717.609, 334.442, 695.715, 350.686, 707.015);
-        ctx->lineTo(357.042, 713.371);
-        ctx->bezierTo(354.923, 716.196, 357.042, 721.846, 342.917, 717.609);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_48();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_48();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_49 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(292.772, 687.24);
-        ctx->bezierTo(292.772, 687.24, 316.079, 682.296, 326.673, 687.946);
-        ctx->bezierTo(326.673, 687.946, 337.267, 690.065, 339.385, 689.358);
-        ctx->bezierTo(341.504, 688.652, 347.154, 687.946, 347.154, 687.946);
-    };
-    ctx->setLineWidth(3.531);
-    path_49();
-    ctx->setStrokeStyle(165, 38, 76, 255);
-    ctx->stroke();
-
-    auto path_50 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(352.804, 702.777);
-        ctx->bezierTo(352.804, 702.777, 373.992, 678.765, 395.18, 686.533);
-        ctx->bezierTo(407.568, 691.071, 405.774, 685.121, 407.186, 680.177);
-        ctx->bezierTo(408.599, 675.233, 408.952, 667.818, 417.78, 662.521);
-    };
-    ctx->setLineWidth(3.531);
-    path_50();
-    ctx->setStrokeStyle(165, 38, 76, 255);
-    ctx->stroke();
-
-    auto path_51 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(383.173, 674.527);
-        ctx->bezierTo(383.173, 674.527, 376.111, 655.458, 371.167, 678.058);
-        ctx->bezierTo(366.223, 700.659, 360.573, 707.015, 357.748, 711.959);
-        ctx->bezierTo(357.748, 711.959, 357.748, 721.14, 372.58, 720.434);
-        ctx->bezierTo(372.58, 720.434, 391.649, 719.728, 392.355, 714.784);
-        ctx->bezierTo(393.061, 709.84, 390.236, 689.358, 383.173, 674.527);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_51();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_51();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_52 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(407.893, 687.24);
-        ctx->bezierTo(407.893, 687.24, 414.249, 683.002, 418.486, 685.121);
-    };
-    ctx->setLineWidth(3.531);
-    path_52();
-    ctx->setStrokeStyle(165, 38, 76, 255);
-    ctx->stroke();
-
-    auto path_53 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(419.369, 658.283);
-        ctx->bezierTo(419.369, 658.283, 424.49, 649.631, 432.965, 648.219);
-    };
-    ctx->setLineWidth(3.531);
-    path_53();
-    ctx->setStrokeStyle(165, 38, 76, 255);
-    ctx->stroke();
-
-    auto path_54 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(279.353, 723.259);
-        ctx->bezierTo(279.353, 723.259, 311.135, 728.909, 318.904, 726.084);
-        ctx->lineTo(319.61, 729.615);
-        ctx->lineTo(282.885, 727.496);
-        ctx->bezierTo(282.885, 727.496, 262.403, 717.609, 279.353, 723.259);
-        ctx->closePath();
-    };
-    path_54();
-    ctx->setFillStyle(178, 178, 178, 255);
-    ctx->fill();
-
-    auto path_55 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(304.073, 558.701);
-        ctx->lineTo(338.679, 560.113);
-        ctx->bezierTo(338.679, 560.113, 351.392, 614.495, 345.036, 627.914);
-        ctx->bezierTo(345.036, 627.914, 342.917, 632.858, 337.973, 622.97);
-        ctx->bezierTo(337.973, 622.97, 305.485, 565.057, 299.835, 561.526);
-        ctx->bezierTo(294.185, 557.994, 301.954, 558.701, 304.073, 558.701);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_55();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_55();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_56 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(167.941, 553.933);
-        ctx->bezierTo(167.941, 553.933, 183.655, 556.935, 205.903, 561.526);
-        ctx->bezierTo(205.903, 561.526, 214.378, 601.076, 220.028, 609.551);
-        ctx->bezierTo(225.678, 618.026, 219.322, 618.026, 212.965, 613.082);
-        ctx->bezierTo(206.609, 608.139, 180.477, 583.42, 176.946, 575.651);
-        ctx->bezierTo(173.415, 567.882, 167.941, 553.933, 167.941, 553.933);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_56();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_56();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_57 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(206.54, 561.914);
-        ctx->bezierTo(206.54, 561.914, 216.781, 564.651, 218.562, 568.553);
-        ctx->bezierTo(220.342, 572.473, 216.44, 578.282, 216.44, 578.282);
-        ctx->bezierTo(216.44, 578.282, 214.674, 584.126, 212.552, 580.312);
-        ctx->bezierTo(210.43, 576.481, 205.359, 562.956, 206.54, 561.914);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_57();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_57();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_58 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(206.609, 561.526);
-        ctx->bezierTo(206.609, 561.526, 212.965, 570.707, 219.322, 570.707);
-        ctx->bezierTo(225.678, 570.707, 226.352, 569.983, 231.328, 571.06);
-        ctx->bezierTo(239.45, 572.826, 238.744, 569.294, 250.397, 571.413);
-        ctx->bezierTo(255.058, 572.261, 259.578, 570.707, 264.522, 572.826);
-        ctx->bezierTo(269.466, 574.945, 275.116, 573.532, 277.235, 570.001);
-        ctx->bezierTo(279.353, 566.469, 287.829, 559.054, 287.829, 559.054);
-        ctx->bezierTo(287.829, 559.054, 265.228, 562.232, 260.285, 563.644);
-        ctx->bezierTo(260.285, 563.644, 220.734, 565.763, 206.609, 561.526);
-        ctx->closePath();
-    };
-    path_58();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_59 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(285.357, 561.879);
-        ctx->bezierTo(285.357, 561.879, 273.968, 568.059, 273.262, 572.296);
-        ctx->bezierTo(272.556, 576.534, 282.532, 583.067, 282.532, 583.067);
-        ctx->bezierTo(282.532, 583.067, 287.387, 591.188, 288.447, 586.951);
-        ctx->bezierTo(289.506, 582.713, 286.769, 562.585, 285.357, 561.879);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_59();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_59();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_60 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(219.171, 571.519);
-        ctx->bezierTo(219.171, 571.519, 231.543, 591.277, 231.926, 571.484);
-        ctx->bezierTo(231.926, 571.484, 232.91, 569.259, 229.802, 569.224);
-        ctx->bezierTo(219.076, 569.1, 221.762, 561.843, 219.171, 571.519);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_60();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_60();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_61 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(231.845, 571.961);
-        ctx->bezierTo(231.845, 571.961, 245.831, 591.718, 244.708, 571.802);
-        ctx->bezierTo(244.708, 571.802, 244.72, 571.219, 241.625, 570.954);
-        ctx->bezierTo(233.244, 570.213, 233.853, 562.232, 231.845, 571.961);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_61();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_61();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_62 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(244.581, 571.978);
-        ctx->bezierTo(244.581, 571.978, 258.635, 590.747, 257.454, 573.673);
-        ctx->bezierTo(257.454, 573.673, 257.664, 571.502, 254.744, 570.972);
-        ctx->bezierTo(247.872, 569.718, 247.499, 563.998, 244.581, 571.978);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_62();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_62();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_63 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(256.721, 572.119);
-        ctx->bezierTo(256.721, 572.119, 270.67, 592.53, 271.284, 575.262);
-        ctx->bezierTo(271.284, 575.262, 274.187, 572.826, 271.104, 572.437);
-        ctx->bezierTo(260.832, 571.131, 262.241, 563.274, 256.721, 572.119);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.883);
-    path_63();
-    ctx->setFillStyle(255, 255, 204, 255);
-    ctx->fill();
-    path_63();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_64 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(192.851, 578.352);
-        ctx->lineTo(179.33, 575.651);
-        ctx->bezierTo(174.739, 566.823, 171.031, 555.964, 171.031, 555.964);
-        ctx->bezierTo(171.031, 555.964, 182.243, 557.729, 204.314, 562.673);
-        ctx->bezierTo(204.314, 562.673, 205.86, 568.535, 208.459, 578.758);
-        ctx->lineTo(192.851, 578.352);
-        ctx->closePath();
-    };
-    path_64();
-    ctx->setFillStyle(229, 229, 178, 255);
-    ctx->fill();
-
-    auto path_65 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(307.738, 570.124);
-        ctx->bezierTo(304.796, 565.693, 302.471, 562.603, 301.323, 561.879);
-        ctx->bezierTo(296.004, 558.559, 303.319, 559.213, 305.312, 559.213);
-        ctx->lineTo(337.895, 560.555);
-        ctx->bezierTo(337.895, 560.555, 338.82, 564.51, 340.028, 570.495);
-        ctx->bezierTo(340.028, 570.495, 322.216, 566.946, 307.738, 570.124);
-        ctx->closePath();
-    };
-    path_65();
-    ctx->setFillStyle(229, 229, 178, 255);
-    ctx->fill();
-
-    auto path_66 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(402.384, 326.202);
-        ctx->bezierTo(451.329, 333.194, 496.388, 270.266, 499.496, 253.173);
-        ctx->bezierTo(502.602, 236.082, 484.735, 215.106, 484.735, 215.106);
-        ctx->bezierTo(487.066, 209.668, 478.52, 184.807, 469.198, 168.493);
-        ctx->bezierTo(459.875, 152.178, 431.799, 153.898, 400.83, 152.178);
-        ctx->bezierTo(372.862, 150.624, 340.233, 191.799, 337.902, 194.907);
-        ctx->bezierTo(335.572, 198.014, 346.448, 265.605, 348.779, 275.705);
-        ctx->bezierTo(351.109, 285.804, 346.448, 332.417, 346.448, 332.417);
-        ctx->bezierTo(406.904, 316.35, 353.44, 319.21, 402.384, 326.202);
-        ctx->closePath();
-    };
-    path_66();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_67 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(339.188, 196.051);
-        ctx->bezierTo(336.899, 199.102, 347.578, 265.464, 349.866, 275.38);
-        ctx->bezierTo(352.155, 285.296, 347.578, 331.061, 347.578, 331.061);
-        ctx->bezierTo(405.265, 315.382, 354.443, 318.094, 402.497, 324.959);
-        ctx->bezierTo(450.552, 331.824, 494.792, 270.04, 497.843, 253.258);
-        ctx->bezierTo(500.894, 236.477, 483.351, 215.883, 483.351, 215.883);
-        ctx->bezierTo(485.639, 210.543, 477.249, 186.135, 468.096, 170.117);
-        ctx->bezierTo(458.943, 154.099, 431.379, 155.789, 400.971, 154.099);
-        ctx->bezierTo(373.512, 152.574, 341.476, 193, 339.188, 196.051);
-        ctx->closePath();
-    };
-    path_67();
-    ctx->setFillStyle(234, 142, 81, 255);
-    ctx->fill();
-
-    auto path_68 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(340.473, 197.195);
-        ctx->bezierTo(338.227, 200.19, 348.708, 265.323, 350.954, 275.055);
-        ctx->bezierTo(353.2, 284.787, 348.708, 329.705, 348.708, 329.705);
-        ctx->bezierTo(404.156, 313.532, 355.446, 316.978, 402.61, 323.716);
-        ctx->bezierTo(449.775, 330.454, 493.196, 269.814, 496.191, 253.343);
-        ctx->bezierTo(499.185, 236.873, 481.967, 216.66, 481.967, 216.66);
-        ctx->bezierTo(484.213, 211.419, 475.978, 187.463, 466.994, 171.742);
-        ctx->bezierTo(458.01, 156.02, 430.957, 157.678, 401.112, 156.02);
-        ctx->bezierTo(374.162, 154.523, 342.719, 194.201, 340.473, 197.195);
-        ctx->closePath();
-    };
-    path_68();
-    ctx->setFillStyle(239, 170, 124, 255);
-    ctx->fill();
-
-    auto path_69 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(341.758, 198.339);
-        ctx->bezierTo(339.555, 201.277, 349.838, 265.181, 352.042, 274.73);
-        ctx->bezierTo(354.245, 284.279, 349.838, 328.349, 349.838, 328.349);
-        ctx->bezierTo(401.812, 312.388, 356.449, 315.862, 402.723, 322.473);
-        ctx->bezierTo(448.999, 329.084, 491.6, 269.588, 494.538, 253.429);
-        ctx->bezierTo(497.476, 237.268, 480.582, 217.436, 480.582, 217.436);
-        ctx->bezierTo(482.786, 212.295, 474.706, 188.791, 465.892, 173.366);
-        ctx->bezierTo(457.078, 157.941, 430.535, 159.567, 401.254, 157.941);
-        ctx->bezierTo(374.811, 156.472, 343.962, 195.401, 341.758, 198.339);
-        ctx->closePath();
-    };
-    path_69();
-    ctx->setFillStyle(244, 198, 168, 255);
-    ctx->fill();
-
-    auto path_70 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(343.044, 199.483);
-        ctx->bezierTo(340.883, 202.365, 350.968, 265.04, 353.129, 274.405);
-        ctx->bezierTo(355.29, 283.77, 350.968, 326.993, 350.968, 326.993);
-        ctx->bezierTo(400.173, 311.243, 357.452, 314.747, 402.836, 321.23);
-        ctx->bezierTo(448.222, 327.713, 490.004, 269.362, 492.885, 253.512);
-        ctx->bezierTo(495.767, 237.664, 479.198, 218.213, 479.198, 218.213);
-        ctx->bezierTo(481.359, 213.171, 473.435, 190.118, 464.79, 174.99);
-        ctx->bezierTo(456.146, 159.862, 430.113, 161.457, 401.395, 159.862);
-        ctx->bezierTo(375.461, 158.422, 345.205, 196.602, 343.044, 199.483);
-        ctx->closePath();
-    };
-    path_70();
-    ctx->setFillStyle(249, 226, 211, 255);
-    ctx->fill();
-
-    auto path_71 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(402.949, 319.985);
-        ctx->bezierTo(447.443, 326.342, 488.408, 269.135, 491.233, 253.597);
-        ctx->bezierTo(494.058, 238.059, 477.814, 218.99, 477.814, 218.99);
-        ctx->bezierTo(479.933, 214.046, 472.162, 191.446, 463.687, 176.615);
-        ctx->bezierTo(455.212, 161.783, 429.691, 163.348, 401.536, 161.783);
-        ctx->bezierTo(376.111, 160.371, 346.448, 197.802, 344.329, 200.628);
-        ctx->bezierTo(342.21, 203.453, 352.098, 264.897, 354.217, 274.078);
-        ctx->bezierTo(356.336, 283.26, 352.098, 325.635, 352.098, 325.635);
-        ctx->bezierTo(397.122, 310.451, 358.454, 313.629, 402.949, 319.985);
-        ctx->closePath();
-    };
-    path_71();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_72 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(484.876, 259.953);
-        ctx->bezierTo(484.876, 259.953, 435.79, 273.372, 415.308, 270.547);
-        ctx->bezierTo(415.308, 270.547, 387.411, 258.894, 371.873, 297.385);
-        ctx->bezierTo(371.873, 297.385, 365.517, 310.098, 361.986, 313.629);
-        ctx->bezierTo(358.454, 317.16, 484.876, 259.953, 484.876, 259.953);
-        ctx->closePath();
-    };
-    path_72();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_73 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(491.586, 256.069);
-        ctx->bezierTo(491.586, 256.069, 440.38, 277.61, 422.724, 276.903);
-        ctx->bezierTo(422.724, 276.903, 393.767, 268.781, 378.936, 294.56);
-        ctx->bezierTo(378.936, 294.56, 364.105, 310.804, 358.454, 313.629);
-        ctx->bezierTo(358.454, 313.629, 357.748, 316.454, 369.048, 309.391);
-        ctx->lineTo(387.411, 318.573);
-        ctx->bezierTo(387.411, 318.573, 413.543, 335.523, 430.493, 307.273);
-        ctx->bezierTo(430.493, 307.273, 437.555, 287.497, 437.555, 283.966);
-        ctx->bezierTo(437.555, 280.435, 474.987, 270.547, 477.814, 269.841);
-        ctx->bezierTo(480.639, 269.135, 492.292, 261.719, 491.586, 256.069);
-        ctx->closePath();
-    };
-    path_73();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_74 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(407.893, 319.48);
-        ctx->bezierTo(395.759, 319.48, 380.975, 312.656, 380.975, 301.622);
-        ctx->bezierTo(380.975, 290.591, 395.759, 279.529, 407.893, 279.529);
-        ctx->bezierTo(420.03, 279.529, 429.868, 288.472, 429.868, 299.504);
-        ctx->bezierTo(429.868, 310.537, 420.03, 319.48, 407.893, 319.48);
-        ctx->closePath();
-    };
-    path_74();
-    ctx->setFillStyle(153, 204, 50, 255);
-    ctx->fill();
-
-    auto path_75 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(401.496, 290.022);
-        ctx->bezierTo(392.939, 291.297, 383.954, 293.951, 384.081, 293.569);
-        ctx->bezierTo(386.8, 285.414, 398.031, 279.529, 407.893, 279.529);
-        ctx->bezierTo(415.478, 279.529, 422.166, 283.021, 426.114, 288.336);
-        ctx->bezierTo(426.114, 288.336, 416.728, 287.753, 401.496, 290.022);
-        ctx->closePath();
-    };
-    path_75();
-    ctx->setFillStyle(101, 153, 0, 255);
-    ctx->fill();
-
-    auto path_76 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(422.724, 289.616);
-        ctx->bezierTo(422.724, 289.616, 414.955, 283.966, 414.955, 287.85);
-        ctx->bezierTo(414.955, 287.85, 421.311, 295.619, 422.724, 289.616);
-        ctx->closePath();
-    };
-    path_76();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_77 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(405.068, 303.964);
-        ctx->bezierTo(400.655, 303.964, 397.078, 300.387, 397.078, 295.972);
-        ctx->bezierTo(397.078, 291.56, 400.655, 287.983, 405.068, 287.983);
-        ctx->bezierTo(409.482, 287.983, 413.059, 291.56, 413.059, 295.972);
-        ctx->bezierTo(413.059, 300.387, 409.482, 303.964, 405.068, 303.964);
-        ctx->closePath();
-    };
-    path_77();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_78 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(221.44, 280.435);
-        ctx->bezierTo(221.44, 280.435, 215.79, 243.003, 220.028, 235.234);
-        ctx->bezierTo(220.028, 235.234, 239.097, 217.578, 238.39, 211.221);
-        ctx->bezierTo(238.39, 211.221, 237.684, 179.44, 235.565, 178.027);
-        ctx->bezierTo(233.447, 176.615, 220.028, 166.021, 209.434, 177.321);
-        ctx->bezierTo(209.434, 177.321, 191.071, 209.103, 192.484, 220.403);
-        ctx->lineTo(192.484, 223.934);
-        ctx->bezierTo(192.484, 223.934, 179.065, 223.228, 176.24, 226.759);
-        ctx->bezierTo(176.24, 226.759, 174.121, 235.94, 172.002, 236.647);
-        ctx->bezierTo(172.002, 236.647, 167.058, 240.884, 170.59, 245.828);
-        ctx->bezierTo(170.59, 245.828, 167.058, 250.066, 167.765, 257.128);
-        ctx->lineTo(181.184, 264.191);
-        ctx->bezierTo(181.184, 264.191, 184.715, 289.616, 203.784, 298.797);
-        ctx->bezierTo(212.322, 302.91, 217.909, 291.029, 221.44, 280.435);
-        ctx->closePath();
-    };
-    path_78();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_79 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(219.675, 277.186);
-        ctx->bezierTo(219.675, 277.186, 214.59, 243.497, 218.403, 236.505);
-        ctx->bezierTo(218.403, 236.505, 235.565, 220.615, 234.93, 214.894);
-        ctx->bezierTo(234.93, 214.894, 234.294, 186.29, 232.387, 185.019);
-        ctx->bezierTo(230.48, 183.748, 218.403, 174.213, 208.869, 184.384);
-        ctx->bezierTo(208.869, 184.384, 192.342, 212.987, 193.614, 223.157);
-        ctx->lineTo(193.614, 226.335);
-        ctx->bezierTo(193.614, 226.335, 181.537, 225.7, 178.994, 228.878);
-        ctx->bezierTo(178.994, 228.878, 177.087, 237.141, 175.18, 237.777);
-        ctx->bezierTo(175.18, 237.777, 170.731, 241.591, 173.909, 246.04);
-        ctx->bezierTo(173.909, 246.04, 170.731, 249.854, 171.367, 256.21);
-        ctx->lineTo(183.444, 262.566);
-        ctx->bezierTo(183.444, 262.566, 186.622, 285.449, 203.784, 293.712);
-        ctx->bezierTo(211.468, 297.411, 216.496, 286.72, 219.675, 277.186);
-        ctx->closePath();
-    };
-    path_79();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_80 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(234.771, 179.775);
-        ctx->bezierTo(232.846, 178.257, 219.622, 168.069, 209.293, 179.087);
-        ctx->bezierTo(209.293, 179.087, 191.389, 210.074, 192.766, 221.091);
-        ctx->lineTo(192.766, 224.534);
-        ctx->bezierTo(192.766, 224.534, 179.683, 223.846, 176.928, 227.289);
-        ctx->bezierTo(176.928, 227.289, 174.863, 236.241, 172.797, 236.929);
-        ctx->bezierTo(172.797, 236.929, 167.977, 241.061, 171.42, 245.881);
-        ctx->bezierTo(171.42, 245.881, 167.977, 250.013, 168.665, 256.899);
-        ctx->lineTo(181.749, 263.785);
-        ctx->bezierTo(181.749, 263.785, 185.192, 288.574, 203.784, 297.526);
-        ctx->bezierTo(212.107, 301.534, 217.556, 289.952, 220.999, 279.623);
-        ctx->bezierTo(220.999, 279.623, 215.49, 243.127, 219.622, 235.552);
-        ctx->bezierTo(219.622, 235.552, 238.214, 218.337, 237.525, 212.14);
-        ctx->bezierTo(237.525, 212.14, 236.837, 181.152, 234.771, 179.775);
-        ctx->closePath();
-    };
-    path_80();
-    ctx->setFillStyle(235, 149, 92, 255);
-    ctx->fill();
-
-    auto path_81 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(233.976, 181.523);
-        ctx->bezierTo(232.246, 179.899, 219.216, 170.117, 209.151, 180.852);
-        ctx->bezierTo(209.151, 180.852, 191.707, 211.045, 193.049, 221.78);
-        ctx->lineTo(193.049, 225.135);
-        ctx->bezierTo(193.049, 225.135, 180.301, 224.464, 177.617, 227.818);
-        ctx->bezierTo(177.617, 227.818, 175.604, 236.541, 173.591, 237.212);
-        ctx->bezierTo(173.591, 237.212, 168.895, 241.237, 172.249, 245.934);
-        ctx->bezierTo(172.249, 245.934, 168.895, 249.96, 169.566, 256.669);
-        ctx->lineTo(182.314, 263.379);
-        ctx->bezierTo(182.314, 263.379, 185.668, 287.533, 203.784, 296.255);
-        ctx->bezierTo(211.895, 300.161, 217.203, 288.875, 220.557, 278.81);
-        ctx->bezierTo(220.557, 278.81, 215.19, 243.25, 219.216, 235.87);
-        ctx->bezierTo(219.216, 235.87, 237.331, 219.096, 236.66, 213.058);
-        ctx->bezierTo(236.66, 213.058, 235.989, 182.865, 233.976, 181.523);
-        ctx->closePath();
-    };
-    path_81();
-    ctx->setFillStyle(242, 184, 146, 255);
-    ctx->fill();
-
-    auto path_82 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(233.182, 183.271);
-        ctx->bezierTo(231.646, 181.541, 218.809, 172.165, 209.01, 182.618);
-        ctx->bezierTo(209.01, 182.618, 192.025, 212.016, 193.331, 222.469);
-        ctx->lineTo(193.331, 225.735);
-        ctx->bezierTo(193.331, 225.735, 180.919, 225.082, 178.306, 228.348);
-        ctx->bezierTo(178.306, 228.348, 176.346, 236.841, 174.386, 237.494);
-        ctx->bezierTo(174.386, 237.494, 169.813, 241.414, 173.079, 245.987);
-        ctx->bezierTo(173.079, 245.987, 169.813, 249.907, 170.466, 256.44);
-        ctx->lineTo(182.879, 262.972);
-        ctx->bezierTo(182.879, 262.972, 186.145, 286.491, 203.784, 294.984);
-        ctx->bezierTo(211.682, 298.787, 216.85, 287.797, 220.116, 277.998);
-        ctx->bezierTo(220.116, 277.998, 214.89, 243.374, 218.809, 236.188);
-        ctx->bezierTo(218.809, 236.188, 236.448, 219.855, 235.795, 213.976);
-        ctx->bezierTo(235.795, 213.976, 235.142, 184.578, 233.182, 183.271);
-        ctx->closePath();
-    };
-    path_82();
-    ctx->setFillStyle(248, 220, 200, 255);
-    ctx->fill();
-
-    auto path_83 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(219.675, 277.009);
-        ctx->bezierTo(219.675, 277.009, 214.59, 243.497, 218.403, 236.505);
-        ctx->bezierTo(218.403, 236.505, 235.565, 220.615, 234.93, 214.894);
-        ctx->bezierTo(234.93, 214.894, 234.294, 186.29, 232.387, 185.019);
-        ctx->bezierTo(231.045, 183.183, 218.403, 174.213, 208.869, 184.384);
-        ctx->bezierTo(208.869, 184.384, 192.342, 212.987, 193.614, 223.157);
-        ctx->lineTo(193.614, 226.335);
-        ctx->bezierTo(193.614, 226.335, 181.537, 225.7, 178.994, 228.878);
-        ctx->bezierTo(178.994, 228.878, 177.087, 237.141, 175.18, 237.777);
-        ctx->bezierTo(175.18, 237.777, 170.731, 241.591, 173.909, 246.04);
-        ctx->bezierTo(173.909, 246.04, 170.731, 249.854, 171.367, 256.21);
-        ctx->lineTo(183.444, 262.566);
-        ctx->bezierTo(183.444, 262.566, 186.622, 285.449, 203.784, 293.712);
-        ctx->bezierTo(211.468, 297.411, 216.496, 286.544, 219.675, 277.009);
-        ctx->closePath();
-    };
-    path_83();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_84 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(214.201, 265.956);
-        ctx->bezierTo(214.201, 265.956, 176.063, 247.947, 174.474, 246.534);
-        ctx->bezierTo(174.474, 246.534, 190.541, 261.013, 191.954, 261.013);
-        ctx->bezierTo(193.367, 261.013, 214.201, 265.956, 214.201, 265.956);
-        ctx->closePath();
-    };
-    path_84();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_85 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(184.009, 255.009);
-        ctx->bezierTo(184.009, 255.009, 216.496, 261.366, 216.496, 269.135);
-        ctx->bezierTo(216.496, 274.276, 216.067, 297.969, 206.609, 295.266);
-        ctx->bezierTo(191.777, 291.029, 198.134, 265.603, 184.009, 255.009);
-        ctx->closePath();
-    };
-    path_85();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_86 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(198.84, 261.719);
-        ctx->bezierTo(198.84, 261.719, 214.692, 264.321, 216.496, 269.135);
-        ctx->bezierTo(217.556, 271.96, 218.726, 286.629, 209.081, 288.557);
-        ctx->bezierTo(201.044, 290.165, 197.106, 272.119, 198.84, 261.719);
-        ctx->closePath();
-    };
-    path_86();
-    ctx->setFillStyle(153, 204, 50, 255);
-    ctx->fill();
-
-    auto path_87 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(350.677, 336.845);
-        ctx->bezierTo(349.799, 333.77, 352.114, 334.001, 355.276, 333.051);
-        ctx->bezierTo(358.808, 331.992, 380.348, 325.282, 381.761, 320.691);
-        ctx->bezierTo(383.173, 316.101, 406.48, 323.87, 406.48, 323.87);
-        ctx->bezierTo(409.658, 325.282, 417.427, 329.873, 417.427, 329.873);
-        ctx->bezierTo(425.902, 331.992, 437.555, 332.698, 437.555, 332.698);
-        ctx->bezierTo(441.793, 334.464, 447.796, 339.407, 447.796, 339.407);
-        ctx->bezierTo(473.575, 357.417, 495.47, 344.704, 495.47, 344.704);
-        ctx->bezierTo(530.782, 333.051, 520.188, 302.682, 520.188, 302.682);
-        ctx->bezierTo(514.891, 286.791, 520.541, 280.788, 520.541, 280.788);
-        ctx->bezierTo(520.894, 274.078, 533.607, 285.379, 533.607, 285.379);
-        ctx->bezierTo(538.197, 292.794, 539.61, 301.622, 539.61, 301.622);
-        ctx->bezierTo(553.735, 321.398, 547.732, 289.969, 547.732, 289.969);
-        ctx->bezierTo(548.085, 288.204, 543.141, 281.847, 543.141, 279.728);
-        ctx->bezierTo(543.141, 277.61, 539.963, 271.606, 539.963, 271.606);
-        ctx->bezierTo(534.666, 265.603, 538.903, 253.244, 538.903, 253.244);
-        ctx->bezierTo(542.082, 228.878, 538.197, 232.056, 538.197, 232.056);
-        ctx->bezierTo(536.078, 228.878, 519.835, 246.534, 519.835, 246.534);
-        ctx->bezierTo(515.95, 252.538, 505.356, 255.363, 505.356, 255.363);
-        ctx->bezierTo(500.414, 258.541, 494.411, 256.069, 494.411, 256.069);
-        ctx->bezierTo(489.82, 255.363, 479.933, 267.722, 479.933, 267.722);
-        ctx->bezierTo(484.876, 267.369, 489.114, 275.138, 493.352, 275.491);
-        ctx->bezierTo(497.589, 275.844, 500.767, 271.253, 503.591, 270.194);
-        ctx->bezierTo(506.416, 269.135, 511.359, 279.375, 511.359, 279.375);
-        ctx->bezierTo(512.066, 283.966, 502.178, 292.441, 502.178, 292.441);
-        ctx->bezierTo(501.472, 300.563, 498.649, 297.738, 498.649, 297.738);
-        ctx->bezierTo(493.352, 296.679, 491.233, 303.388, 489.467, 311.51);
-        ctx->bezierTo(487.702, 319.632, 480.286, 320.338, 480.286, 320.338);
-        ctx->bezierTo(477.461, 333.404, 475.34, 328.107, 475.34, 328.107);
-        ctx->bezierTo(474.987, 318.22, 464.393, 328.46, 464.393, 328.46);
-        ctx->bezierTo(462.274, 331.992, 454.152, 328.107, 454.152, 328.107);
-        ctx->bezierTo(442.146, 324.576, 446.384, 321.045, 446.384, 321.045);
-        ctx->bezierTo(449.562, 317.16, 469.337, 321.045, 469.337, 321.045);
-        ctx->bezierTo(473.221, 318.22, 459.096, 311.157, 459.096, 311.157);
-        ctx->bezierTo(458.037, 307.979, 459.803, 300.21, 459.803, 300.21);
-        ctx->bezierTo(461.921, 294.56, 473.928, 284.672, 473.928, 284.672);
-        ctx->bezierTo(490.527, 282.554, 485.583, 279.728, 485.583, 279.728);
-        ctx->bezierTo(474.636, 270.547, 464.393, 283.966, 464.393, 283.966);
-        ctx->bezierTo(460.509, 294.913, 429.787, 321.398, 429.787, 321.398);
-        ctx->bezierTo(421.311, 327.401, 425.902, 315.395, 418.84, 321.398);
-        ctx->bezierTo(411.777, 327.401, 375.405, 311.51, 375.405, 311.51);
-        ctx->bezierTo(354.99, 309.404, 350.166, 337.198, 343.936, 331.69);
-        ctx->bezierTo(343.936, 331.69, 353.502, 346.733, 350.677, 336.845);
-        ctx->closePath();
-    };
-    path_87();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_88 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(694.633, 43.132);
-        ctx->bezierTo(694.633, 43.132, 649.433, 57.257, 644.489, 90.451);
-        ctx->bezierTo(644.489, 90.451, 640.252, 130.708, 676.271, 161.783);
-        ctx->bezierTo(676.271, 161.783, 676.977, 173.083, 680.508, 178.733);
-        ctx->bezierTo(680.508, 178.733, 677.683, 187.209, 710.877, 173.79);
-        ctx->lineTo(758.903, 158.958);
-        ctx->bezierTo(758.903, 158.958, 770.203, 154.721, 779.385, 139.183);
-        ctx->bezierTo(788.566, 123.645, 815.404, 90.451, 809.047, 45.957);
-        ctx->bezierTo(809.047, 45.957, 811.166, 26.182, 800.572, 25.475);
-        ctx->bezierTo(800.572, 25.475, 785.741, 22.65, 773.028, 36.069);
-        ctx->bezierTo(773.028, 36.069, 761.022, 41.719, 756.784, 41.013);
-        ctx->lineTo(694.633, 43.132);
-        ctx->closePath();
-    };
-    path_88();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_89 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(791.073, 41.384);
-        ctx->bezierTo(791.073, 41.384, 794.781, 25.617, 786.235, 34.162);
-        ctx->bezierTo(786.235, 34.162, 773.805, 44.262, 760.598, 44.262);
-        ctx->bezierTo(760.598, 44.262, 734.961, 48.146, 727.192, 71.453);
-        ctx->bezierTo(727.192, 71.453, 720.2, 118.843, 734.184, 128.942);
-        ctx->bezierTo(734.184, 128.942, 742.73, 142.149, 755.16, 130.496);
-        ctx->bezierTo(767.59, 118.843, 794.958, 65.467, 791.073, 41.384);
-        ctx->closePath();
-    };
-    path_89();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_90 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(790.42, 42.02);
-        ctx->bezierTo(790.42, 42.02, 794.11, 26.57, 785.723, 34.975);
-        ctx->bezierTo(785.723, 34.975, 773.505, 44.88, 760.545, 44.88);
-        ctx->bezierTo(760.545, 44.88, 735.367, 48.694, 727.739, 71.576);
-        ctx->bezierTo(727.739, 71.576, 720.871, 118.108, 734.608, 128.024);
-        ctx->bezierTo(734.608, 128.024, 742.995, 140.991, 755.195, 129.55);
-        ctx->bezierTo(767.413, 118.108, 794.234, 65.662, 790.42, 42.02);
-        ctx->closePath();
-    };
-    path_90();
-    ctx->setFillStyle(50, 50, 50, 255);
-    ctx->fill();
-
-    auto path_91 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(789.749, 42.655);
-        ctx->bezierTo(789.749, 42.655, 793.421, 27.541, 785.193, 35.769);
-        ctx->bezierTo(785.193, 35.769, 773.222, 45.498, 760.492, 45.498);
-        ctx->bezierTo(760.492, 45.498, 735.773, 49.241, 728.287, 71.7);
-        ctx->bezierTo(728.287, 71.7, 721.56, 117.374, 735.031, 127.106);
-        ctx->bezierTo(735.031, 127.106, 743.259, 139.833, 755.248, 128.603);
-        ctx->bezierTo(767.219, 117.374, 793.492, 65.856, 789.749, 42.655);
-        ctx->closePath();
-    };
-    path_91();
-    ctx->setFillStyle(102, 102, 102, 255);
-    ctx->fill();
-
-    auto path_92 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(789.096, 43.273);
-        ctx->bezierTo(789.096, 43.273, 792.75, 28.495, 784.664, 36.581);
-        ctx->bezierTo(784.664, 36.581, 772.922, 46.133, 760.421, 46.133);
-        ctx->bezierTo(760.421, 46.133, 736.197, 49.806, 728.852, 71.841);
-        ctx->bezierTo(728.852, 71.841, 722.231, 116.639, 735.455, 126.188);
-        ctx->bezierTo(735.455, 126.188, 743.542, 138.675, 755.283, 127.657);
-        ctx->bezierTo(767.043, 116.639, 792.768, 66.05, 789.096, 43.273);
-        ctx->closePath();
-    };
-    path_92();
-    ctx->setFillStyle(153, 153, 153, 255);
-    ctx->fill();
-
-    auto path_93 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(788.442, 43.909);
-        ctx->bezierTo(788.442, 43.909, 792.08, 29.466, 784.152, 37.376);
-        ctx->bezierTo(784.152, 37.376, 772.622, 46.751, 760.369, 46.751);
-        ctx->bezierTo(760.369, 46.751, 736.603, 50.353, 729.399, 71.965);
-        ctx->bezierTo(729.399, 71.965, 722.919, 115.905, 735.879, 125.27);
-        ctx->bezierTo(735.879, 125.27, 743.807, 137.516, 755.336, 126.71);
-        ctx->bezierTo(766.848, 115.905, 792.044, 66.244, 788.442, 43.909);
-        ctx->closePath();
-    };
-    path_93();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_94 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(787.771, 44.544);
-        ctx->bezierTo(787.771, 44.544, 791.391, 30.419, 783.622, 38.188);
-        ctx->bezierTo(783.622, 38.188, 772.322, 47.369, 760.316, 47.369);
-        ctx->bezierTo(760.316, 47.369, 737.009, 50.901, 729.946, 72.088);
-        ctx->bezierTo(729.946, 72.088, 723.59, 115.17, 736.303, 124.352);
-        ctx->bezierTo(736.303, 124.352, 744.072, 136.358, 755.372, 125.764);
-        ctx->bezierTo(766.672, 115.17, 791.303, 66.438, 787.771, 44.544);
-        ctx->closePath();
-    };
-    path_94();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_95 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(414.249, 403.324);
-        ctx->bezierTo(414.249, 403.324, 378.23, 369.423, 364.105, 368.011);
-        ctx->bezierTo(364.105, 368.011, 303.366, 360.948, 277.235, 392.73);
-        ctx->bezierTo(277.235, 392.73, 308.31, 356.711, 357.042, 366.598);
-        ctx->bezierTo(357.042, 366.598, 318.904, 358.829, 297.01, 364.479);
-        ctx->lineTo(250.397, 389.199);
-        ctx->lineTo(245.453, 397.674);
-        ctx->bezierTo(245.453, 397.674, 252.516, 371.542, 285.004, 360.948);
-        ctx->bezierTo(285.004, 360.948, 325.26, 352.473, 344.329, 360.948);
-        ctx->bezierTo(344.329, 360.948, 306.191, 348.942, 288.535, 352.473);
-        ctx->bezierTo(288.535, 352.473, 234.859, 348.236, 212.259, 394.849);
-        ctx->bezierTo(212.259, 394.849, 219.322, 369.423, 245.453, 356.711);
-        ctx->bezierTo(245.453, 356.711, 269.466, 341.173, 305.485, 346.117);
-        ctx->bezierTo(305.485, 346.117, 330.91, 351.767, 340.092, 356.004);
-        ctx->bezierTo(349.273, 360.242, 347.154, 355.298, 332.323, 346.823);
-        ctx->bezierTo(332.323, 346.823, 322.435, 329.167, 297.716, 329.873);
-        ctx->bezierTo(297.716, 329.873, 222.147, 336.229, 203.784, 357.417);
-        ctx->bezierTo(203.784, 357.417, 227.797, 337.642, 246.159, 332.698);
-        ctx->bezierTo(246.159, 332.698, 285.71, 318.573, 300.541, 319.985);
-        ctx->bezierTo(300.541, 319.985, 344.329, 321.751, 357.748, 314.688);
-        ctx->bezierTo(357.748, 314.688, 337.973, 323.516, 343.623, 329.167);
-        ctx->bezierTo(349.273, 334.817, 361.279, 348.236, 361.279, 350.354);
-        ctx->bezierTo(361.279, 352.473, 404.008, 391.494, 410.364, 399.263);
-        ctx->lineTo(414.249, 403.324);
-        ctx->closePath();
-    };
-    path_95();
-    ctx->setFillStyle(153, 38, 0, 255);
-    ctx->fill();
-
-    auto path_96 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(658.614, 745.859);
-        ctx->bezierTo(658.614, 745.859, 631.247, 681.413, 609.176, 664.639);
-        ctx->bezierTo(609.176, 664.639, 655.083, 692.89, 661.263, 724.671);
-        ctx->bezierTo(661.263, 724.671, 661.263, 742.328, 658.614, 745.859);
-        ctx->closePath();
-    };
-    path_96();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_97 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(741.6, 759.101);
-        ctx->bezierTo(741.6, 759.101, 694.81, 661.991, 662.146, 619.615);
-        ctx->bezierTo(662.146, 619.615, 738.951, 685.827, 747.779, 732.617);
-        ctx->lineTo(748.662, 742.328);
-        ctx->lineTo(743.365, 737.914);
-        ctx->bezierTo(743.365, 737.914, 742.483, 753.804, 741.6, 759.101);
-        ctx->closePath();
-    };
-    path_97();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_98 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(841.359, 673.468);
-        ctx->bezierTo(841.359, 673.468, 731.006, 568.412, 728.357, 563.998);
-        ctx->bezierTo(728.357, 563.998, 835.179, 680.53, 840.476, 693.773);
-        ctx->bezierTo(840.476, 693.773, 836.945, 677.882, 841.359, 673.468);
-        ctx->closePath();
-    };
-    path_98();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_99 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(508.534, 750.273);
-        ctx->bezierTo(508.534, 750.273, 542.964, 658.46, 576.512, 698.187);
-        ctx->bezierTo(576.512, 698.187, 602.996, 715.843, 602.114, 721.14);
-        ctx->bezierTo(602.114, 721.14, 595.051, 709.663, 563.269, 710.546);
-        ctx->bezierTo(563.269, 710.546, 529.722, 705.249, 508.534, 750.273);
-        ctx->closePath();
-    };
-    path_99();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_100 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(844.89, 525.153);
-        ctx->bezierTo(844.89, 525.153, 765.436, 474.832, 752.194, 472.184);
-        ctx->bezierTo(731.341, 468.017, 839.593, 523.388, 848.421, 541.927);
-        ctx->bezierTo(848.421, 541.927, 851.953, 537.513, 844.89, 525.153);
-        ctx->closePath();
-    };
-    path_100();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_101 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(578.807, 713.371);
-        ctx->bezierTo(578.807, 713.371, 614.826, 709.84, 626.833, 697.834);
-        ctx->lineTo(634.602, 704.19);
-        ctx->lineTo(665.677, 636.389);
-        ctx->lineTo(672.033, 645.57);
-        ctx->bezierTo(672.033, 645.57, 697.459, 619.439, 696.046, 605.314);
-        ctx->bezierTo(694.633, 591.188, 718.646, 615.908, 718.646, 615.908);
-        ctx->bezierTo(718.646, 615.908, 717.234, 595.426, 729.946, 607.432);
-        ctx->bezierTo(729.946, 607.432, 725.709, 579.888, 740.54, 594.014);
-        ctx->bezierTo(740.54, 594.014, 721.93, 540.762, 761.728, 586.245);
-        ctx->bezierTo(771.616, 597.545, 763.847, 585.538, 763.847, 585.538);
-        ctx->bezierTo(763.847, 585.538, 717.94, 500.787, 756.078, 526.213);
-        ctx->bezierTo(756.078, 526.213, 759.609, 485.956, 757.491, 478.187);
-        ctx->bezierTo(755.372, 470.418, 751.84, 430.868, 743.365, 421.686);
-        ctx->bezierTo(734.89, 412.505, 744.072, 409.68, 753.959, 418.861);
-        ctx->bezierTo(753.959, 418.861, 734.184, 376.486, 757.491, 397.674);
-        ctx->bezierTo(757.491, 397.674, 751.134, 370.836, 743.365, 365.892);
-        ctx->bezierTo(743.365, 365.892, 733.478, 335.523, 760.316, 354.592);
-        ctx->bezierTo(760.316, 354.592, 752.547, 332.698, 746.897, 327.048);
-        ctx->bezierTo(746.897, 327.048, 726.415, 278.316, 739.128, 286.791);
-        ctx->lineTo(746.897, 293.147);
-        ctx->bezierTo(746.897, 293.147, 734.89, 268.428, 746.19, 276.197);
-        ctx->bezierTo(757.491, 283.966, 757.491, 283.26, 757.491, 283.26);
-        ctx->bezierTo(757.491, 283.26, 720.059, 224.64, 756.078, 255.716);
-        ctx->bezierTo(756.078, 255.716, 741.67, 231.141, 735.596, 218.99);
-        ctx->bezierTo(735.596, 218.99, 702.402, 182.971, 727.828, 194.271);
-        ctx->lineTo(736.303, 197.096);
-        ctx->bezierTo(736.303, 197.096, 720.765, 179.44, 706.64, 176.615);
-        ctx->bezierTo(692.515, 173.79, 710.877, 162.49, 722.178, 166.021);
-        ctx->bezierTo(733.478, 169.552, 761.022, 182.971, 761.022, 182.971);
-        ctx->bezierTo(761.022, 182.971, 783.622, 216.165, 790.685, 216.871);
-        ctx->bezierTo(790.685, 216.871, 755.372, 203.453, 765.966, 217.578);
-        ctx->bezierTo(765.966, 217.578, 791.391, 242.297, 778.678, 241.591);
-        ctx->bezierTo(778.678, 241.591, 768.084, 254.303, 776.559, 269.841);
-        ctx->bezierTo(776.559, 269.841, 743.966, 237.369, 770.203, 282.554);
-        ctx->lineTo(782.21, 311.51);
-        ctx->bezierTo(782.21, 311.51, 739.128, 267.722, 758.903, 306.566);
-        ctx->bezierTo(758.903, 306.566, 789.272, 348.236, 792.803, 348.942);
-        ctx->bezierTo(796.335, 349.648, 804.104, 365.186, 804.104, 365.186);
-        ctx->lineTo(796.335, 361.654);
-        ctx->lineTo(805.516, 377.192);
-        ctx->bezierTo(805.516, 377.192, 785.741, 356.004, 796.335, 379.311);
-        ctx->lineTo(806.222, 404.736);
-        ctx->bezierTo(806.222, 404.736, 770.203, 365.892, 794.216, 418.155);
-        ctx->bezierTo(794.216, 418.155, 765.259, 408.974, 780.797, 439.343);
-        ctx->bezierTo(780.797, 439.343, 777.972, 467.593, 778.678, 476.775);
-        ctx->bezierTo(779.385, 485.956, 781.503, 536.1, 773.734, 550.225);
-        ctx->bezierTo(765.966, 564.351, 784.328, 598.251, 787.86, 605.314);
-        ctx->bezierTo(791.391, 612.376, 797.747, 631.445, 782.21, 615.201);
-        ctx->bezierTo(766.672, 598.957, 774.441, 608.845, 777.972, 624.383);
-        ctx->bezierTo(781.503, 639.92, 792.097, 667.464, 790.685, 677.352);
-        ctx->bezierTo(790.685, 677.352, 788.566, 679.471, 782.916, 673.114);
-        ctx->bezierTo(782.916, 673.114, 756.784, 632.858, 759.609, 658.283);
-        ctx->bezierTo(759.609, 658.283, 757.491, 672.408, 751.84, 687.946);
-        ctx->bezierTo(751.84, 687.946, 746.19, 707.015, 746.19, 691.477);
-        ctx->bezierTo(746.19, 691.477, 740.54, 661.814, 735.596, 675.233);
-        ctx->bezierTo(730.653, 688.652, 724.296, 699.246, 719.353, 703.484);
-        ctx->bezierTo(714.409, 707.721, 705.227, 667.464, 703.109, 685.827);
-        ctx->bezierTo(703.109, 685.827, 681.921, 663.933, 673.446, 692.89);
-        ctx->lineTo(652.964, 721.846);
-        ctx->bezierTo(652.964, 721.846, 652.258, 699.952, 650.139, 710.546);
-        ctx->bezierTo(650.139, 710.546, 597.17, 721.14, 578.807, 713.371);
-        ctx->closePath();
-    };
-    path_101();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_102 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(518.069, 83.389);
-        ctx->bezierTo(518.069, 83.389, 497.589, 69.263, 490.527, 69.97);
-        ctx->bezierTo(483.464, 70.676, 539.257, 54.432, 612.001, 103.164);
-        ctx->bezierTo(612.001, 103.164, 620.476, 108.108, 626.833, 107.401);
-        ctx->bezierTo(626.833, 107.401, 632.483, 111.639, 627.539, 117.995);
-        ctx->bezierTo(627.539, 117.995, 612.001, 134.945, 631.776, 154.721);
-        ctx->bezierTo(631.776, 154.721, 664.264, 166.727, 654.377, 151.189);
-        ctx->bezierTo(654.377, 151.189, 673.446, 158.252, 677.683, 165.315);
-        ctx->bezierTo(681.921, 172.377, 679.802, 165.315, 679.802, 165.315);
-        ctx->lineTo(657.908, 143.421);
-        ctx->bezierTo(657.908, 143.421, 648.727, 139.889, 643.783, 125.058);
-        ctx->bezierTo(638.839, 110.226, 634.602, 92.57, 642.37, 86.92);
-        ctx->bezierTo(642.37, 86.92, 635.308, 94.689, 636.72, 87.626);
-        ctx->bezierTo(638.133, 80.564, 644.489, 74.207, 647.314, 73.501);
-        ctx->bezierTo(650.139, 72.795, 679.096, 44.898, 691.102, 44.191);
-        ctx->bezierTo(691.102, 44.191, 674.858, 46.663, 669.561, 44.898);
-        ctx->bezierTo(664.264, 43.132, 617.298, 23.003, 606.704, 20.885);
-        ctx->bezierTo(606.704, 20.885, 577.041, 9.231, 598.229, 12.763);
-        ctx->bezierTo(598.229, 12.763, 661.439, 19.472, 693.574, 42.779);
-        ctx->bezierTo(693.574, 42.779, 680.861, 27.947, 648.374, 15.588);
-        ctx->bezierTo(648.374, 15.588, 609.176, -6.659, 547.025, 2.169);
-        ctx->bezierTo(547.025, 2.169, 515.597, 7.819, 501.825, 10.997);
-        ctx->bezierTo(501.825, 10.997, 497.236, 9.938, 496.177, 9.231);
-        ctx->bezierTo(495.117, 8.525, 474.281, -7.366, 425.549, 4.994);
-        ctx->bezierTo(425.549, 4.994, 395.533, 13.116, 380.348, 21.591);
-        ctx->bezierTo(380.348, 21.591, 353.511, 23.71, 347.154, 29.36);
-        ctx->bezierTo(347.154, 29.36, 314.313, 55.138, 310.782, 56.551);
-        ctx->bezierTo(307.251, 57.963, 287.122, 71.382, 285.71, 72.088);
-        ctx->bezierTo(285.71, 72.088, 329.145, 60.435, 333.382, 56.198);
-        ctx->bezierTo(337.62, 51.96, 368.342, 47.369, 372.58, 49.841);
-        ctx->bezierTo(376.817, 52.313, 391.649, 51.254, 374.698, 52.313);
-        ctx->bezierTo(374.698, 52.313, 508.181, 78.445, 509.594, 81.976);
-        ctx->bezierTo(511.006, 85.507, 518.069, 83.389, 518.069, 83.389);
-        ctx->closePath();
-    };
-    path_102();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_103 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(644.136, 67.145);
-        ctx->bezierTo(644.136, 67.145, 626.126, 54.079, 622.595, 54.079);
-        ctx->bezierTo(619.064, 54.079, 597.17, 36.069, 589.754, 36.776);
-        ctx->bezierTo(582.338, 37.482, 560.798, 19.825, 512.419, 34.304);
-        ctx->bezierTo(512.419, 34.304, 511.359, 30.772, 517.716, 29.36);
-        ctx->bezierTo(517.716, 29.36, 529.016, 25.475, 529.722, 24.416);
-        ctx->bezierTo(529.722, 24.416, 565.388, 17, 578.101, 23.357);
-        ctx->bezierTo(578.101, 23.357, 594.345, 27.947, 605.292, 38.894);
-        ctx->bezierTo(605.292, 38.894, 625.067, 44.544, 630.717, 42.779);
-        ctx->bezierTo(630.717, 42.779, 646.255, 46.663, 646.961, 49.841);
-        ctx->bezierTo(646.961, 49.841, 657.202, 55.138, 654.024, 59.729);
-        ctx->bezierTo(654.024, 59.729, 654.73, 62.554, 644.136, 67.145);
-        ctx->closePath();
-    };
-    path_103();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_104 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(622.118, 63.419);
-        ctx->bezierTo(623.549, 64.531, 625.35, 64.708, 626.409, 66.138);
-        ctx->bezierTo(626.833, 66.686, 626.321, 67.268, 625.756, 67.445);
-        ctx->bezierTo(623.919, 67.992, 622.048, 66.986, 620.035, 68.027);
-        ctx->bezierTo(619.329, 68.398, 618.199, 68.08, 617.21, 67.816);
-        ctx->bezierTo(614.332, 67.039, 611.101, 66.986, 608.117, 68.204);
-        ctx->bezierTo(604.621, 66.209, 600.454, 67.251, 596.781, 65.467);
-        ctx->bezierTo(596.675, 65.432, 596.287, 66.032, 596.146, 65.997);
-        ctx->bezierTo(590.778, 63.966, 584.157, 64.461, 579.866, 60.435);
-        ctx->bezierTo(575.576, 59.711, 571.427, 58.899, 567.136, 57.698);
-        ctx->bezierTo(563.923, 56.798, 561.433, 55.05, 558.573, 53.584);
-        ctx->bezierTo(556.136, 52.331, 553.576, 51.413, 550.857, 50.742);
-        ctx->bezierTo(547.573, 49.947, 544.342, 50.141, 541.005, 49.223);
-        ctx->bezierTo(540.828, 49.188, 540.493, 49.788, 540.351, 49.753);
-        ctx->bezierTo(539.786, 49.559, 539.257, 48.535, 538.956, 48.623);
-        ctx->bezierTo(535.99, 49.541, 533.359, 47.828, 530.428, 48.429);
-        ctx->bezierTo(528.345, 46.275, 525.308, 46.698, 522.571, 45.922);
-        ctx->bezierTo(517.327, 44.421, 511.766, 46.663, 506.416, 44.898);
-        ctx->bezierTo(513.672, 41.649, 521.953, 43.82, 529.122, 40.166);
-        ctx->bezierTo(533.236, 38.082, 537.932, 40.024, 542.47, 38.682);
-        ctx->bezierTo(543.335, 38.418, 544.554, 38.064, 545.26, 39.247);
-        ctx->bezierTo(545.507, 39, 545.825, 38.594, 545.931, 38.629);
-        ctx->bezierTo(550.239, 40.678, 554.335, 42.92, 558.714, 44.809);
-        ctx->bezierTo(559.314, 45.074, 560.268, 44.65, 560.709, 45.021);
-        ctx->bezierTo(563.393, 47.158, 566.818, 46.981, 569.273, 49.135);
-        ctx->bezierTo(572.274, 48.252, 575.435, 48.923, 578.489, 47.811);
-        ctx->bezierTo(578.631, 47.776, 579.037, 48.376, 579.09, 48.341);
-        ctx->bezierTo(581.102, 47.016, 583.133, 47.493, 584.704, 48.023);
-        ctx->bezierTo(585.305, 48.235, 586.47, 48.676, 587.017, 48.8);
-        ctx->bezierTo(588.995, 49.276, 590.513, 50.124, 592.597, 50.459);
-        ctx->bezierTo(592.791, 50.495, 593.126, 49.894, 593.25, 49.93);
-        ctx->bezierTo(595.228, 50.706, 597.064, 50.618, 598.229, 52.666);
-        ctx->bezierTo(598.476, 52.419, 598.759, 52.013, 598.9, 52.048);
-        ctx->bezierTo(600.719, 52.649, 601.866, 53.991, 603.809, 54.414);
-        ctx->bezierTo(604.656, 54.591, 605.751, 55.703, 606.757, 56.021);
-        ctx->bezierTo(610.977, 57.31, 614.244, 60.011, 618.11, 61.583);
-        ctx->bezierTo(619.452, 62.13, 621.006, 62.554, 622.118, 63.419);
-        ctx->closePath();
-    };
-    path_104();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_105 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(486.81, 38.294);
-        ctx->bezierTo(482.364, 35.257, 478.183, 33.297, 473.871, 30.137);
-        ctx->bezierTo(473.552, 29.907, 472.916, 30.207, 472.559, 29.995);
-        ctx->bezierTo(470.781, 28.918, 469.213, 27.894, 467.48, 26.658);
-        ctx->bezierTo(466.528, 25.987, 465.078, 26.005, 464.181, 25.546);
-        ctx->bezierTo(459.69, 23.268, 455.048, 22.28, 450.621, 20.178);
-        ctx->bezierTo(451.825, 19.048, 453.806, 19.49, 454.859, 18.06);
-        ctx->bezierTo(455.203, 18.554, 455.623, 19.048, 456.247, 18.713);
-        ctx->bezierTo(459.209, 17.124, 462.476, 16.859, 465.435, 17.018);
-        ctx->bezierTo(468.444, 17.177, 471.481, 17.707, 474.615, 18.201);
-        ctx->bezierTo(475.157, 18.272, 475.508, 19.19, 476.078, 19.366);
-        ctx->bezierTo(480.012, 20.532, 484.23, 19.613, 487.972, 21.097);
-        ctx->bezierTo(490.781, 22.209, 493.553, 23.657, 495.741, 25.899);
-        ctx->bezierTo(496.185, 26.358, 495.612, 26.906, 495.117, 27.241);
-        ctx->bezierTo(495.802, 27.047, 496.284, 27.418, 496.48, 27.965);
-        ctx->bezierTo(496.629, 28.389, 496.629, 28.918, 496.48, 29.342);
-        ctx->bezierTo(496.283, 29.89, 495.79, 30.066, 495.13, 30.154);
-        ctx->bezierTo(492.645, 30.49, 495.774, 28.053, 494.538, 28.848);
-        ctx->bezierTo(492.29, 30.296, 493.608, 32.768, 492.292, 35.01);
-        ctx->bezierTo(491.798, 34.674, 491.392, 34.286, 491.586, 33.597);
-        ctx->bezierTo(491.999, 34.516, 490.936, 35.028, 490.64, 35.593);
-        ctx->bezierTo(489.96, 36.864, 488.372, 39.371, 486.81, 38.294);
-        ctx->closePath();
-    };
-    path_105();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_106 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(429.43, 51.271);
-        ctx->bezierTo(423.861, 49.877, 418.476, 50.071, 413.151, 47.811);
-        ctx->bezierTo(413.032, 47.776, 412.639, 48.376, 412.526, 48.341);
-        ctx->bezierTo(410.114, 47.281, 408.493, 45.586, 406.593, 43.732);
-        ctx->bezierTo(404.981, 42.161, 402.054, 42.849, 399.804, 41.984);
-        ctx->bezierTo(399.232, 41.772, 398.874, 40.872, 398.342, 40.801);
-        ctx->bezierTo(396.19, 40.519, 394.553, 38.841, 392.708, 37.835);
-        ctx->bezierTo(396.833, 36.422, 401.09, 36.493, 405.437, 35.804);
-        ctx->bezierTo(405.636, 35.769, 405.892, 36.352, 406.127, 36.352);
-        ctx->bezierTo(406.367, 36.352, 406.597, 35.946, 406.833, 35.716);
-        ctx->bezierTo(407.177, 36.211, 407.711, 36.793, 408.164, 36.334);
-        ctx->bezierTo(409.132, 35.381, 410.114, 35.716, 411.067, 35.787);
-        ctx->bezierTo(411.321, 35.804, 411.542, 36.352, 411.777, 36.352);
-        ctx->bezierTo(412.017, 36.352, 412.248, 35.787, 412.483, 35.787);
-        ctx->bezierTo(412.723, 35.787, 412.955, 36.352, 413.189, 36.352);
-        ctx->bezierTo(413.43, 36.352, 413.659, 35.946, 413.896, 35.716);
-        ctx->bezierTo(415.118, 37.093, 416.68, 36.122, 418.132, 36.44);
-        ctx->bezierTo(419.964, 36.829, 420.436, 38.859, 422.332, 39.389);
-        ctx->bezierTo(430.657, 41.684, 437.961, 45.48, 445.665, 49.17);
-        ctx->bezierTo(446.207, 49.418, 446.578, 49.859, 446.384, 50.548);
-        ctx->bezierTo(446.855, 50.548, 447.408, 50.389, 447.743, 50.618);
-        ctx->bezierTo(449.611, 51.925, 451.449, 52.878, 452.68, 54.82);
-        ctx->bezierTo(453.061, 55.421, 452.48, 56.145, 452.069, 56.056);
-        ctx->bezierTo(444.249, 54.291, 437.176, 53.214, 429.43, 51.271);
-        ctx->closePath();
-    };
-    path_106();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_107 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(404.958, 129.332);
-        ctx->bezierTo(402.147, 127.18, 401.116, 123.594, 399.124, 120.43);
-        ctx->bezierTo(398.746, 119.83, 399.23, 119.275, 399.79, 119.118);
-        ctx->bezierTo(400.779, 118.837, 401.737, 119.681, 402.46, 120.038);
-        ctx->bezierTo(405.541, 121.56, 408.251, 123.753, 411.777, 123.998);
-        ctx->bezierTo(415.291, 127.943, 422.812, 128.623, 422.825, 134.592);
-        ctx->bezierTo(422.826, 136.109, 420.305, 134.488, 419.546, 136.005);
-        ctx->bezierTo(415.218, 134.234, 411, 134.416, 406.798, 131.826);
-        ctx->bezierTo(405.708, 131.153, 406.291, 130.353, 404.958, 129.332);
-        ctx->closePath();
-    };
-    path_107();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_108 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(356.336, 36.493);
-        ctx->bezierTo(356.574, 36.493, 368.988, 36.917, 368.958, 37.111);
-        ctx->bezierTo(368.879, 37.658, 355.23, 39.512, 354.588, 39.212);
-        ctx->bezierTo(354.298, 39.071, 341.035, 43.361, 340.798, 43.132);
-        ctx->bezierTo(341.271, 42.885, 355.866, 36.493, 356.336, 36.493);
-        ctx->closePath();
-    };
-    path_108();
-    ctx->setFillStyle(204, 114, 38, 255);
-    ctx->fill();
-
-    auto path_109 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(383.527, 53.726);
-        ctx->bezierTo(383.527, 53.726, 357.395, 56.904, 349.626, 59.023);
-        ctx->bezierTo(341.857, 61.141, 309.016, 74.56, 303.719, 78.092);
-        ctx->bezierTo(303.719, 78.092, 280.06, 87.626, 250.044, 122.939);
-        ctx->bezierTo(250.044, 122.939, 263.463, 116.936, 267.347, 111.992);
-        ctx->bezierTo(267.347, 111.992, 291.36, 89.745, 291.007, 94.336);
-        ctx->bezierTo(291.007, 94.336, 312.548, 79.151, 311.488, 83.035);
-        ctx->bezierTo(311.488, 83.035, 354.57, 63.26, 351.039, 68.91);
-        ctx->bezierTo(351.039, 68.91, 389.177, 60.788, 387.411, 64.32);
-        ctx->bezierTo(387.411, 64.32, 420.605, 72.088, 415.661, 72.442);
-        ctx->bezierTo(415.661, 72.442, 405.421, 74.56, 416.721, 80.917);
-        ctx->bezierTo(416.721, 80.917, 410.718, 88.686, 401.183, 81.623);
-        ctx->bezierTo(391.649, 74.56, 396.946, 78.445, 388.117, 80.21);
-        ctx->bezierTo(388.117, 80.21, 383.527, 81.623, 375.405, 74.56);
-        ctx->bezierTo(375.405, 74.56, 365.517, 66.438, 349.979, 72.795);
-        ctx->bezierTo(349.979, 72.795, 295.951, 95.042, 292.419, 96.101);
-        ctx->bezierTo(292.419, 96.101, 286.063, 101.045, 281.825, 107.401);
-        ctx->bezierTo(281.825, 107.401, 271.585, 115.17, 266.288, 117.642);
-        ctx->bezierTo(266.288, 117.642, 243.687, 138.124, 241.569, 140.596);
-        ctx->bezierTo(241.569, 140.596, 235.565, 149.777, 234.153, 150.483);
-        ctx->bezierTo(234.153, 150.483, 245.453, 143.774, 248.984, 140.242);
-        ctx->bezierTo(248.984, 140.242, 273.703, 122.586, 283.238, 121.173);
-        ctx->bezierTo(283.238, 121.173, 291.007, 115.876, 292.419, 113.405);
-        ctx->bezierTo(292.419, 113.405, 317.845, 97.161, 325.26, 97.161);
-        ctx->bezierTo(325.26, 97.161, 341.504, 106.342, 345.742, 93.982);
-        ctx->bezierTo(345.742, 93.982, 355.983, 90.804, 365.87, 92.923);
-        ctx->bezierTo(365.87, 92.923, 371.52, 88.332, 370.108, 84.448);
-        ctx->bezierTo(370.108, 84.448, 372.933, 81.27, 374.698, 87.979);
-        ctx->bezierTo(374.698, 87.979, 380.702, 94.336, 389.177, 90.804);
-        ctx->bezierTo(389.177, 90.804, 396.239, 90.451, 392.708, 94.689);
-        ctx->bezierTo(392.708, 94.689, 384.939, 101.398, 364.105, 101.751);
-        ctx->bezierTo(364.105, 101.751, 342.21, 102.811, 313.254, 116.23);
-        ctx->bezierTo(313.254, 116.23, 260.638, 134.592, 244.394, 152.955);
-        ctx->bezierTo(244.394, 152.955, 233.094, 168.493, 223.559, 170.612);
-        ctx->bezierTo(223.559, 170.612, 213.318, 172.024, 202.724, 185.09);
-        ctx->bezierTo(202.724, 185.09, 220.028, 174.849, 235.919, 174.849);
-        ctx->bezierTo(235.919, 174.849, 242.981, 170.612, 236.272, 176.968);
-        ctx->bezierTo(236.272, 176.968, 229.915, 190.387, 232.74, 199.921);
-        ctx->bezierTo(232.74, 199.921, 231.681, 209.103, 230.269, 211.928);
-        ctx->bezierTo(230.269, 211.928, 216.496, 234.528, 216.496, 238.765);
-        ctx->bezierTo(216.496, 243.003, 218.615, 260.306, 219.322, 261.366);
-        ctx->bezierTo(220.028, 262.425, 217.556, 258.541, 224.265, 262.778);
-        ctx->bezierTo(230.975, 267.016, 235.919, 269.841, 237.331, 274.785);
-        ctx->bezierTo(238.744, 279.728, 233.8, 265.25, 233.447, 262.072);
-        ctx->bezierTo(233.094, 258.894, 225.678, 246.181, 227.09, 241.944);
-        ctx->bezierTo(227.09, 241.944, 228.856, 243.709, 230.269, 246.181);
-        ctx->bezierTo(230.269, 246.181, 229.209, 245.122, 230.269, 238.765);
-        ctx->bezierTo(230.269, 238.765, 231.681, 229.584, 234.153, 223.934);
-        ctx->bezierTo(236.625, 218.284, 240.156, 211.575, 240.862, 210.162);
-        ctx->bezierTo(241.569, 208.749, 241.569, 198.509, 244.041, 203.099);
-        ctx->lineTo(250.044, 207.69);
-        ctx->bezierTo(250.044, 207.69, 245.1, 203.099, 248.984, 199.215);
-        ctx->bezierTo(248.984, 199.215, 247.219, 189.327, 250.397, 184.737);
-        ctx->bezierTo(250.397, 184.737, 262.756, 169.905, 265.581, 168.14);
-        ctx->bezierTo(268.406, 166.374, 265.935, 167.08, 265.935, 167.08);
-        ctx->bezierTo(265.935, 167.08, 276.528, 159.665, 266.288, 162.49);
-        ctx->bezierTo(266.288, 162.49, 259.225, 165.315, 253.928, 165.315);
-        ctx->bezierTo(253.928, 165.315, 240.509, 168.846, 247.572, 161.43);
-        ctx->bezierTo(254.634, 154.014, 272.291, 144.48, 279, 144.833);
-        ctx->lineTo(280.413, 147.658);
-        ctx->lineTo(300.188, 143.421);
-        ctx->lineTo(298.069, 144.833);
-        ctx->bezierTo(298.069, 144.833, 297.716, 144.48, 305.132, 143.774);
-        ctx->bezierTo(312.548, 143.067, 322.788, 145.539, 325.26, 142.361);
-        ctx->bezierTo(327.732, 139.183, 333.735, 137.417, 333.029, 139.889);
-        ctx->bezierTo(332.323, 142.361, 331.97, 145.892, 331.97, 145.892);
-        ctx->bezierTo(331.97, 145.892, 340.798, 135.652, 339.739, 139.536);
-        ctx->bezierTo(338.679, 143.421, 324.201, 152.602, 321.729, 163.549);
-        ctx->lineTo(340.092, 149.071);
-        ctx->lineTo(346.448, 143.774);
-        ctx->bezierTo(346.448, 143.774, 352.804, 147.658, 353.158, 144.833);
-        ctx->bezierTo(353.511, 142.008, 361.633, 131.767, 363.751, 132.12);
-        ctx->bezierTo(365.87, 132.474, 369.401, 127.53, 369.048, 132.12);
-        ctx->bezierTo(368.695, 136.711, 382.114, 146.246, 382.114, 146.246);
-        ctx->bezierTo(382.114, 146.246, 387.764, 143.067, 390.236, 145.539);
-        ctx->bezierTo(392.708, 148.011, 400.124, 110.58, 400.124, 110.58);
-        ctx->lineTo(444.265, 91.864);
-        ctx->lineTo(521.247, 85.861);
-        ctx->lineTo(491.233, 73.854);
-        ctx->lineTo(383.527, 53.726);
-        ctx->closePath();
-    };
-    path_109();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_110 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(415.661, 405.089);
-        ctx->bezierTo(415.661, 405.089, 389.177, 375.426, 374.345, 370.836);
-        ctx->bezierTo(374.345, 370.836, 350.686, 358.829, 307.251, 372.601);
-    };
-    ctx->setLineWidth(3.531);
-    path_110();
-    ctx->setStrokeStyle(76, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_111 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(368.695, 368.364);
-        ctx->bezierTo(368.695, 368.364, 324.201, 354.239, 297.01, 361.654);
-        ctx->bezierTo(297.01, 361.654, 264.522, 365.186, 249.691, 389.552);
-    };
-    ctx->setLineWidth(3.531);
-    path_111();
-    ctx->setStrokeStyle(76, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_112 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(362.339, 366.245);
-        ctx->bezierTo(362.339, 366.245, 332.323, 353.532, 306.191, 349.648);
-        ctx->bezierTo(306.191, 349.648, 276.882, 345.057, 247.572, 357.77);
-        ctx->bezierTo(247.572, 357.77, 226.031, 368.364, 216.496, 386.374);
-    };
-    ctx->setLineWidth(3.531);
-    path_112();
-    ctx->setStrokeStyle(76, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_113 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(364.105, 366.951);
-        ctx->bezierTo(364.105, 366.951, 336.914, 347.529, 335.148, 345.057);
-        ctx->bezierTo(335.148, 345.057, 322.788, 325.635, 299.835, 324.929);
-        ctx->bezierTo(299.835, 324.929, 262.05, 326.342, 231.681, 340.467);
-    };
-    ctx->setLineWidth(3.531);
-    path_113();
-    ctx->setStrokeStyle(76, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_114 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(361.8, 351.073);
-        ctx->bezierTo(364.523, 353.656, 412.13, 404.736, 412.13, 404.736);
-        ctx->bezierTo(474.281, 469.359, 424.843, 408.974, 424.843, 408.974);
-        ctx->bezierTo(411.424, 400.499, 395.18, 367.305, 395.18, 367.305);
-        ctx->bezierTo(393.061, 362.361, 419.899, 380.017, 419.899, 380.017);
-        ctx->bezierTo(426.962, 381.43, 450.974, 415.33, 450.974, 415.33);
-        ctx->bezierTo(438.968, 411.093, 447.443, 423.805, 447.443, 423.805);
-        ctx->bezierTo(452.387, 427.336, 488.408, 454.881, 488.408, 454.881);
-        ctx->bezierTo(494.764, 461.943, 501.825, 464.768, 501.825, 464.768);
-        ctx->bezierTo(526.544, 455.587, 515.244, 478.893, 515.244, 478.893);
-        ctx->bezierTo(519.481, 490.9, 529.369, 470.418, 529.369, 470.418);
-        ctx->bezierTo(549.144, 440.755, 520.188, 444.993, 520.188, 444.993);
-        ctx->bezierTo(467.218, 449.937, 455.212, 421.686, 455.212, 421.686);
-        ctx->bezierTo(450.974, 417.449, 466.512, 421.686, 466.512, 421.686);
-        ctx->bezierTo(481.345, 425.218, 453.799, 399.792, 453.799, 399.792);
-        ctx->bezierTo(458.037, 399.792, 474.281, 411.799, 474.281, 411.799);
-        ctx->bezierTo(492.645, 428.043, 496.177, 424.511, 496.177, 424.511);
-        ctx->bezierTo(527.956, 408.974, 546.319, 422.393, 546.319, 422.393);
-        ctx->bezierTo(549.85, 425.218, 539.963, 437.224, 542.788, 446.405);
-        ctx->bezierTo(545.613, 455.587, 554.088, 477.481, 554.088, 477.481);
-        ctx->bezierTo(549.85, 480.306, 550.557, 499.375, 550.557, 499.375);
-        ctx->bezierTo(580.22, 540.338, 563.269, 536.807, 563.269, 536.807);
-        ctx->bezierTo(535.725, 536.1, 561.857, 549.519, 561.857, 549.519);
-        ctx->bezierTo(567.507, 553.051, 583.045, 565.763, 583.045, 565.763);
-        ctx->bezierTo(578.101, 563.644, 575.276, 572.826, 575.276, 572.826);
-        ctx->bezierTo(583.751, 579.888, 578.807, 588.363, 578.807, 588.363);
-        ctx->bezierTo(568.213, 590.482, 566.094, 597.545, 566.094, 597.545);
-        ctx->bezierTo(578.101, 611.67, 560.444, 612.376, 560.444, 612.376);
-        ctx->bezierTo(566.801, 620.145, 558.326, 641.333, 558.326, 641.333);
-        ctx->bezierTo(549.85, 641.333, 538.55, 651.22, 538.55, 651.22);
-        ctx->bezierTo(542.788, 659.696, 524.425, 669.583, 524.425, 669.583);
-        ctx->bezierTo(509.594, 672.408, 514.538, 684.415, 514.538, 684.415);
-        ctx->bezierTo(500.414, 695.008, 496.177, 723.259, 496.177, 723.259);
-        ctx->bezierTo(494.764, 741.622, 490.527, 747.272, 499.708, 743.74);
-        ctx->bezierTo(508.888, 740.209, 507.475, 718.315, 507.475, 718.315);
-        ctx->bezierTo(499.002, 690.771, 574.57, 662.521, 574.57, 662.521);
-        ctx->bezierTo(581.632, 659.696, 583.045, 650.514, 583.045, 650.514);
-        ctx->bezierTo(586.576, 651.22, 602.114, 664.639, 602.114, 664.639);
-        ctx->bezierTo(615.533, 684.415, 616.239, 668.171, 616.239, 668.171);
-        ctx->bezierTo(618.358, 661.814, 615.533, 651.22, 615.533, 651.22);
-        ctx->bezierTo(626.126, 613.082, 601.407, 601.782, 601.407, 601.782);
-        ctx->bezierTo(583.751, 542.457, 608.47, 557.288, 608.47, 557.288);
-        ctx->bezierTo(613.414, 567.176, 632.483, 576.357, 632.483, 576.357);
-        ctx->lineTo(638.839, 572.119);
-        ctx->bezierTo(636.014, 563.644, 650.845, 553.051, 650.845, 553.051);
-        ctx->bezierTo(655.789, 564.351, 666.383, 550.225, 666.383, 550.225);
-        ctx->bezierTo(672.739, 507.144, 694.633, 532.569, 694.633, 532.569);
-        ctx->bezierTo(701.696, 534.688, 703.815, 522.681, 703.815, 522.681);
-        ctx->bezierTo(710.171, 504.319, 703.815, 480.306, 703.815, 480.306);
-        ctx->bezierTo(710.171, 479.6, 727.121, 490.194, 727.121, 490.194);
-        ctx->bezierTo(732.065, 483.837, 715.821, 454.174, 722.884, 458.412);
-        ctx->bezierTo(729.946, 462.649, 737.715, 465.474, 737.715, 465.474);
-        ctx->bezierTo(739.128, 461.943, 721.471, 440.049, 721.471, 440.049);
-        ctx->bezierTo(713.702, 435.105, 704.521, 399.086, 704.521, 399.086);
-        ctx->bezierTo(717.234, 405.442, 699.577, 378.605, 699.577, 378.605);
-        ctx->bezierTo(699.577, 372.955, 710.171, 353.179, 710.171, 353.179);
-        ctx->bezierTo(708.759, 341.173, 710.171, 341.879, 710.171, 341.879);
-        ctx->bezierTo(715.115, 343.998, 729.24, 346.823, 717.234, 335.523);
-        ctx->bezierTo(705.227, 324.223, 718.646, 315.748, 718.646, 315.748);
-        ctx->bezierTo(726.415, 310.804, 702.402, 311.51, 702.402, 311.51);
-        ctx->bezierTo(693.221, 303.741, 693.927, 296.679, 693.927, 296.679);
-        ctx->bezierTo(708.052, 300.21, 682.627, 274.785, 678.39, 268.428);
-        ctx->bezierTo(674.152, 262.072, 691.102, 252.891, 691.102, 252.891);
-        ctx->bezierTo(714.409, 246.534, 693.927, 240.884, 693.927, 240.884);
-        ctx->bezierTo(659.321, 241.591, 678.39, 222.522, 678.39, 222.522);
-        ctx->bezierTo(688.983, 223.228, 686.158, 218.99, 686.158, 218.99);
-        ctx->bezierTo(676.977, 216.871, 660.027, 205.571, 660.027, 205.571);
-        ctx->bezierTo(652.964, 199.215, 659.321, 200.628, 659.321, 200.628);
-        ctx->bezierTo(688.983, 202.746, 638.133, 182.971, 638.133, 182.971);
-        ctx->bezierTo(652.258, 182.971, 620.476, 164.608, 620.476, 164.608);
-        ctx->bezierTo(616.945, 161.783, 611.295, 148.364, 611.295, 148.364);
-        ctx->bezierTo(600.701, 139.183, 592.226, 127.177, 592.226, 127.177);
-        ctx->bezierTo(591.52, 119.408, 583.045, 110.933, 583.045, 110.933);
-        ctx->bezierTo(562.563, 86.92, 552.676, 87.626, 552.676, 87.626);
-        ctx->bezierTo(526.544, 81.27, 517.363, 82.682, 517.363, 82.682);
-        ctx->lineTo(424.136, 90.451);
-        ctx->bezierTo(377.523, 113.051, 391.295, 150.13, 391.295, 150.13);
-        ctx->bezierTo(402.596, 164.961, 418.84, 158.252, 418.84, 158.252);
-        ctx->bezierTo(426.962, 147.305, 447.443, 151.189, 447.443, 151.189);
-        ctx->bezierTo(483.464, 156.839, 478.873, 150.483, 478.873, 150.483);
-        ctx->bezierTo(474.636, 142.361, 446.03, 131.414, 445.677, 130.355);
-        ctx->bezierTo(445.324, 129.295, 429.787, 123.292, 429.787, 123.292);
-        ctx->bezierTo(424.49, 121.173, 416.721, 104.929, 416.721, 104.929);
-        ctx->bezierTo(411.071, 98.926, 438.968, 109.167, 438.968, 109.167);
-        ctx->bezierTo(436.849, 110.933, 449.915, 117.995, 449.915, 117.995);
-        ctx->bezierTo(480.639, 116.23, 499.355, 135.299, 499.355, 135.299);
-        ctx->bezierTo(518.422, 164.608, 518.775, 150.13, 518.775, 150.13);
-        ctx->bezierTo(523.719, 133.533, 502.884, 96.101, 502.884, 96.101);
-        ctx->bezierTo(503.591, 92.57, 518.069, 104.223, 518.069, 104.223);
-        ctx->bezierTo(520.541, 100.692, 521.953, 110.933, 521.953, 110.933);
-        ctx->bezierTo(522.306, 115.17, 529.016, 129.295, 529.016, 129.295);
-        ctx->bezierTo(533.96, 152.249, 540.316, 139.183, 540.316, 139.183);
-        ctx->lineTo(548.438, 155.78);
-        ctx->bezierTo(550.91, 160.371, 540.316, 173.79, 540.316, 173.79);
-        ctx->bezierTo(539.963, 178.733, 541.375, 178.38, 531.488, 191.799);
-        ctx->bezierTo(521.6, 205.218, 527.603, 212.987, 527.603, 212.987);
-        ctx->bezierTo(525.131, 224.64, 540.669, 223.934, 540.669, 223.934);
-        ctx->bezierTo(545.26, 227.818, 551.263, 227.818, 551.263, 227.818);
-        ctx->bezierTo(554.441, 231.35, 558.679, 230.29, 558.679, 230.29);
-        ctx->bezierTo(561.504, 223.581, 572.451, 227.112, 572.451, 227.112);
-        ctx->bezierTo(574.923, 222.875, 589.401, 222.168, 589.401, 222.168);
-        ctx->bezierTo(591.167, 217.578, 591.873, 214.753, 597.876, 213.693);
-        ctx->bezierTo(603.879, 212.634, 560.444, 136.711, 560.444, 136.711);
-        ctx->bezierTo(571.745, 135.299, 557.266, 113.405, 557.266, 113.405);
-        ctx->bezierTo(553.382, 101.751, 573.51, 127.53, 577.395, 130.002);
-        ctx->bezierTo(581.279, 132.474, 583.045, 136.358, 580.22, 136.005);
-        ctx->bezierTo(577.395, 135.652, 574.216, 139.536, 576.688, 139.889);
-        ctx->bezierTo(579.16, 140.242, 602.114, 166.727, 608.117, 184.737);
-        ctx->bezierTo(614.12, 202.746, 624.714, 209.809, 635.661, 220.403);
-        ctx->bezierTo(646.608, 230.997, 645.195, 273.725, 645.195, 273.725);
-        ctx->bezierTo(644.489, 289.263, 655.083, 307.979, 655.083, 307.979);
-        ctx->bezierTo(658.614, 314.688, 651.199, 346.823, 651.199, 346.823);
-        ctx->bezierTo(647.667, 350.707, 650.139, 352.12, 650.139, 352.12);
-        ctx->bezierTo(651.905, 354.239, 663.911, 377.545, 663.911, 377.545);
-        ctx->bezierTo(660.733, 377.192, 667.089, 383.548, 667.089, 383.548);
-        ctx->bezierTo(676.271, 394.142, 664.971, 388.845, 664.971, 388.845);
-        ctx->bezierTo(654.377, 386.02, 666.736, 403.324, 666.736, 403.324);
-        ctx->bezierTo(668.855, 406.502, 652.964, 398.38, 652.964, 398.38);
-        ctx->bezierTo(636.72, 397.321, 657.202, 410.033, 657.202, 410.033);
-        ctx->bezierTo(672.386, 422.746, 652.258, 414.977, 652.258, 414.977);
-        ctx->bezierTo(644.136, 411.799, 649.786, 423.805, 649.786, 423.805);
-        ctx->bezierTo(655.436, 426.63, 685.805, 438.99, 685.805, 438.99);
-        ctx->bezierTo(686.512, 445.699, 681.215, 454.527, 681.215, 454.527);
-        ctx->bezierTo(681.921, 461.59, 678.036, 467.593, 678.036, 467.593);
-        ctx->bezierTo(675.918, 482.072, 674.858, 483.484, 674.858, 483.484);
-        ctx->bezierTo(667.443, 483.837, 654.377, 508.203, 654.377, 508.203);
-        ctx->bezierTo(651.199, 512.794, 633.189, 533.982, 633.189, 533.982);
-        ctx->bezierTo(629.658, 546.341, 597.876, 533.628, 597.876, 533.628);
-        ctx->bezierTo(586.223, 539.632, 589.754, 533.628, 589.754, 533.628);
-        ctx->bezierTo(589.048, 529.744, 597.523, 519.15, 597.523, 519.15);
-        ctx->bezierTo(609.882, 514.559, 605.292, 495.49, 605.292, 495.49);
-        ctx->bezierTo(612.354, 493.019, 592.579, 488.075, 592.932, 485.956);
-        ctx->bezierTo(593.285, 483.837, 603.526, 481.365, 603.526, 481.365);
-        ctx->bezierTo(617.651, 477.834, 609.882, 473.596, 609.882, 473.596);
-        ctx->bezierTo(608.823, 466.534, 614.12, 456.646, 614.12, 456.646);
-        ctx->bezierTo(634.602, 455.234, 614.12, 426.63, 614.12, 426.63);
-        ctx->bezierTo(595.051, 413.211, 593.285, 402.971, 593.285, 402.971);
-        ctx->bezierTo(615.533, 388.492, 601.054, 366.598, 601.407, 360.242);
-        ctx->bezierTo(601.76, 353.886, 603.879, 315.748, 603.879, 315.748);
-        ctx->bezierTo(600.348, 304.801, 595.051, 280.788, 595.051, 280.788);
-        ctx->bezierTo(598.935, 271.606, 612.001, 249.359, 612.001, 249.359);
-        ctx->bezierTo(616.945, 241.944, 632.483, 233.469, 628.598, 228.172);
-        ctx->bezierTo(624.714, 222.875, 610.942, 226.053, 610.942, 226.053);
-        ctx->bezierTo(597.17, 223.581, 598.229, 232.762, 598.229, 232.762);
-        ctx->bezierTo(595.404, 234.528, 593.992, 243.356, 593.992, 243.356);
-        ctx->bezierTo(592.72, 257.363, 577.041, 268.428, 577.041, 268.428);
-        ctx->bezierTo(557.266, 279.375, 573.51, 286.438, 573.51, 286.438);
-        ctx->bezierTo(584.104, 298.091, 566.801, 298.444, 566.801, 298.444);
-        ctx->bezierTo(547.379, 295.266, 561.857, 313.276, 561.857, 313.276);
-        ctx->bezierTo(580.926, 335.876, 575.629, 340.82, 575.629, 340.82);
-        ctx->bezierTo(557.619, 342.585, 579.866, 358.829, 579.866, 358.829);
-        ctx->bezierTo(579.866, 358.829, 578.454, 355.298, 578.807, 358.476);
-        ctx->bezierTo(579.16, 361.654, 584.457, 369.07, 585.87, 372.601);
-        ctx->bezierTo(587.282, 376.133, 580.22, 376.486, 580.22, 376.486);
-        ctx->bezierTo(581.279, 393.436, 554.088, 386.02, 554.088, 386.02);
-        ctx->lineTo(551.263, 386.374);
-        ctx->bezierTo(548.438, 386.727, 528.663, 385.314, 518.422, 381.43);
-        ctx->bezierTo(508.181, 377.545, 496.177, 377.545, 496.177, 377.545);
-        ctx->bezierTo(496.177, 377.545, 489.114, 380.723, 475.693, 380.37);
-        ctx->bezierTo(462.274, 380.017, 448.149, 384.961, 448.149, 384.961);
-        ctx->bezierTo(440.38, 384.255, 455.565, 376.486, 455.918, 376.839);
-        ctx->bezierTo(456.271, 377.192, 466.159, 367.305, 452.034, 368.364);
-        ctx->bezierTo(413.548, 371.251, 394.474, 353.179, 394.474, 353.179);
-        ctx->bezierTo(390.942, 350.707, 386.352, 345.764, 386.352, 345.764);
-        ctx->bezierTo(368.695, 342.232, 388.824, 367.658, 388.824, 367.658);
-        ctx->bezierTo(390.942, 370.13, 388.47, 371.895, 388.47, 371.895);
-        ctx->bezierTo(387.058, 369.07, 373.286, 359.536, 373.286, 359.536);
-        ctx->bezierTo(368.323, 357.818, 365.916, 355.462, 361.8, 351.073);
-        ctx->closePath();
-    };
-    path_114();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_115 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(319.61, 330.579);
-        ctx->bezierTo(319.61, 330.579, 340.092, 340.467, 344.682, 345.411);
-        ctx->bezierTo(349.273, 350.354, 373.992, 370.483, 373.992, 370.483);
-        ctx->bezierTo(373.992, 370.483, 364.458, 366.951, 359.867, 363.773);
-        ctx->bezierTo(355.276, 360.595, 336.207, 346.117, 336.207, 346.117);
-        ctx->bezierTo(336.207, 346.117, 329.498, 335.523, 319.61, 330.579);
-        ctx->closePath();
-    };
-    path_115();
-    ctx->setFillStyle(76, 0, 0, 255);
-    ctx->fill();
-
-    auto path_116 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(217.187, 275.496);
-        ctx->bezierTo(217.782, 275.235, 216.857, 270.446, 216.496, 269.488);
-        ctx->bezierTo(214.692, 264.675, 198.84, 262.072, 198.84, 262.072);
-        ctx->bezierTo(198.439, 264.482, 198.342, 267.3, 198.529, 270.192);
-        ctx->bezierTo(198.529, 270.192, 207.124, 279.937, 217.187, 275.496);
-        ctx->closePath();
-    };
-    path_116();
-    ctx->setFillStyle(153, 204, 50, 255);
-    ctx->fill();
-
-    auto path_117 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(217.187, 275.143);
-        ctx->bezierTo(216.394, 275.422, 217.16, 270.316, 216.85, 269.488);
-        ctx->bezierTo(215.045, 264.675, 198.84, 261.895, 198.84, 261.895);
-        ctx->bezierTo(198.439, 264.306, 198.342, 267.124, 198.529, 270.016);
-        ctx->bezierTo(198.529, 270.016, 206.065, 279.054, 217.187, 275.143);
-        ctx->closePath();
-    };
-    path_117();
-    ctx->setFillStyle(101, 153, 0, 255);
-    ctx->fill();
-
-    auto path_118 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(209.434, 275.396);
-        ctx->bezierTo(208.33, 275.396, 207.437, 273.383, 207.437, 270.9);
-        ctx->bezierTo(207.437, 268.42, 208.33, 266.407, 209.434, 266.407);
-        ctx->bezierTo(210.537, 266.407, 211.433, 268.42, 211.433, 270.9);
-        ctx->bezierTo(211.433, 273.383, 210.537, 275.396, 209.434, 275.396);
-        ctx->closePath();
-    };
-    path_118();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_119 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(209.434, 270.9);
-        ctx->closePath();
-    };
-    path_119();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_120 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(128.92, 448.524);
-        ctx->bezierTo(128.92, 448.524, 119.033, 466.181, 162.821, 455.587);
-        ctx->bezierTo(162.821, 455.587, 187.54, 453.468, 191.777, 449.231);
-        ctx->bezierTo(193.896, 450.643, 208.668, 455.816, 213.671, 456.999);
-        ctx->bezierTo(225.678, 459.824, 240.509, 442.168, 240.509, 442.168);
-        ctx->bezierTo(240.509, 442.168, 248.631, 423.629, 253.575, 423.629);
-        ctx->bezierTo(258.519, 423.629, 252.869, 426.454, 252.869, 426.454);
-        ctx->bezierTo(252.869, 426.454, 241.216, 444.287, 241.922, 447.112);
-        ctx->bezierTo(241.922, 447.112, 232.74, 482.425, 204.49, 483.837);
-        ctx->bezierTo(204.49, 483.837, 175.975, 485.515, 178.359, 495.844);
-        ctx->bezierTo(178.359, 495.844, 193.896, 491.606, 198.134, 495.844);
-        ctx->bezierTo(198.134, 495.844, 217.203, 495.137, 203.078, 506.437);
-        ctx->lineTo(191.071, 526.919);
-        ctx->bezierTo(191.071, 526.919, 191.318, 533.84, 173.415, 527.625);
-        ctx->bezierTo(156.111, 521.622, 137.925, 498.845, 137.925, 498.845);
-        ctx->bezierTo(137.925, 498.845, 109.763, 473.155, 128.92, 448.524);
-        ctx->closePath();
-    };
-    path_120();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_121 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(126.802, 455.587);
-        ctx->bezierTo(126.802, 455.587, 123.27, 472.537, 188.246, 454.174);
-        ctx->lineTo(200.253, 455.587);
-        ctx->bezierTo(204.49, 456.999, 225.678, 461.943, 229.209, 459.824);
-        ctx->bezierTo(229.209, 459.824, 216.496, 483.837, 196.015, 481.012);
-        ctx->bezierTo(196.015, 481.012, 172.708, 483.837, 173.415, 492.312);
-        ctx->bezierTo(173.415, 492.312, 180.477, 505.025, 188.952, 509.262);
-        ctx->bezierTo(188.952, 509.262, 193.896, 513.5, 193.19, 519.15);
-        ctx->bezierTo(192.484, 524.8, 187.54, 527.625, 184.009, 529.038);
-        ctx->bezierTo(180.477, 530.45, 174.827, 524.8, 172.002, 524.8);
-        ctx->bezierTo(169.177, 524.8, 154.346, 513.5, 146.577, 505.025);
-        ctx->bezierTo(138.808, 496.55, 123.977, 475.362, 124.683, 470.418);
-        ctx->bezierTo(125.389, 465.474, 126.802, 455.587, 126.802, 455.587);
-        ctx->closePath();
-    };
-    path_121();
-    ctx->setFillStyle(229, 153, 153, 255);
-    ctx->fill();
-
-    auto path_122 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(132.452, 486.397);
-        ctx->bezierTo(137.042, 493.372, 142.692, 500.787, 146.577, 505.025);
-        ctx->bezierTo(154.346, 513.5, 169.177, 524.8, 172.002, 524.8);
-        ctx->bezierTo(174.827, 524.8, 180.477, 530.45, 184.009, 529.038);
-        ctx->bezierTo(187.54, 527.625, 192.484, 524.8, 193.19, 519.15);
-        ctx->bezierTo(193.896, 513.5, 188.952, 509.262, 188.952, 509.262);
-        ctx->bezierTo(183.539, 506.561, 178.701, 500.399, 175.913, 496.285);
-        ctx->bezierTo(175.913, 496.285, 176.24, 500.787, 167.058, 499.375);
-        ctx->bezierTo(157.877, 497.962, 148.696, 493.019, 145.871, 487.368);
-        ctx->bezierTo(143.046, 481.718, 138.808, 477.481, 141.633, 483.837);
-        ctx->bezierTo(144.458, 490.194, 148.696, 496.55, 151.521, 497.256);
-        ctx->bezierTo(154.346, 497.962, 153.639, 500.081, 149.402, 499.375);
-        ctx->bezierTo(145.164, 498.669, 140.221, 497.962, 132.452, 488.781);
-        ctx->closePath();
-    };
-    path_122();
-    ctx->setFillStyle(178, 101, 101, 255);
-    ctx->fill();
-
-    auto path_123 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(127.861, 449.231);
-        ctx->bezierTo(127.861, 449.231, 131.039, 425.218, 133.158, 418.155);
-        ctx->bezierTo(133.158, 418.155, 131.745, 406.149, 135.983, 398.733);
-        ctx->bezierTo(140.221, 391.317, 143.752, 380.37, 149.049, 370.836);
-        ctx->bezierTo(154.346, 361.301, 154.699, 354.239, 161.761, 351.414);
-        ctx->bezierTo(168.824, 348.589, 179.418, 333.404, 184.362, 331.638);
-        ctx->bezierTo(189.306, 329.873, 188.952, 331.285, 188.952, 331.285);
-        ctx->bezierTo(188.952, 331.285, 200.959, 305.154, 224.972, 312.216);
-        ctx->bezierTo(224.972, 312.216, 196.368, 307.273, 224.265, 290.675);
-        ctx->bezierTo(224.265, 290.675, 215.79, 292.618, 221.617, 280.258);
-        ctx->bezierTo(225.503, 272.016, 224.618, 283.966, 205.196, 304.801);
-        ctx->bezierTo(205.196, 304.801, 196.368, 319.985, 187.187, 325.282);
-        ctx->bezierTo(178.005, 330.579, 156.818, 342.939, 154.699, 349.648);
-        ctx->bezierTo(152.58, 356.358, 146.93, 366.598, 143.399, 369.423);
-        ctx->bezierTo(139.867, 372.248, 134.924, 379.664, 134.217, 385.667);
-        ctx->bezierTo(134.217, 385.667, 132.099, 392.73, 129.627, 394.849);
-        ctx->bezierTo(127.155, 396.967, 126.802, 402.617, 126.802, 406.149);
-        ctx->bezierTo(126.802, 409.68, 123.27, 414.624, 123.623, 418.861);
-        ctx->bezierTo(123.623, 418.861, 125.036, 452.409, 124.33, 455.94);
-        ctx->lineTo(127.861, 449.231);
-        ctx->closePath();
-    };
-    path_123();
-    ctx->setFillStyle(153, 38, 0, 255);
-    ctx->fill();
-
-    auto path_124 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(112.676, 457.352);
-        ctx->bezierTo(112.676, 457.352, 109.145, 454.881, 101.376, 465.474);
-        ctx->bezierTo(101.376, 465.474, 114.266, 523.741, 114.266, 526.213);
-        ctx->bezierTo(114.266, 526.213, 116.208, 522.505, 113.912, 509.792);
-        ctx->bezierTo(111.617, 497.08, 110.028, 474.656, 110.028, 474.656);
-        ctx->lineTo(112.676, 457.352);
-        ctx->closePath();
-    };
-    path_124();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_125 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(150.814, 350.354);
-        ctx->bezierTo(150.814, 350.354, 119.739, 356.004, 120.445, 407.561);
-        ctx->lineTo(119.033, 451.349);
-        ctx->bezierTo(119.033, 451.349, 116.914, 406.149, 114.795, 403.324);
-        ctx->bezierTo(112.676, 400.499, 119.739, 380.723, 114.089, 391.317);
-        ctx->bezierTo(114.089, 391.317, 89.37, 416.036, 103.495, 453.468);
-        ctx->bezierTo(103.495, 453.468, 106.144, 459.295, 100.847, 451.173);
-        ctx->bezierTo(100.847, 451.173, 92.725, 428.926, 94.667, 417.625);
-        ctx->bezierTo(94.667, 417.625, 95.02, 413.741, 98.375, 408.797);
-        ctx->bezierTo(98.375, 408.797, 113.559, 388.139, 118.327, 384.078);
-        ctx->bezierTo(118.327, 384.078, 121.505, 358.653, 148.696, 349.471);
-        ctx->bezierTo(148.696, 349.471, 158.76, 345.411, 150.814, 350.354);
-        ctx->closePath();
-    };
-    path_125();
-    ctx->setFillStyle(153, 38, 0, 255);
-    ctx->fill();
-
-    auto path_126 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(396.946, 233.469);
-        ctx->bezierTo(398.111, 232.843, 398.095, 231.131, 399.119, 230.825);
-        ctx->bezierTo(401.148, 230.218, 401.437, 228.334, 402.352, 226.95);
-        ctx->bezierTo(403.893, 224.621, 404.234, 221.914, 405.262, 219.282);
-        ctx->bezierTo(405.742, 218.046, 405.79, 216.359, 405.237, 215.194);
-        ctx->bezierTo(403.164, 210.814, 401.925, 206.489, 399.379, 202.206);
-        ctx->bezierTo(398.905, 201.411, 398.443, 200.01, 398.088, 198.954);
-        ctx->bezierTo(397.27, 196.51, 395.051, 194.76, 393.533, 192.43);
-        ctx->bezierTo(393.024, 191.651, 393.951, 190.018, 392.687, 189.869);
-        ctx->bezierTo(391.103, 189.684, 388.545, 188.66, 388.133, 190.472);
-        ctx->bezierTo(387.095, 195.039, 388.88, 199.494, 390.589, 203.806);
-        ctx->bezierTo(389.208, 205.028, 389.798, 206.654, 390.067, 208.008);
-        ctx->bezierTo(391.32, 214.375, 389.205, 220.293, 387.861, 226.427);
-        ctx->bezierTo(387.821, 226.611, 388.425, 226.96, 388.375, 227.07);
-        ctx->bezierTo(386.217, 231.812, 383.654, 236.129, 380.442, 240.333);
-        ctx->bezierTo(379.104, 242.085, 377.564, 243.702, 376.687, 245.579);
-        ctx->bezierTo(376.037, 246.969, 375.316, 248.674, 375.758, 250.419);
-        ctx->bezierTo(369.693, 255.327, 365.72, 262.116, 361.11, 268.907);
-        ctx->bezierTo(360.294, 270.107, 360.808, 272.242, 361.781, 272.717);
-        ctx->bezierTo(363.216, 273.42, 364.904, 271.612, 365.734, 270.118);
-        ctx->bezierTo(366.421, 268.886, 367.044, 267.738, 367.911, 266.603);
-        ctx->bezierTo(368.146, 266.294, 367.83, 265.554, 368.068, 265.34);
-        ctx->bezierTo(372.717, 261.196, 375.664, 256.012, 379.995, 251.831);
-        ctx->bezierTo(383.438, 251.25, 386.152, 249.488, 389.238, 247.7);
-        ctx->bezierTo(389.782, 247.384, 390.708, 247.823, 391.22, 247.479);
-        ctx->bezierTo(394.315, 245.401, 394.311, 241.806, 394.498, 238.434);
-        ctx->bezierTo(394.587, 236.873, 394.933, 234.547, 396.946, 233.469);
-        ctx->closePath();
-    };
-    path_126();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_127 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(381.335, 225.583);
-        ctx->bezierTo(381.554, 225.447, 381.281, 224.7, 381.473, 224.319);
-        ctx->bezierTo(381.759, 223.747, 382.471, 223.415, 382.757, 222.843);
-        ctx->bezierTo(382.949, 222.461, 382.661, 221.791, 382.902, 221.54);
-        ctx->bezierTo(387.021, 217.219, 387.475, 211.88, 385.645, 206.631);
-        ctx->bezierTo(387.453, 205.536, 387.561, 203.308, 386.811, 201.812);
-        ctx->bezierTo(385.305, 198.811, 384.964, 195.41, 383.242, 192.686);
-        ctx->bezierTo(381.826, 190.445, 379.04, 188.249, 376.619, 190.549);
-        ctx->bezierTo(375.876, 191.255, 375.309, 192.645, 375.8, 193.902);
-        ctx->bezierTo(375.913, 194.19, 376.416, 194.448, 376.369, 194.593);
-        ctx->bezierTo(376.18, 195.165, 375.216, 195.56, 375.205, 196.04);
-        ctx->bezierTo(375.152, 198.682, 373.468, 201.35, 374.58, 203.696);
-        ctx->bezierTo(375.943, 206.572, 377.389, 209.851, 378.583, 212.987);
-        ctx->bezierTo(376.404, 216.723, 378.228, 221.047, 375.133, 224.361);
-        ctx->bezierTo(374.893, 224.619, 374.908, 225.301, 375.124, 225.657);
-        ctx->bezierTo(375.639, 226.515, 376.356, 227.232, 377.214, 227.748);
-        ctx->bezierTo(377.571, 227.961, 378.186, 227.965, 378.539, 227.746);
-        ctx->bezierTo(379.559, 227.107, 380.262, 226.247, 381.335, 225.583);
-        ctx->closePath();
-    };
-    path_127();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_128 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(492.239, 207.378);
-        ctx->bezierTo(494.692, 210.542, 495.204, 215.477, 491.586, 217.931);
-        ctx->bezierTo(492.557, 223.773, 498.474, 220.279, 502.178, 219.343);
-        ctx->bezierTo(501.984, 218.658, 502.39, 218.051, 502.884, 218.042);
-        ctx->bezierTo(504.756, 218.016, 505.957, 216.193, 507.828, 216.518);
-        ctx->bezierTo(508.605, 213.769, 511.483, 212.53, 512.631, 210.093);
-        ctx->bezierTo(515.668, 203.569, 514.626, 196.024, 510.07, 190.293);
-        ctx->bezierTo(509.717, 189.845, 510.088, 188.932, 509.876, 188.293);
-        ctx->bezierTo(508.534, 184.389, 504.897, 183.833, 501.472, 182.618);
-        ctx->bezierTo(499.395, 175.776, 498.228, 168.659, 495.117, 162.136);
-        ctx->bezierTo(492.267, 161.695, 491.035, 158.625, 488.674, 157.353);
-        ctx->bezierTo(486.321, 156.084, 485.318, 158.872, 485.39, 160.719);
-        ctx->bezierTo(485.403, 161.081, 486.201, 161.476, 485.901, 162.121);
-        ctx->bezierTo(485.766, 162.41, 485.307, 162.606, 485.307, 162.843);
-        ctx->bezierTo(485.309, 163.081, 485.699, 163.312, 485.936, 163.549);
-        ctx->bezierTo(484.315, 164.997, 481.802, 165.839, 481.282, 167.861);
-        ctx->bezierTo(479.597, 174.411, 484.14, 179.929, 487.085, 185.581);
-        ctx->bezierTo(488.129, 187.585, 486.829, 189.829, 485.487, 191.962);
-        ctx->bezierTo(484.714, 193.189, 484.905, 195.179, 485.392, 196.69);
-        ctx->bezierTo(486.72, 200.806, 489.529, 203.876, 492.239, 207.378);
-        ctx->closePath();
-    };
-    path_128();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_129 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(426.628, 239.841);
-        ctx->bezierTo(424.002, 243.109, 417.978, 247.645, 423.128, 251.049);
-        ctx->bezierTo(423.471, 251.277, 424.124, 251.284, 424.43, 251.047);
-        ctx->bezierTo(427.998, 248.284, 431.535, 246.69, 435.836, 245.662);
-        ctx->bezierTo(436.055, 245.611, 436.538, 246.435, 437.19, 246.151);
-        ctx->bezierTo(440.038, 244.91, 443.587, 245.012, 445.677, 242.65);
-        ctx->bezierTo(452.329, 243.045, 458.623, 241.075, 464.61, 238.765);
-        ctx->bezierTo(466.66, 237.974, 468.903, 236.987, 471.023, 236.101);
-        ctx->bezierTo(473.453, 235.084, 475.579, 233.446, 477.542, 231.431);
-        ctx->bezierTo(477.777, 231.191, 478.402, 231.35, 478.873, 231.35);
-        ctx->bezierTo(478.803, 229.826, 480.501, 229.602, 480.937, 228.504);
-        ctx->bezierTo(481.1, 228.094, 480.835, 227.395, 481.07, 227.215);
-        ctx->bezierTo(484.845, 224.337, 486.469, 220.774, 484.405, 216.577);
-        ctx->bezierTo(483.902, 215.556, 483.462, 214.465, 482.463, 213.624);
-        ctx->bezierTo(480.547, 212.016, 478.601, 213.524, 476.753, 212.987);
-        ctx->bezierTo(476.472, 214.096, 475.185, 213.792, 474.503, 214.142);
-        ctx->bezierTo(472.987, 214.917, 470.633, 213.884, 469.116, 214.657);
-        ctx->bezierTo(466.712, 215.884, 464.52, 216.183, 462.01, 216.849);
-        ctx->bezierTo(461.459, 216.993, 460.085, 216.824, 459.803, 217.931);
-        ctx->bezierTo(459.566, 217.694, 459.305, 217.281, 459.117, 217.32);
-        ctx->bezierTo(455.749, 218.019, 453.524, 218.397, 451.227, 221.384);
-        ctx->bezierTo(451.045, 221.619, 450.265, 221.303, 449.984, 221.542);
-        ctx->bezierTo(448.294, 222.968, 447.579, 225.147, 445.635, 226.334);
-        ctx->bezierTo(445.28, 226.551, 444.659, 226.254, 444.316, 226.482);
-        ctx->bezierTo(443.175, 227.243, 442.527, 228.375, 441.394, 229.164);
-        ctx->bezierTo(440.813, 229.568, 440.107, 228.994, 440.163, 228.542);
-        ctx->bezierTo(440.596, 225.105, 441.749, 221.949, 440.734, 218.637);
-        ctx->bezierTo(444.401, 214.188, 448.845, 210.746, 452.034, 205.924);
-        ctx->bezierTo(452.06, 202.1, 453.282, 198.311, 453.082, 194.644);
-        ctx->bezierTo(453.065, 194.303, 452.556, 193.009, 452.334, 192.396);
-        ctx->bezierTo(451.783, 190.888, 453.383, 189.006, 451.892, 187.728);
-        ctx->bezierTo(449.413, 185.604, 447.132, 187.15, 445.677, 189.681);
-        ctx->bezierTo(442.432, 190.369, 438.784, 191.593, 435.998, 189.414);
-        ctx->bezierTo(434.22, 188.024, 433.2, 186.425, 431.789, 184.56);
-        ctx->bezierTo(430.05, 182.261, 430.641, 179.726, 430.765, 176.964);
-        ctx->bezierTo(430.775, 176.738, 430.219, 176.498, 430.219, 176.262);
-        ctx->bezierTo(430.221, 176.023, 430.609, 175.792, 430.846, 175.555);
-        ctx->bezierTo(429.599, 174.45, 429.114, 172.582, 427.315, 172.024);
-        ctx->bezierTo(427.853, 170.096, 426.66, 168.535, 425.122, 168.002);
-        ctx->bezierTo(421.599, 166.782, 418.638, 170.158, 415.298, 170.287);
-        ctx->bezierTo(414.39, 170.32, 413.566, 168.487, 412.42, 167.914);
-        ctx->bezierTo(411.657, 167.532, 410.414, 167.474, 409.775, 167.944);
-        ctx->bezierTo(408.56, 168.834, 407.52, 169.035, 406.182, 169.397);
-        ctx->bezierTo(403.327, 170.167, 401.07, 172.098, 398.457, 173.608);
-        ctx->bezierTo(395.835, 175.121, 394.149, 177.658, 392.242, 179.989);
-        ctx->bezierTo(390.58, 182.023, 390.34, 186.285, 392.847, 187.168);
-        ctx->bezierTo(396.102, 188.316, 398.404, 183.543, 401.875, 184.119);
-        ctx->bezierTo(402.426, 184.209, 402.79, 184.758, 402.596, 185.443);
-        ctx->bezierTo(403.282, 185.635, 403.667, 185.231, 404.008, 184.737);
-        ctx->bezierTo(405.523, 186.536, 407.578, 187.131, 409.234, 188.672);
-        ctx->bezierTo(410.947, 190.268, 414.03, 189.53, 415.822, 191.291);
-        ctx->bezierTo(418.522, 193.943, 417.535, 198.676, 420.958, 200.981);
-        ctx->bezierTo(419.924, 203.299, 418.852, 205.554, 418.26, 208.073);
-        ctx->bezierTo(417.762, 210.203, 419.518, 212.316, 421.656, 212.155);
-        ctx->bezierTo(423.877, 211.989, 424.34, 210.649, 425.196, 208.749);
-        ctx->bezierTo(425.667, 209.221, 426.495, 209.745, 426.423, 210.127);
-        ctx->bezierTo(425.616, 214.341, 423.803, 217.86, 422.994, 222.153);
-        ctx->bezierTo(422.89, 222.712, 422.351, 223.069, 421.665, 222.875);
-        ctx->bezierTo(420.838, 230.2, 413.684, 234.427, 409.19, 240.016);
-        ctx->bezierTo(408.479, 240.902, 408.472, 243.107, 409.194, 243.819);
-        ctx->bezierTo(411.671, 246.268, 415.132, 243.538, 418.133, 242.65);
-        ctx->bezierTo(418.509, 240.521, 420.026, 238.857, 422.378, 238.956);
-        ctx->bezierTo(422.83, 238.974, 423.245, 238.017, 423.817, 237.787);
-        ctx->bezierTo(424.431, 237.544, 425.318, 237.939, 425.823, 237.59);
-        ctx->bezierTo(428.875, 235.48, 431.362, 233.527, 434.43, 231.427);
-        ctx->bezierTo(434.769, 231.196, 435.377, 231.477, 435.758, 231.286);
-        ctx->bezierTo(436.332, 231, 436.662, 230.317, 437.232, 229.99);
-        ctx->bezierTo(437.847, 229.637, 438.274, 230.149, 438.615, 230.644);
-        ctx->bezierTo(437.474, 231.26, 437.467, 232.949, 436.44, 233.306);
-        ctx->bezierTo(435.071, 233.779, 434.081, 234.685, 432.891, 235.474);
-        ctx->bezierTo(432.375, 235.815, 431.211, 235.377, 431.028, 235.693);
-        ctx->bezierTo(429.972, 237.508, 427.881, 238.282, 426.628, 239.841);
-        ctx->closePath();
-    };
-    path_129();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_130 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(328.792, 152.602);
-        ctx->bezierTo(328.792, 152.602, 312.481, 147.531, 292.772, 192.859);
-        ctx->bezierTo(292.772, 192.859, 288.535, 202.04, 284.297, 205.571);
-        ctx->bezierTo(280.06, 209.103, 260.285, 215.459, 256.753, 222.522);
-        ctx->lineTo(238.39, 250.772);
-        ctx->bezierTo(238.39, 250.772, 264.522, 222.522, 270.172, 218.284);
-        ctx->bezierTo(270.172, 218.284, 284.297, 203.453, 278.647, 215.459);
-        ctx->bezierTo(278.647, 215.459, 253.928, 234.528, 256.047, 250.772);
-        ctx->bezierTo(256.047, 250.772, 246.159, 276.197, 244.747, 279.728);
-        ctx->bezierTo(244.747, 279.728, 272.997, 223.228, 277.235, 221.109);
-        ctx->bezierTo(281.472, 218.99, 283.591, 218.99, 281.472, 225.347);
-        ctx->bezierTo(279.353, 231.703, 278.647, 260.659, 273.703, 264.191);
-        ctx->bezierTo(273.703, 264.191, 287.829, 228.172, 286.416, 222.522);
-        ctx->bezierTo(286.416, 222.522, 292.066, 216.165, 296.304, 225.347);
-        ctx->lineTo(294.185, 253.597);
-        ctx->lineTo(301.954, 274.785);
-        ctx->bezierTo(301.954, 274.785, 297.716, 255.009, 300.541, 227.465);
-        ctx->bezierTo(300.541, 227.465, 297.01, 209.103, 304.073, 218.99);
-        ctx->bezierTo(311.135, 228.878, 328.085, 239.472, 328.085, 247.947);
-        ctx->bezierTo(328.085, 247.947, 318.904, 216.871, 302.66, 208.396);
-        ctx->lineTo(295.597, 218.99);
-        ctx->lineTo(293.479, 215.459);
-        ctx->bezierTo(293.479, 215.459, 287.122, 214.046, 294.891, 202.04);
-        ctx->bezierTo(302.66, 190.034, 301.954, 188.621, 301.954, 188.621);
-        ctx->bezierTo(301.954, 188.621, 313.254, 201.334, 316.079, 201.334);
-        ctx->bezierTo(316.079, 201.334, 339.385, 187.915, 341.504, 230.997);
-        ctx->bezierTo(341.504, 230.997, 353.511, 205.571, 337.267, 193.565);
-        ctx->bezierTo(337.267, 193.565, 311.135, 190.034, 313.254, 180.852);
-        ctx->lineTo(325.967, 158.958);
-        ctx->bezierTo(332.323, 149.777, 329.498, 154.721, 329.498, 154.721);
-        ctx->closePath();
-    };
-    path_130();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_131 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(293.479, 181.559);
-        ctx->lineTo(265.228, 190.74);
-        ctx->lineTo(252.516, 207.69);
-        ctx->bezierTo(252.516, 207.69, 282.885, 190.034, 289.947, 187.915);
-        ctx->bezierTo(297.01, 185.796, 293.479, 181.559, 293.479, 181.559);
-        ctx->closePath();
-    };
-    path_131();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_132 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(222.853, 192.859);
-        ctx->bezierTo(222.853, 192.859, 219.322, 194.977, 218.615, 199.921);
-        ctx->bezierTo(217.909, 204.865, 213.671, 205.571, 215.084, 210.515);
-        ctx->bezierTo(216.496, 215.459, 220.028, 219.696, 220.028, 212.634);
-        ctx->bezierTo(220.028, 205.571, 222.853, 202.04, 224.265, 199.921);
-        ctx->bezierTo(225.678, 197.802, 228.503, 190.034, 222.853, 192.859);
-        ctx->closePath();
-    };
-    path_132();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_133 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(207.315, 300.916);
-        ctx->bezierTo(207.315, 300.916, 192.484, 293.854, 186.834, 287.497);
-        ctx->bezierTo(181.184, 281.141, 181.982, 290.262, 173.415, 289.616);
-        ctx->bezierTo(163.091, 288.837, 164.94, 260.659, 164.94, 260.659);
-        ctx->lineTo(157.877, 274.078);
-        ctx->bezierTo(157.877, 274.078, 155.758, 299.504, 169.883, 295.266);
-        ctx->bezierTo(176.782, 293.197, 179.065, 295.972, 176.24, 297.385);
-        ctx->bezierTo(173.415, 298.797, 186.127, 299.504, 181.184, 302.329);
-        ctx->bezierTo(176.24, 305.154, 201.665, 295.972, 197.427, 314.335);
-        ctx->lineTo(207.315, 300.916);
-        ctx->closePath();
-    };
-    path_133();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_134 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(185.068, 326.342);
-        ctx->bezierTo(185.068, 326.342, 157.877, 334.11, 151.521, 317.16);
-        ctx->bezierTo(151.521, 317.16, 143.046, 321.398, 146.93, 326.695);
-        ctx->bezierTo(150.814, 331.992, 152.933, 332.698, 152.933, 332.698);
-        ctx->bezierTo(152.933, 332.698, 162.468, 334.817, 161.408, 336.229);
-        ctx->bezierTo(160.349, 337.642, 156.111, 343.645, 156.111, 343.645);
-        ctx->bezierTo(156.111, 343.645, 174.121, 333.051, 185.068, 326.342);
-        ctx->closePath();
-    };
-    path_134();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_135 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(588.342, 464.415);
-        ctx->bezierTo(587.582, 468.194, 584.634, 469.606, 581.279, 470.771);
-        ctx->bezierTo(577.889, 469.076, 573.316, 463.603, 569.979, 467.24);
-        ctx->bezierTo(569.149, 466.393, 567.772, 466.287, 567.154, 465.121);
-        ctx->bezierTo(566.342, 463.532, 566.818, 461.696, 566.218, 460.283);
-        ctx->bezierTo(565.247, 458.023, 564.011, 455.622, 564.329, 453.115);
-        ctx->bezierTo(567.525, 451.861, 568.566, 448.489, 567.736, 445.381);
-        ctx->bezierTo(567.613, 444.922, 566.854, 444.587, 567.207, 443.969);
-        ctx->bezierTo(567.542, 443.386, 568.09, 442.998, 568.566, 442.521);
-        ctx->bezierTo(568.337, 442.768, 568.072, 443.174, 567.878, 443.139);
-        ctx->bezierTo(566.801, 442.945, 567.013, 441.815, 567.242, 441.144);
-        ctx->bezierTo(568.284, 438.054, 571.833, 437.595, 574.216, 439.696);
-        ctx->bezierTo(574.675, 438.707, 575.576, 439.043, 576.335, 438.99);
-        ctx->bezierTo(576.247, 437.966, 576.971, 437.03, 577.324, 436.288);
-        ctx->bezierTo(578.242, 434.364, 581.102, 436.306, 582.515, 435.229);
-        ctx->bezierTo(584.422, 433.763, 586.293, 432.545, 588.2, 433.605);
-        ctx->bezierTo(591.396, 435.388, 594.415, 437.524, 596.534, 440.614);
-        ctx->bezierTo(597.541, 442.08, 597.964, 444.34, 597.858, 446.035);
-        ctx->bezierTo(597.788, 447.182, 595.351, 446.547, 594.751, 448.189);
-        ctx->bezierTo(593.603, 451.279, 596.852, 452.197, 598.176, 454.563);
-        ctx->bezierTo(598.529, 455.181, 598.07, 455.71, 597.505, 455.887);
-        ctx->bezierTo(596.781, 456.117, 595.404, 455.781, 595.634, 456.576);
-        ctx->bezierTo(597.364, 462.208, 592.491, 463.409, 588.342, 464.415);
-        ctx->closePath();
-    };
-    path_135();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_136 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(571.391, 499.022);
-        ctx->bezierTo(571.374, 495.95, 568.549, 492.86, 570.685, 489.84);
-        ctx->bezierTo(570.932, 490.088, 571.162, 490.476, 571.391, 490.476);
-        ctx->bezierTo(571.639, 490.476, 571.868, 490.088, 572.098, 489.84);
-        ctx->bezierTo(574.746, 493.76, 581.191, 495.385, 580.944, 500.417);
-        ctx->bezierTo(580.891, 501.211, 578.984, 502.836, 580.573, 503.966);
-        ctx->bezierTo(577.377, 506.349, 577.271, 510.534, 575.629, 513.853);
-        ctx->bezierTo(573.44, 513.359, 571.303, 512.705, 569.273, 511.734);
-        ctx->bezierTo(569.891, 509.121, 569.696, 506.137, 571.144, 503.807);
-        ctx->bezierTo(571.903, 502.571, 571.391, 500.664, 571.391, 499.022);
-        ctx->closePath();
-    };
-    path_136();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-
-    auto path_137 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(277.941, 483.131);
-        ctx->bezierTo(277.941, 483.131, 248.176, 501.035, 272.997, 473.95);
-        ctx->bezierTo(288.535, 456.999, 306.191, 447.112, 306.191, 447.112);
-        ctx->bezierTo(306.191, 447.112, 324.554, 439.343, 330.91, 437.224);
-        ctx->bezierTo(337.267, 435.105, 364.105, 425.924, 369.755, 425.218);
-        ctx->bezierTo(375.405, 424.511, 392.355, 417.449, 404.361, 424.511);
-        ctx->bezierTo(416.368, 431.574, 430.493, 439.343, 430.493, 439.343);
-        ctx->bezierTo(430.493, 439.343, 401.536, 424.511, 395.18, 428.749);
-        ctx->bezierTo(388.824, 432.987, 376.111, 432.28, 365.517, 437.93);
-        ctx->bezierTo(365.517, 437.93, 339.385, 445.699, 333.735, 449.231);
-        ctx->bezierTo(328.085, 452.762, 309.723, 473.243, 306.898, 471.831);
-        ctx->bezierTo(304.073, 470.418, 307.604, 469.712, 309.723, 464.768);
-        ctx->bezierTo(311.841, 459.824, 308.31, 456.999, 294.185, 468.299);
-        ctx->bezierTo(280.06, 479.6, 277.941, 483.131, 277.941, 483.131);
-        ctx->closePath();
-    };
-    path_137();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_138 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(291.016, 472.59);
-        ctx->bezierTo(291.016, 472.59, 293.505, 449.566, 308.474, 452.515);
-        ctx->bezierTo(308.474, 452.515, 322.998, 445.152, 327.805, 441.674);
-        ctx->bezierTo(327.805, 441.674, 342.175, 438.672, 344.488, 437.577);
-        ctx->bezierTo(377.116, 422.22, 403.104, 430.199, 404.07, 428.221);
-        ctx->bezierTo(405.034, 426.245, 439.685, 438.813, 446.057, 446.017);
-        ctx->bezierTo(446.747, 446.812, 427.993, 436.147, 410.869, 432.81);
-        ctx->bezierTo(396.262, 429.955, 358.121, 433.234, 338.865, 443.015);
-        ctx->bezierTo(333.615, 445.682, 317.822, 455.887, 313.353, 455.693);
-        ctx->bezierTo(308.884, 455.499, 291.016, 472.59, 291.016, 472.59);
-        ctx->closePath();
-    };
-    path_138();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_139 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(284.297, 517.738);
-        ctx->bezierTo(284.297, 517.738, 257.459, 513.5, 287.122, 510.675);
-        ctx->bezierTo(287.122, 510.675, 318.904, 507.144, 325.967, 497.962);
-        ctx->bezierTo(325.967, 497.962, 349.979, 481.718, 354.923, 481.012);
-        ctx->bezierTo(359.867, 480.306, 412.836, 467.593, 413.543, 463.356);
-        ctx->bezierTo(414.249, 459.118, 424.136, 459.118, 426.962, 460.531);
-        ctx->bezierTo(429.787, 461.943, 428.374, 464.062, 423.43, 465.474);
-        ctx->bezierTo(418.486, 466.887, 363.398, 495.844, 352.098, 497.962);
-        ctx->bezierTo(340.798, 500.081, 320.316, 513.5, 311.841, 515.619);
-        ctx->bezierTo(303.366, 517.738, 284.297, 517.738, 284.297, 517.738);
-        ctx->closePath();
-    };
-    path_139();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_140 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(318.763, 504.672);
-        ctx->bezierTo(318.763, 504.672, 303.61, 503.206, 318.796, 501.776);
-        ctx->bezierTo(318.796, 501.776, 334.362, 495.72, 337.978, 491.023);
-        ctx->bezierTo(337.978, 491.023, 350.274, 482.707, 352.804, 482.336);
-        ctx->bezierTo(355.336, 481.983, 379.985, 475.468, 380.347, 473.296);
-        ctx->bezierTo(380.709, 471.125, 440.857, 448.913, 448.661, 454.545);
-        ctx->bezierTo(453.801, 458.253, 436.319, 455.304, 419.309, 463.091);
-        ctx->bezierTo(416.917, 464.186, 357.144, 489.929, 351.358, 491.023);
-        ctx->bezierTo(345.572, 492.1, 335.086, 498.969, 330.746, 500.063);
-        ctx->bezierTo(326.408, 501.141, 318.763, 504.672, 318.763, 504.672);
-        ctx->closePath();
-    };
-    path_140();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_141 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(304.779, 508.556);
-        ctx->bezierTo(304.779, 508.556, 313.96, 507.85, 311.841, 510.675);
-        ctx->bezierTo(309.723, 513.5, 305.485, 512.088, 305.485, 512.088);
-        ctx->lineTo(304.779, 508.556);
-        ctx->closePath();
-    };
-    path_141();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_142 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(292.066, 511.381);
-        ctx->bezierTo(292.066, 511.381, 301.247, 510.675, 299.129, 513.5);
-        ctx->bezierTo(297.01, 516.325, 292.772, 514.913, 292.772, 514.913);
-        ctx->lineTo(292.066, 511.381);
-        ctx->closePath();
-    };
-    path_142();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_143 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(273.703, 514.206);
-        ctx->bezierTo(273.703, 514.206, 282.885, 513.5, 280.766, 516.325);
-        ctx->bezierTo(278.647, 519.15, 274.41, 517.738, 274.41, 517.738);
-        ctx->lineTo(273.703, 514.206);
-        ctx->closePath();
-    };
-    path_143();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_144 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(260.285, 515.619);
-        ctx->bezierTo(260.285, 515.619, 269.466, 514.913, 267.347, 517.738);
-        ctx->bezierTo(265.228, 520.563, 260.991, 519.15, 260.991, 519.15);
-        ctx->lineTo(260.285, 515.619);
-        ctx->closePath();
-    };
-    path_144();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_145 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(328.085, 445.699);
-        ctx->lineTo(333.735, 448.524);
-        ctx->bezierTo(331.617, 451.349, 325.967, 450.643, 325.967, 450.643);
-        ctx->lineTo(328.085, 445.699);
-        ctx->closePath();
-    };
-    path_145();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_146 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(310.429, 455.587);
-        ctx->bezierTo(310.429, 455.587, 321.916, 451.808, 317.491, 457.706);
-        ctx->bezierTo(315.373, 460.531, 311.135, 459.118, 311.135, 459.118);
-        ctx->lineTo(310.429, 455.587);
-        ctx->closePath();
-    };
-    path_146();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_147 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(290.654, 464.062);
-        ctx->bezierTo(290.654, 464.062, 299.835, 463.356, 297.716, 466.181);
-        ctx->bezierTo(295.597, 469.006, 291.36, 467.593, 291.36, 467.593);
-        ctx->lineTo(290.654, 464.062);
-        ctx->closePath();
-    };
-    path_147();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_148 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(277.235, 474.656);
-        ctx->bezierTo(277.235, 474.656, 286.416, 473.95, 284.297, 476.775);
-        ctx->bezierTo(282.179, 479.6, 277.941, 478.187, 277.941, 478.187);
-        ctx->lineTo(277.235, 474.656);
-        ctx->closePath();
-    };
-    path_148();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_149 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(265.228, 483.131);
-        ctx->bezierTo(265.228, 483.131, 274.41, 482.425, 272.291, 485.25);
-        ctx->bezierTo(270.172, 488.075, 265.935, 486.662, 265.935, 486.662);
-        ctx->lineTo(265.228, 483.131);
-        ctx->closePath();
-    };
-    path_149();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_150 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(334.233, 494.431);
-        ctx->bezierTo(334.233, 494.431, 346.453, 493.495, 343.634, 497.256);
-        ctx->bezierTo(340.814, 500.999, 335.173, 499.128, 335.173, 499.128);
-        ctx->lineTo(334.233, 494.431);
-        ctx->closePath();
-    };
-    path_150();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_151 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(352.596, 485.956);
-        ctx->bezierTo(352.596, 485.956, 364.816, 485.02, 361.996, 488.781);
-        ctx->bezierTo(359.177, 492.524, 353.535, 490.653, 353.535, 490.653);
-        ctx->lineTo(352.596, 485.956);
-        ctx->closePath();
-    };
-    path_151();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_152 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(371.665, 478.187);
-        ctx->bezierTo(371.665, 478.187, 383.885, 477.251, 381.065, 481.012);
-        ctx->bezierTo(378.246, 484.755, 372.604, 482.884, 372.604, 482.884);
-        ctx->lineTo(371.665, 478.187);
-        ctx->closePath();
-    };
-    path_152();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_153 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(390.028, 469.712);
-        ctx->bezierTo(390.028, 469.712, 402.248, 468.776, 399.428, 472.537);
-        ctx->bezierTo(396.608, 476.28, 390.967, 474.409, 390.967, 474.409);
-        ctx->lineTo(390.028, 469.712);
-        ctx->closePath();
-    };
-    path_153();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_154 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(341.296, 437.93);
-        ctx->bezierTo(341.296, 437.93, 353.516, 436.995, 350.696, 440.755);
-        ctx->bezierTo(347.876, 444.499, 340.823, 444.04, 340.823, 444.04);
-        ctx->lineTo(341.296, 437.93);
-        ctx->closePath();
-    };
-    path_154();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_155 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(358.952, 432.28);
-        ctx->bezierTo(358.952, 432.28, 371.172, 431.337, 368.353, 435.105);
-        ctx->bezierTo(365.533, 438.849, 357.773, 438.389, 357.773, 438.389);
-        ctx->lineTo(358.952, 432.28);
-        ctx->closePath();
-    };
-    path_155();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_156 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(318.904, 502.906);
-        ctx->bezierTo(318.904, 502.906, 328.085, 502.2, 325.967, 505.025);
-        ctx->bezierTo(323.848, 507.85, 319.61, 506.437, 319.61, 506.437);
-        ctx->lineTo(318.904, 502.906);
-        ctx->closePath();
-    };
-    path_156();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_157 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(189.659, 327.754);
-        ctx->bezierTo(189.659, 327.754, 181.89, 343.292, 181.184, 348.942);
-        ctx->bezierTo(181.184, 348.942, 182.596, 333.404, 184.715, 329.873);
-        ctx->bezierTo(186.834, 326.342, 189.659, 327.754, 189.659, 327.754);
-        ctx->closePath();
-    };
-    path_157();
-    ctx->setFillStyle(153, 38, 0, 255);
-    ctx->fill();
-
-    auto path_158 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(157.171, 352.473);
-        ctx->bezierTo(157.171, 352.473, 151.521, 377.898, 152.227, 382.842);
-        ctx->bezierTo(152.227, 382.842, 150.108, 362.361, 150.814, 360.242);
-        ctx->bezierTo(151.521, 358.123, 157.171, 352.473, 157.171, 352.473);
-        ctx->closePath();
-    };
-    path_158();
-    ctx->setFillStyle(153, 38, 0, 255);
-    ctx->fill();
-
-    auto path_159 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(193.896, 220.756);
-        ctx->lineTo(193.543, 226.406);
-        ctx->lineTo(189.659, 226.759);
-        ctx->bezierTo(189.659, 226.759, 214.731, 249.006, 215.79, 262.425);
-        ctx->bezierTo(215.79, 262.425, 217.203, 247.947, 193.896, 220.756);
-        ctx->closePath();
-    };
-    path_159();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_160 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(200.931, 222.989);
-        ctx->bezierTo(200.17, 222.255, 200.556, 220.94, 199.836, 220.48);
-        ctx->bezierTo(198.407, 219.569, 202.128, 219.469, 201.725, 218.205);
-        ctx->bezierTo(201.049, 216.075, 201.379, 216.038, 201.164, 213.785);
-        ctx->bezierTo(201.063, 212.729, 202.101, 210.01, 202.781, 209.233);
-        ctx->bezierTo(205.334, 206.316, 202.996, 201.14, 205.892, 198.401);
-        ctx->bezierTo(206.429, 197.891, 207.093, 196.916, 207.596, 196.178);
-        ctx->bezierTo(208.759, 194.478, 210.85, 193.616, 212.527, 192.154);
-        ctx->bezierTo(213.089, 191.667, 212.734, 190.207, 213.739, 190.369);
-        ctx->bezierTo(214.999, 190.572, 217.19, 190.343, 217.111, 191.828);
-        ctx->bezierTo(216.911, 195.571, 214.565, 198.608, 212.305, 201.553);
-        ctx->bezierTo(213.101, 202.796, 212.292, 203.917, 211.791, 204.9);
-        ctx->bezierTo(209.434, 209.526, 209.768, 214.543, 209.46, 219.557);
-        ctx->bezierTo(209.452, 219.707, 208.909, 219.845, 208.924, 219.938);
-        ctx->bezierTo(209.547, 224.061, 210.578, 227.944, 212.13, 231.879);
-        ctx->bezierTo(212.776, 233.522, 213.608, 235.102, 213.873, 236.739);
-        ctx->bezierTo(214.069, 237.95, 214.251, 239.421, 213.53, 240.665);
-        ctx->bezierTo(217.123, 245.768, 214.812, 250.449, 216.876, 256.683);
-        ctx->bezierTo(217.242, 257.787, 220.229, 261.166, 219.412, 260.882);
-        ctx->bezierTo(214.974, 259.344, 214.777, 258.641, 214.464, 257.312);
-        ctx->bezierTo(214.206, 256.212, 213.624, 253.781, 213.205, 252.718);
-        ctx->bezierTo(213.092, 252.428, 212.79, 249.102, 212.653, 248.886);
-        ctx->bezierTo(209.981, 244.68, 212.379, 244.991, 209.96, 240.828);
-        ctx->bezierTo(207.439, 239.627, 205.733, 237.678, 203.75, 235.626);
-        ctx->bezierTo(203.401, 235.266, 205.419, 233.988, 205.099, 233.612);
-        ctx->bezierTo(203.171, 231.336, 201.135, 229.981, 201.729, 227.345);
-        ctx->bezierTo(202.002, 226.127, 202.244, 224.261, 200.931, 222.989);
-        ctx->closePath();
-    };
-    path_160();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_161 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(194.602, 226.053);
-        ctx->bezierTo(194.602, 226.053, 195.309, 238.059, 199.546, 240.884);
-        ctx->bezierTo(203.784, 243.709, 201.665, 242.297, 196.015, 240.178);
-        ctx->bezierTo(190.365, 238.059, 192.484, 236.647, 192.484, 236.647);
-        ctx->bezierTo(192.484, 236.647, 187.54, 237.353, 191.777, 240.884);
-        ctx->bezierTo(196.015, 244.416, 202.371, 248.653, 199.546, 248.653);
-        ctx->bezierTo(196.721, 248.653, 183.302, 241.591, 183.302, 236.647);
-        ctx->bezierTo(183.302, 231.703, 181.537, 224.464, 181.537, 224.464);
-        ctx->bezierTo(181.537, 224.464, 183.479, 223.051, 191.954, 223.228);
-        ctx->bezierTo(191.954, 223.228, 194.426, 224.464, 194.602, 226.053);
-        ctx->closePath();
-    };
-    path_161();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_162 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(193.19, 258.894);
-        ctx->bezierTo(193.19, 258.894, 178.147, 253.966, 145.517, 259.953);
-        ctx->bezierTo(145.517, 259.953, 161.463, 256.284, 194.602, 260.306);
-        ctx->bezierTo(212.789, 262.513, 193.19, 258.894, 193.19, 258.894);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_162();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_162();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_163 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(196.894, 258.768);
-        ctx->bezierTo(196.894, 258.768, 182.335, 252.557, 149.308, 255.702);
-        ctx->bezierTo(149.308, 255.702, 165.513, 253.426, 198.18, 260.298);
-        ctx->bezierTo(216.108, 264.069, 196.894, 258.768, 196.894, 258.768);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_163();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_163();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_164 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(200.051, 258.933);
-        ctx->bezierTo(200.051, 258.933, 185.993, 251.656, 152.826, 252.336);
-        ctx->bezierTo(152.826, 252.336, 169.154, 251.27, 201.22, 260.554);
-        ctx->bezierTo(218.817, 265.647, 200.051, 258.933, 200.051, 258.933);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_164();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_164();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_165 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(202.294, 259.326);
-        ctx->bezierTo(202.294, 259.326, 190.245, 251.722, 160.451, 249.783);
-        ctx->bezierTo(160.451, 249.783, 175.175, 250.083, 203.215, 260.87);
-        ctx->bezierTo(218.605, 266.79, 202.294, 259.326, 202.294, 259.326);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_165();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_165();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_166 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(405.844, 277.894);
-        ctx->bezierTo(405.844, 277.894, 404.202, 279.031, 404.58, 276.946);
-        ctx->bezierTo(404.96, 274.861, 454.765, 251.607, 461.146, 252.048);
-        ctx->bezierTo(461.146, 252.048, 407.739, 275.366, 405.844, 277.894);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_166();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_166();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_167 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(399.852, 279.022);
-        ctx->bezierTo(399.852, 279.022, 398.305, 280.285, 398.519, 278.176);
-        ctx->bezierTo(398.732, 276.068, 446.558, 248.974, 452.954, 248.914);
-        ctx->bezierTo(452.954, 248.914, 401.543, 276.354, 399.852, 279.022);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_167();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_167();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_168 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(394.05, 281.45);
-        ctx->bezierTo(394.05, 281.45, 392.588, 282.813, 392.662, 280.694);
-        ctx->bezierTo(392.736, 278.577, 427.726, 251.215, 445.051, 247.906);
-        ctx->bezierTo(445.051, 247.906, 413.216, 262.256, 394.05, 281.45);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_168();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_168();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_169 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(388.972, 284.739);
-        ctx->bezierTo(388.972, 284.739, 387.656, 285.965, 387.724, 284.06);
-        ctx->bezierTo(387.791, 282.153, 419.279, 257.527, 434.872, 254.55);
-        ctx->bezierTo(434.872, 254.55, 406.222, 267.464, 388.972, 284.739);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_169();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_169();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_170 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(333.029, 545.988);
-        ctx->bezierTo(333.029, 545.988, 306.191, 541.75, 335.854, 538.925);
-        ctx->bezierTo(335.854, 538.925, 367.636, 535.394, 374.698, 526.213);
-        ctx->bezierTo(374.698, 526.213, 398.711, 509.969, 403.655, 509.262);
-        ctx->bezierTo(408.599, 508.556, 437.555, 502.2, 438.262, 497.962);
-        ctx->bezierTo(438.968, 493.725, 449.562, 489.487, 452.387, 490.9);
-        ctx->bezierTo(455.212, 492.312, 455.212, 508.556, 450.268, 509.969);
-        ctx->bezierTo(445.324, 511.381, 412.13, 524.094, 400.83, 526.213);
-        ctx->bezierTo(389.53, 528.331, 369.048, 541.75, 360.573, 543.869);
-        ctx->bezierTo(352.098, 545.988, 333.029, 545.988, 333.029, 545.988);
-        ctx->closePath();
-    };
-    path_170();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_171 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(461.921, 479.953);
-        ctx->bezierTo(461.921, 479.953, 456.624, 482.778, 454.506, 487.368);
-        ctx->bezierTo(454.506, 487.368, 443.205, 506.084, 418.133, 511.734);
-        ctx->bezierTo(418.133, 511.734, 377.523, 527.625, 363.751, 531.157);
-        ctx->bezierTo(363.751, 531.157, 340.092, 539.985, 327.026, 538.572);
-        ctx->bezierTo(327.026, 538.572, 314.666, 538.925, 325.613, 541.75);
-        ctx->bezierTo(325.613, 541.75, 361.279, 538.219, 367.283, 535.041);
-        ctx->bezierTo(367.283, 535.041, 394.827, 525.86, 400.124, 521.269);
-        ctx->bezierTo(405.421, 516.678, 437.555, 507.85, 441.44, 504.319);
-        ctx->bezierTo(445.324, 500.787, 462.628, 485.956, 461.921, 479.953);
-        ctx->closePath();
-    };
-    path_171();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_172 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(358.246, 535.588);
-        ctx->bezierTo(358.246, 535.588, 367.479, 535.182, 365.443, 537.919);
-        ctx->bezierTo(363.407, 540.656, 359.085, 539.12, 359.085, 539.12);
-        ctx->lineTo(358.246, 535.588);
-        ctx->closePath();
-    };
-    path_172();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_173 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(345.53, 537.972);
-        ctx->bezierTo(345.53, 537.972, 354.761, 537.583, 352.727, 540.32);
-        ctx->bezierTo(350.691, 543.057, 346.369, 541.503, 346.369, 541.503);
-        ctx->lineTo(345.53, 537.972);
-        ctx->closePath();
-    };
-    path_173();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_174 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(327.116, 540.179);
-        ctx->bezierTo(327.116, 540.179, 336.349, 539.773, 334.313, 542.51);
-        ctx->bezierTo(332.277, 545.246, 327.955, 543.71, 327.955, 543.71);
-        ctx->lineTo(327.116, 540.179);
-        ctx->closePath();
-    };
-    path_174();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_175 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(313.637, 541.15);
-        ctx->bezierTo(313.637, 541.15, 322.87, 540.744, 320.834, 543.481);
-        ctx->bezierTo(318.798, 546.217, 314.476, 544.664, 314.476, 544.664);
-        ctx->lineTo(313.637, 541.15);
-        ctx->closePath();
-    };
-    path_175();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_176 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(387.438, 522.522);
-        ctx->bezierTo(387.438, 522.522, 399.726, 521.993, 397.016, 525.63);
-        ctx->bezierTo(394.308, 529.285, 388.553, 527.219, 388.553, 527.219);
-        ctx->lineTo(387.438, 522.522);
-        ctx->closePath();
-    };
-    path_176();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_177 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(405.65, 514.718);
-        ctx->bezierTo(405.65, 514.718, 416.172, 508.892, 415.229, 517.826);
-        ctx->bezierTo(414.752, 522.328, 406.766, 519.415, 406.766, 519.415);
-        ctx->lineTo(405.65, 514.718);
-        ctx->closePath();
-    };
-    path_177();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_178 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(421.774, 509.739);
-        ctx->bezierTo(421.774, 509.739, 434.414, 503.206, 431.353, 512.864);
-        ctx->bezierTo(429.979, 517.173, 422.888, 514.453, 422.888, 514.453);
-        ctx->lineTo(421.774, 509.739);
-        ctx->closePath();
-    };
-    path_178();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_179 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(438.572, 501.229);
-        ctx->bezierTo(438.572, 501.229, 446.269, 492.577, 448.151, 504.336);
-        ctx->bezierTo(448.868, 508.821, 439.688, 505.925, 439.688, 505.925);
-        ctx->lineTo(438.572, 501.229);
-        ctx->closePath();
-    };
-    path_179();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_180 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(372.287, 530.45);
-        ctx->bezierTo(372.287, 530.45, 381.517, 530.044, 379.483, 532.781);
-        ctx->bezierTo(377.447, 535.518, 373.123, 533.982, 373.123, 533.982);
-        ctx->lineTo(372.287, 530.45);
-        ctx->closePath();
-    };
-    path_180();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_181 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(435.144, 316.106);
-        ctx->bezierTo(435.144, 316.106, 433.862, 317.28, 433.86, 315.389);
-        ctx->bezierTo(433.86, 313.5, 464.73, 290.08, 480.344, 287.637);
-        ctx->bezierTo(480.344, 287.637, 451.919, 299.518, 435.144, 316.106);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_181();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_181();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_182 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(440.38, 428.749);
-        ctx->bezierTo(440.38, 428.749, 479.226, 468.299, 495.47, 474.656);
-        ctx->bezierTo(495.47, 474.656, 511.713, 494.431, 504.65, 540.338);
-        ctx->bezierTo(504.65, 540.338, 499.002, 553.757, 493.352, 517.031);
-        ctx->bezierTo(493.352, 517.031, 499.002, 472.537, 479.226, 500.787);
-        ctx->bezierTo(479.226, 500.787, 464.393, 483.307, 475.693, 483.837);
-        ctx->bezierTo(475.693, 483.837, 481.345, 487.368, 482.051, 484.543);
-        ctx->bezierTo(482.758, 481.718, 468.631, 457.706, 438.262, 432.28);
-        ctx->bezierTo(407.893, 406.855, 440.38, 428.749, 440.38, 428.749);
-        ctx->closePath();
-    };
-    path_182();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_183 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(337.267, 497.256);
-        ctx->bezierTo(337.267, 497.256, 336.914, 494.078, 340.092, 495.49);
-        ctx->bezierTo(343.27, 496.903, 509.594, 507.85, 565.388, 550.225);
-        ctx->bezierTo(565.388, 550.225, 485.583, 509.262, 337.267, 497.256);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_183();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_183();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_184 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(355.629, 489.487);
-        ctx->bezierTo(355.629, 489.487, 355.276, 486.309, 358.454, 487.722);
-        ctx->bezierTo(361.633, 489.134, 602.82, 487.368, 644.489, 544.575);
-        ctx->bezierTo(644.489, 544.575, 605.645, 500.081, 355.629, 489.487);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_184();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_184();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_185 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(376.111, 482.425);
-        ctx->bezierTo(376.111, 482.425, 375.758, 479.247, 378.936, 480.659);
-        ctx->bezierTo(382.114, 482.072, 688.277, 459.118, 729.946, 516.325);
-        ctx->bezierTo(729.946, 516.325, 712.996, 471.125, 376.111, 482.425);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_185();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_185();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_186 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(393.767, 473.95);
-        ctx->bezierTo(393.767, 473.95, 393.414, 470.771, 396.592, 472.184);
-        ctx->bezierTo(399.771, 473.596, 615.533, 405.442, 657.202, 462.649);
-        ctx->bezierTo(657.202, 462.649, 633.542, 419.215, 393.767, 473.95);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_186();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_186();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_187 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(291.36, 514.206);
-        ctx->bezierTo(291.36, 514.206, 291.007, 511.028, 294.185, 512.441);
-        ctx->bezierTo(297.363, 513.853, 328.792, 517.738, 332.323, 586.245);
-        ctx->bezierTo(332.323, 586.245, 319.61, 512.088, 291.36, 514.206);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_187();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_187();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_188 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(275.822, 517.031);
-        ctx->bezierTo(275.822, 517.031, 275.469, 513.853, 278.647, 515.266);
-        ctx->bezierTo(281.825, 516.678, 306.898, 508.556, 301.954, 577.063);
-        ctx->bezierTo(301.954, 577.063, 304.073, 514.913, 275.822, 517.031);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_188();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_188();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_189 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(261.697, 517.738);
-        ctx->bezierTo(261.697, 517.738, 261.344, 514.559, 264.522, 515.972);
-        ctx->bezierTo(267.7, 517.384, 294.891, 518.444, 272.997, 557.994);
-        ctx->bezierTo(272.997, 557.994, 289.947, 515.619, 261.697, 517.738);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_189();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_189();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_190 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(345.258, 439.449);
-        ctx->bezierTo(345.258, 439.449, 344.474, 442.98, 347.209, 440.844);
-        ctx->bezierTo(375.579, 418.547, 432.861, 314.547, 531.189, 304.599);
-        ctx->bezierTo(531.189, 304.599, 463.544, 283.217, 345.267, 439.449);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_190();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_190();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_191 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(365.033, 436.271);
-        ctx->bezierTo(365.033, 436.271, 362.627, 434.17, 365.925, 433.075);
-        ctx->bezierTo(369.223, 431.962, 567.756, 303.953, 637.128, 318.018);
-        ctx->bezierTo(637.128, 318.018, 589.261, 304.758, 365.042, 436.271);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_191();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_191();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_192 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(328.235, 447.059);
-        ctx->bezierTo(328.235, 447.059, 327.337, 449.884, 330.358, 448.153);
-        ctx->bezierTo(346.204, 439.113, 352.587, 338.099, 429.529, 335.883);
-        ctx->bezierTo(429.529, 335.883, 372.302, 309.903, 328.235, 447.059);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_192();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_192();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_193 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(293.058, 466.516);
-        ctx->bezierTo(293.058, 466.516, 291.157, 468.794, 294.605, 468.335);
-        ctx->bezierTo(312.696, 465.986, 350.49, 393.122, 428.953, 402.09);
-        ctx->bezierTo(428.953, 402.09, 372.513, 376.76, 293.058, 466.516);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_193();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_193();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_194 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(312.901, 455.71);
-        ctx->bezierTo(312.901, 455.71, 311.469, 458.306, 314.769, 457.194);
-        ctx->bezierTo(332.07, 451.42, 355.172, 372.646, 433.899, 366.383);
-        ctx->bezierTo(433.899, 366.383, 373.644, 352.358, 312.901, 455.71);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_194();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_194();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_195 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(280.628, 475.556);
-        ctx->bezierTo(280.628, 475.556, 279.087, 477.393, 281.88, 477.039);
-        ctx->bezierTo(296.533, 475.133, 327.146, 416.107, 390.702, 423.371);
-        ctx->bezierTo(390.702, 423.371, 344.984, 402.854, 280.628, 475.556);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_195();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_195();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_196 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(267.211, 485.991);
-        ctx->bezierTo(267.211, 485.991, 265.437, 487.845, 268.246, 487.633);
-        ctx->bezierTo(275.605, 487.086, 329.701, 428.678, 362.309, 456.046);
-        ctx->bezierTo(362.309, 456.046, 341.095, 422.991, 267.211, 485.991);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_196();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_196();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_197 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(389.98, 429.628);
-        ctx->bezierTo(389.98, 429.628, 387.86, 427.236, 391.271, 426.556);
-        ctx->bezierTo(394.682, 425.878, 607.792, 323.977, 674.816, 346.694);
-        ctx->bezierTo(674.816, 346.694, 629.015, 327.494, 389.982, 429.628);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_197();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_197();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_198 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(330.91, 543.163);
-        ctx->bezierTo(330.91, 543.163, 330.557, 539.985, 333.735, 541.397);
-        ctx->bezierTo(336.914, 542.81, 364.105, 543.869, 342.21, 583.42);
-        ctx->bezierTo(342.21, 583.42, 359.161, 541.044, 330.91, 543.163);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_198();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_198();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_199 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(349.273, 540.338);
-        ctx->bezierTo(349.273, 540.338, 348.92, 537.16, 352.098, 538.572);
-        ctx->bezierTo(355.276, 539.985, 386.705, 543.869, 390.236, 612.376);
-        ctx->bezierTo(390.236, 612.376, 377.523, 538.219, 349.273, 540.338);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_199();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_199();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_200 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(361.279, 537.513);
-        ctx->bezierTo(361.279, 537.513, 360.926, 534.335, 364.105, 535.747);
-        ctx->bezierTo(367.283, 537.16, 410.718, 543.163, 452.387, 600.37);
-        ctx->bezierTo(452.387, 600.37, 389.53, 535.394, 361.279, 537.513);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_200();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_200();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_201 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(374.743, 533.929);
-        ctx->bezierTo(374.743, 533.929, 373.971, 530.821, 377.308, 531.81);
-        ctx->bezierTo(380.645, 532.781, 416.724, 529.426, 483.99, 589.776);
-        ctx->bezierTo(483.99, 589.776, 402.461, 528.084, 374.743, 533.929);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_201();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_201();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_202 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(393.105, 526.16);
-        ctx->bezierTo(393.105, 526.16, 392.334, 523.052, 395.671, 524.041);
-        ctx->bezierTo(399.008, 525.012, 460.512, 532.957, 551.793, 594.72);
-        ctx->bezierTo(551.793, 594.72, 420.824, 520.315, 393.105, 526.16);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_202();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_202();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_203 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(321.729, 505.731);
-        ctx->bezierTo(321.729, 505.731, 321.376, 502.553, 324.554, 503.966);
-        ctx->bezierTo(327.732, 505.378, 422.018, 509.969, 475.693, 557.288);
-        ctx->bezierTo(475.693, 557.288, 414.071, 513.553, 321.729, 505.731);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_203();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_203();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_204 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(304.073, 512.794);
-        ctx->bezierTo(304.073, 512.794, 303.719, 509.616, 306.898, 511.028);
-        ctx->bezierTo(310.076, 512.441, 353.511, 518.444, 395.18, 575.651);
-        ctx->bezierTo(395.18, 575.651, 332.323, 510.675, 304.073, 512.794);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_204();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_204();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_205 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(412.312, 518.02);
-        ctx->bezierTo(412.312, 518.02, 411.314, 514.983, 414.715, 515.725);
-        ctx->bezierTo(418.116, 516.449, 480.037, 519.856, 575.594, 574.768);
-        ctx->bezierTo(575.594, 574.768, 438.468, 514.03, 412.312, 518.02);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_205();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_205();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_206 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(427.143, 513.783);
-        ctx->bezierTo(427.143, 513.783, 426.146, 510.746, 429.546, 511.487);
-        ctx->bezierTo(432.947, 512.211, 494.868, 515.619, 590.425, 570.53);
-        ctx->bezierTo(590.425, 570.53, 454.359, 509.086, 427.143, 513.783);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_206();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_206();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_207 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(444.094, 504.954);
-        ctx->bezierTo(444.094, 504.954, 443.096, 501.917, 446.497, 502.659);
-        ctx->bezierTo(449.897, 503.383, 525.944, 511.028, 684.364, 571.59);
-        ctx->bezierTo(684.364, 571.59, 471.322, 500.258, 444.095, 504.954);
-        ctx->closePath();
-    };
-    ctx->setLineWidth(0.177);
-    path_207();
-    ctx->setFillStyle(255, 255, 255, 255);
-    ctx->fill();
-    path_207();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_208 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(247.572, 517.031);
-        ctx->bezierTo(247.572, 517.031, 256.753, 516.325, 254.634, 519.15);
-        ctx->bezierTo(252.516, 521.975, 248.278, 520.563, 248.278, 520.563);
-        ctx->lineTo(247.572, 517.031);
-        ctx->closePath();
-    };
-    path_208();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_209 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(301.954, 541.75);
-        ctx->bezierTo(301.954, 541.75, 311.135, 541.044, 309.016, 543.869);
-        ctx->bezierTo(306.898, 546.694, 302.66, 545.282, 302.66, 545.282);
-        ctx->lineTo(301.954, 541.75);
-        ctx->closePath();
-    };
-    path_209();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_210 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(286.416, 541.044);
-        ctx->bezierTo(286.416, 541.044, 295.597, 540.338, 293.479, 543.163);
-        ctx->bezierTo(291.36, 545.988, 287.122, 544.575, 287.122, 544.575);
-        ctx->lineTo(286.416, 541.044);
-        ctx->closePath();
-    };
-    path_210();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_211 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(118.026, 520.174);
-        ctx->bezierTo(118.026, 520.174, 126.943, 522.505, 124.012, 524.482);
-        ctx->bezierTo(121.081, 526.46, 117.532, 523.741, 117.532, 523.741);
-        ctx->lineTo(118.026, 520.174);
-        ctx->closePath();
-    };
-    path_211();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_212 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(121.558, 503.224);
-        ctx->bezierTo(121.558, 503.224, 130.474, 505.555, 127.543, 507.532);
-        ctx->bezierTo(124.612, 509.51, 121.063, 506.791, 121.063, 506.791);
-        ctx->lineTo(121.558, 503.224);
-        ctx->closePath();
-    };
-    path_212();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_213 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(108.845, 495.455);
-        ctx->bezierTo(108.845, 495.455, 117.762, 497.786, 114.831, 499.763);
-        ctx->bezierTo(111.9, 501.741, 108.351, 499.022, 108.351, 499.022);
-        ctx->lineTo(108.845, 495.455);
-        ctx->closePath();
-    };
-    path_213();
-    ctx->setFillStyle(0, 0, 0, 255);
-    ctx->fill();
-
-    auto path_214 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(249.691, 627.914);
-        ctx->lineTo(239.803, 631.445);
-        ctx->bezierTo(236.272, 631.445, 216.496, 637.802, 206.609, 655.458);
-        ctx->bezierTo(206.609, 655.458, 228.503, 638.508, 249.691, 627.914);
-        ctx->closePath();
-    };
-    path_214();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_215 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(404.566, 791.501);
-        ctx->bezierTo(404.815, 791.942, 404.912, 792.684, 405.428, 792.719);
-        ctx->bezierTo(406.589, 792.79, 408.767, 793.32, 408.546, 792.207);
-        ctx->bezierTo(407.049, 784.597, 405.505, 775.875, 398.208, 772.697);
-        ctx->bezierTo(397.08, 772.203, 394.534, 772.926, 394.403, 774.498);
-        ctx->bezierTo(394.179, 777.182, 393.972, 779.565, 394.518, 782.143);
-        ctx->bezierTo(395.047, 784.668, 398.858, 784.668, 400.477, 782.231);
-        ctx->bezierTo(402.129, 785.18, 402.892, 788.446, 404.566, 791.501);
-        ctx->closePath();
-    };
-    path_215();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_216 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(385.006, 799.853);
-        ctx->bezierTo(386.327, 802.342, 386.103, 805.626, 388.601, 806.633);
-        ctx->bezierTo(389.908, 807.145, 393.174, 805.432, 392.436, 803.525);
-        ctx->bezierTo(391.02, 799.888, 390.335, 795.933, 387.882, 792.737);
-        ctx->bezierTo(387.529, 792.278, 387.953, 791.342, 387.671, 790.759);
-        ctx->bezierTo(386.622, 788.605, 384.6, 787.299, 382.114, 787.881);
-        ctx->bezierTo(380.145, 791.766, 382.172, 795.527, 384.86, 798.546);
-        ctx->bezierTo(385.1, 798.811, 384.807, 799.482, 385.006, 799.853);
-        ctx->closePath();
-    };
-    path_216();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_217 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(315.083, 790.689);
-        ctx->bezierTo(314.892, 790.018, 314.825, 789.206, 315.117, 788.641);
-        ctx->bezierTo(316.054, 786.822, 317.454, 784.845, 316.859, 783.026);
-        ctx->bezierTo(316.245, 781.172, 314.274, 781.49, 313.127, 782.496);
-        ctx->bezierTo(311.123, 784.244, 311.036, 787.475, 309.816, 789.877);
-        ctx->bezierTo(309.47, 790.548, 309.56, 791.572, 308.782, 792.26);
-        ctx->bezierTo(307.945, 793.002, 307.168, 795.686, 307.337, 796.692);
-        ctx->bezierTo(307.431, 797.257, 307.108, 814.737, 307.5, 814.278);
-        ctx->bezierTo(308.593, 812.989, 313.978, 795.792, 314.1, 794.22);
-        ctx->bezierTo(314.2, 792.931, 315.493, 792.119, 315.083, 790.689);
-        ctx->closePath();
-    };
-    path_217();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_218 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(269.815, 778.7);
-        ctx->bezierTo(274.466, 774.286, 279.392, 769.06, 278.612, 762.509);
-        ctx->bezierTo(278.407, 760.779, 275.273, 761.715, 274.943, 763.198);
-        ctx->bezierTo(273.527, 769.607, 269.927, 774.304, 265.393, 778.524);
-        ctx->bezierTo(261.515, 782.143, 258.228, 793.337, 257.813, 794.238);
-        ctx->bezierTo(264.34, 784.951, 268.325, 780.113, 269.815, 778.7);
-        ctx->closePath();
-    };
-    path_218();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_219 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(245.849, 768.177);
-        ctx->bezierTo(246.772, 767.506, 246.239, 766.641, 246.622, 766.058);
-        ctx->bezierTo(248.305, 763.48, 250.602, 761.291, 250.633, 758.219);
-        ctx->bezierTo(250.639, 757.724, 249.971, 757.177, 249.38, 757.583);
-        ctx->bezierTo(248.891, 757.901, 248.287, 758.13, 248.096, 758.36);
-        ctx->bezierTo(244.512, 762.686, 242.04, 767.4, 239.492, 772.361);
-        ctx->bezierTo(239.169, 772.997, 237.149, 780.925, 237.702, 781.119);
-        ctx->bezierTo(238.124, 781.278, 241.161, 773.898, 241.532, 773.686);
-        ctx->bezierTo(243.762, 772.485, 243.783, 769.625, 245.849, 768.177);
-        ctx->closePath();
-    };
-    path_219();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_220 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(275.393, 802.678);
-        ctx->bezierTo(276.177, 801.141, 278.96, 799.023, 278.76, 797.451);
-        ctx->bezierTo(278.552, 795.809, 279.378, 793.267, 277.768, 794.485);
-        ctx->bezierTo(275.549, 796.145, 269.459, 798.528, 268.982, 808.787);
-        ctx->bezierTo(268.936, 809.793, 274.187, 805.044, 275.393, 802.678);
-        ctx->closePath();
-    };
-    path_220();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_221 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(300.894, 772.344);
-        ctx->bezierTo(301.601, 771.161, 302.851, 772.008, 303.661, 771.532);
-        ctx->bezierTo(304.805, 770.878, 305.884, 769.89, 306.4, 768.742);
-        ctx->bezierTo(308.112, 764.963, 311.236, 761.75, 311.488, 757.512);
-        ctx->bezierTo(308.856, 755.04, 307.657, 758.642, 306.544, 760.337);
-        ctx->bezierTo(304.208, 757.424, 302.445, 760.743, 300.149, 761.662);
-        ctx->bezierTo(300.026, 761.715, 299.65, 761.097, 299.517, 761.15);
-        ctx->bezierTo(297.439, 761.926, 296.238, 763.833, 294.476, 765.211);
-        ctx->bezierTo(294.174, 765.44, 293.459, 765.122, 293.2, 765.369);
-        ctx->bezierTo(292.048, 766.429, 290.331, 767.012, 289.836, 768.212);
-        ctx->bezierTo(287.876, 772.979, 282.332, 776.687, 279, 790);
-        ctx->bezierTo(279.673, 791.607, 286.967, 778.276, 287.827, 777.04);
-        ctx->bezierTo(289.303, 774.922, 289.511, 779.971, 291.764, 778.806);
-        ctx->bezierTo(291.854, 778.753, 292.183, 779.177, 292.419, 779.406);
-        ctx->bezierTo(292.762, 778.912, 293.147, 778.506, 293.832, 778.7);
-        ctx->bezierTo(293.832, 777.994, 293.595, 777.005, 293.95, 776.74);
-        ctx->bezierTo(296.134, 775.01, 295.986, 773.121, 297.363, 770.931);
-        ctx->bezierTo(298.172, 772.326, 300.045, 771.055, 300.894, 772.344);
-        ctx->closePath();
-    };
-    path_221();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_222 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(406.48, 868.395);
-        ctx->bezierTo(406.48, 868.395, 419.546, 832.376, 411.777, 812.601);
-        ctx->bezierTo(411.777, 812.601, 431.905, 850.738, 423.783, 870.514);
-        ctx->bezierTo(423.783, 870.514, 423.077, 852.151, 416.015, 843.323);
-        ctx->bezierTo(416.015, 843.323, 408.952, 865.923, 406.48, 868.395);
-        ctx->closePath();
-    };
-    path_222();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_223 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(380.348, 863.804);
-        ctx->bezierTo(380.348, 863.804, 389.883, 848.267, 375.758, 815.779);
-        ctx->bezierTo(375.758, 815.779, 374.345, 851.798, 362.339, 871.22);
-        ctx->bezierTo(362.339, 871.22, 387.411, 835.554, 380.348, 863.804);
-        ctx->closePath();
-    };
-    path_223();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_224 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(362.692, 860.273);
-        ctx->bezierTo(362.692, 860.273, 362.339, 824.96, 363.045, 819.663);
-        ctx->bezierTo(363.045, 819.663, 356.336, 848.973, 338.326, 865.923);
-        ctx->bezierTo(338.326, 865.923, 363.751, 844.735, 362.692, 860.273);
-        ctx->closePath();
-    };
-    path_224();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_225 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(345.742, 803.772);
-        ctx->bezierTo(345.742, 803.772, 356.336, 827.785, 338.679, 860.273);
-        ctx->bezierTo(338.679, 860.273, 349.979, 838.732, 341.504, 826.373);
-        ctx->bezierTo(341.504, 826.373, 346.095, 820.369, 345.742, 803.772);
-        ctx->closePath();
-    };
-    path_225();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_226 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(311.841, 859.567);
-        ctx->bezierTo(311.841, 859.567, 310.076, 832.023, 313.254, 828.138);
-        ctx->bezierTo(313.254, 828.138, 313.607, 816.838, 312.901, 815.072);
-        ctx->bezierTo(312.901, 815.072, 319.963, 804.125, 320.316, 817.191);
-        ctx->bezierTo(320.316, 817.191, 322.788, 830.963, 327.732, 839.085);
-        ctx->bezierTo(327.732, 839.085, 334.089, 848.62, 333.735, 859.92);
-        ctx->bezierTo(333.735, 859.92, 316.079, 806.597, 311.841, 859.567);
-        ctx->closePath();
-    };
-    path_226();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_227 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(305.485, 810.835);
-        ctx->bezierTo(305.485, 810.835, 293.832, 829.904, 290.654, 863.451);
-        ctx->bezierTo(290.654, 863.451, 288.182, 852.504, 294.891, 827.079);
-        ctx->bezierTo(294.891, 827.079, 302.307, 799.888, 305.485, 810.835);
-        ctx->closePath();
-    };
-    path_227();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_228 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(266.994, 845.795);
-        ctx->bezierTo(266.994, 845.795, 275.822, 836.26, 278.294, 827.432);
-        ctx->bezierTo(278.294, 827.432, 284.65, 799.535, 273.35, 814.719);
-        ctx->bezierTo(273.35, 814.719, 273.703, 828.844, 259.225, 841.91);
-        ctx->bezierTo(259.225, 841.91, 267.7, 837.673, 266.994, 845.795);
-        ctx->closePath();
-    };
-    path_228();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_229 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(256.753, 836.966);
-        ctx->bezierTo(256.753, 836.966, 262.756, 806.244, 264.169, 804.832);
-        ctx->bezierTo(264.169, 804.832, 267.347, 798.828, 262.403, 804.479);
-        ctx->bezierTo(262.403, 804.479, 246.866, 838.379, 239.803, 850.032);
-        ctx->bezierTo(239.803, 850.032, 253.928, 833.788, 256.753, 836.966);
-        ctx->closePath();
-    };
-    path_229();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_230 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(246.512, 807.657);
-        ctx->bezierTo(246.512, 807.657, 266.994, 768.106, 228.503, 813.66);
-        ctx->bezierTo(228.503, 813.66, 247.925, 796.357, 246.512, 807.657);
-        ctx->closePath();
-    };
-    path_230();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_231 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(219.322, 781.878);
-        ctx->bezierTo(219.322, 781.878, 227.797, 748.684, 232.387, 749.037);
-        ctx->lineTo(235.212, 751.862);
-        ctx->bezierTo(235.212, 751.862, 224.618, 768.812, 225.678, 786.116);
-        ctx->bezierTo(225.678, 786.116, 224.618, 769.166, 219.322, 781.878);
-        ctx->closePath();
-    };
-    path_231();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_232 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(802.514, 761.75);
-        ctx->bezierTo(802.514, 761.75, 781.327, 744.093, 776.913, 737.914);
-        ctx->bezierTo(776.913, 737.914, 800.749, 770.578, 800.749, 782.938);
-        ctx->bezierTo(800.749, 782.938, 805.163, 769.695, 802.514, 761.75);
-        ctx->closePath();
-    };
-    path_232();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_233 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(812.226, 722.906);
-        ctx->bezierTo(812.226, 722.906, 775.147, 696.421, 768.967, 683.179);
-        ctx->bezierTo(768.967, 683.179, 815.757, 735.265, 815.757, 743.211);
-        ctx->bezierTo(815.757, 743.211, 816.64, 727.32, 812.226, 722.906);
-        ctx->closePath();
-    };
-    path_233();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_234 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(842.242, 450.996);
-        ctx->bezierTo(842.242, 450.996, 821.054, 436.871, 818.405, 440.402);
-        ctx->bezierTo(818.405, 440.402, 836.945, 451.879, 841.359, 466.887);
-        ctx->bezierTo(841.359, 466.887, 838.71, 450.996, 842.242, 450.996);
-        ctx->closePath();
-    };
-    path_234();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_235 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(857.25, 593.131);
-        ctx->lineTo(826.351, 571.943);
-        ctx->bezierTo(826.351, 571.943, 859.898, 601.959, 860.781, 609.022);
-        ctx->lineTo(857.25, 593.131);
-        ctx->closePath();
-    };
-    path_235();
-    ctx->setFillStyle(204, 204, 204, 255);
-    ctx->fill();
-
-    auto path_236 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(167.323, 553.404);
-        ctx->lineTo(206.167, 561.79);
-    };
-    path_236();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_237 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(256.047, 839.438);
-        ctx->bezierTo(256.047, 839.438, 255.164, 833.259, 239.273, 851.798);
-    };
-    path_237();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_238 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(265.758, 848.267);
-        ctx->bezierTo(265.758, 848.267, 269.289, 836.79, 257.813, 844.735);
-    };
-    path_238();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-    auto path_239 = [&]() {
-        ctx->beginPath();
-        ctx->moveTo(361.103, 863.275);
-        ctx->bezierTo(361.103, 863.275, 363.751, 843.852, 343.446, 866.806);
-    };
-    path_239();
-    ctx->setStrokeStyle(0, 0, 0, 255);
-    ctx->stroke();
-
-}
@@ -160,6 +160,13 @@ macro(bitloop_new_project sim_name)
 	if (EXISTS "${CMAKE_CURRENT_SOURCE_DIR}/data")
 		list(APPEND _data_dirs "${CMAKE_CURRENT_SOURCE_DIR}/data")
 	endif()
+
+	# Add converted SVGs (if queued by bitloop_add_svg)
+	get_property(_svg_files DIRECTORY ${CMAKE_CURRENT_LIST_DIR} PROPERTY BITLOOP_SVG_FILES)
+	if (_svg_files)
+		_bitloop_convert_svgs(${_TARGET} "${CMAKE_CURRENT_BINARY_DIR}/svg_data" ${_svg_files})
+		list(APPEND _data_dirs "${CMAKE_CURRENT_BINARY_DIR}/svg_data")
+	endif()
 	set_property(GLOBAL PROPERTY BITLOOP_DATA_DEPENDENCIES ${_data_dirs})
 
 
@@ -209,6 +216,11 @@ macro(bitloop_new_project sim_name)
 		msg(STATUS "")
 
 		apply_main_settings(${_TARGET})
+
+		if (NOT EMSCRIPTEN)
+			# Renders every project on the software canvas (no window/GL), fails on a blank frame
+			add_test(NAME headless_render COMMAND ${_TARGET} --headless --size 640x360)
+		endif()
 	endif()
 
 endmacro()
@@ -240,6 +252,42 @@ function(_bitloop_add_dependency _TARGET _SIM_DIR)
 	target_link_libraries(${_TARGET} PUBLIC ${sim_name}::${sim_name})
 endfunction()
 
+# Queues SVGs to be converted to packed vector paths (<name>.blvg in /data) when bitloop_new_project gets called
+macro(bitloop_add_svg)
+	foreach(_svg ${ARGN})
+		get_filename_component(_svg_path "${_svg}" REALPATH BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+		set_property(DIRECTORY ${CMAKE_CURRENT_LIST_DIR} APPEND PROPERTY BITLOOP_SVG_FILES "${_svg_path}")
+	endforeach()
+endmacro()
+
+# Converts SVGs with svg2blvg at build time, before the target (internal)
+function(_bitloop_convert_svgs _TARGET _OUT_DIR)
+	if (TARGET svg2blvg)
+		set(_tool svg2blvg)
+	else()
+		set(_tool bitloop::svg2blvg)
+	endif()
+
+	set(_outputs "")
+	foreach(_svg IN LISTS ARGN)
+		get_filename_component(_name "${_svg}" NAME_WE)
+		set(_out "${_OUT_DIR}/${_name}.blvg")
+
+		add_custom_command(
+			OUTPUT "${_out}"
+			COMMAND ${CMAKE_COMMAND} -E make_directory "${_OUT_DIR}"
+			COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:${_tool}> "${_svg}" "${_out}"
+			DEPENDS "${_svg}" ${_tool}
+			COMMENT "Converting ${_name}.svg to packed vector paths"
+			VERBATIM
+		)
+		list(APPEND _outputs "${_out}")
+	endforeach()
+
+	add_custom_target(${_TARGET}_svg_data DEPENDS ${_outputs})
+	add_dependencies(${_TARGET} ${_TARGET}_svg_data)
+endfunction()
+
 
 # --- msg() helper with indentation push/pop support ---
 set_property(GLOBAL PROPERTY MSG_INDENT_LEVEL 0)
@@ -643,6 +643,36 @@ struct NVGvertex {
 };
 typedef struct NVGvertex NVGvertex;
 
+// Draws a triangle list (x, y in the current transform, u, v into image) with the current
+// fill color multiplied by the image, as one draw call. Used to batch sprites (e.g. circles)
+// (bitloop extension).
+void nvgFillTriangles(NVGcontext* ctx, const NVGvertex* verts, int nverts, int image);
+
+// Text layout caching (bitloop extension)
+//
+// Everything a shaped run depends on. Runs shaped with equal state (ignoring atlasGeneration)
+// are identical, and stay drawable until atlasGeneration changes (glyphs evicted from the atlas).
+struct NVGtextLayoutState {
+	int fontId;
+	int align;
+	int flipped;
+	int atlasGeneration;
+	float size;
+	float spacing;
+	float blur;
+	float scale; // Font scale from the transform * device pixel ratio
+};
+typedef struct NVGtextLayoutState NVGtextLayoutState;
+
+void nvgTextLayoutState(NVGcontext* ctx, NVGtextLayoutState* out);
+
+// Shapes a run at the origin into glyph quads (6 vertices each, in device pixels, textured from
+// the font atlas). Needs up to 6 vertices per byte of text. Returns the number of vertices written.
+int nvgTextLayout(NVGcontext* ctx, const char* string, const char* end, NVGvertex* verts, int maxVerts);
+
+// Draws quads from nvgTextLayout() at x,y with the current fill, as nvgText() would.
+void nvgTextLayoutDraw(NVGcontext* ctx, float x, float y, const NVGvertex* verts, int nverts);
+
 struct NVGpath {
 	int first;
 	int count;
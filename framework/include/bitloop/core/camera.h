@@ -125,7 +125,23 @@ private:
 
 public:
 
-    static inline Camera* active = nullptr;
+    // Per thread, so viewports can be processed in parallel (see SceneBase::parallel_viewport_process)
+    static inline thread_local Camera* active = nullptr;
+
+    // Sets 'active' for a scope, restoring the previous camera on exit. Tasks must use this, as
+    // TaskGroup::wait() may run other tasks (e.g. another scene's) nested on the same thread
+    class ActiveScope
+    {
+        Camera* previous;
+
+    public:
+
+        explicit ActiveScope(Camera* camera) : previous(active) { active = camera; }
+        ~ActiveScope() { active = previous; }
+
+        ActiveScope(const ActiveScope&) = delete;
+        ActiveScope& operator=(const ActiveScope&) = delete;
+    };
 
 public:
 
@@ -12,6 +12,12 @@
 //#define DEBUG_SIMULATE_DPR 2.625f
 
 
+/// ======== Project switching ========
+// Also build the projects either side of the active one (in the project tree) in the
+// background, so switching to them is instant
+constexpr bool PREWARM_NEIGHBOUR_PROJECTS = true;
+
+
 /// ======== Timer filters ========
 
 #define TIMERS_ENABLED
@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+#include "debug.h"
+
+BL_BEGIN_NS
+
+struct ProjectInfo;
+
+// Runs projects without a window or GL context, drawing on the SOFTWARE canvas backend
+// (e.g. for CI or GPU-less servers). Started by passing --headless to bitloop_main()
+class HeadlessRunner
+{
+public:
+
+    struct Options
+    {
+        std::string project;            // Last part of the project's path (e.g. "Tiger"), empty = every project
+        int width = 1280, height = 720;
+        int frames = 8;                 // Frames processed before the last is checked (progressive scenes refine over several)
+        double frame_budget_ms = 250.0; // Per frame, generous so progressive passes complete
+        std::string output;             // Optional binary PPM of the last frame (needs --project)
+    };
+
+    // --headless [--project NAME] [--size WxH] [--frames N] [--out FILE]
+    // Returns false if --headless wasn't passed
+    [[nodiscard]] static bool parseArgs(int argc, char* argv[], Options& options);
+
+    // Returns a process exit code, non-zero if a project couldn't run or drew a blank frame
+    [[nodiscard]] static int run(const Options& options);
+
+private:
+
+    // Drives the project as the worker & GUI threads do (friend of ProjectBase)
+    [[nodiscard]] static int renderProject(const ProjectInfo& info, const Options& options);
+};
+
+BL_END_NS
@@ -29,6 +29,7 @@ class MainWindow
     bool vertical_layout = false;
 
     bool need_draw = false;
+    double canvas_draw_ms = -1.0; // Cost of drawing the last frame (-1 if none drawn)
 
     ToolbarButtonState play = { ImVec4(0.1f, 0.6f, 0.1f, 1.0f), ImVec4(1, 1, 1, 1), false };
     ToolbarButtonState stop = { ImVec4(0.6f, 0.1f, 0.1f, 1.0f), ImVec4(1, 1, 1, 1), false };
@@ -57,6 +58,10 @@ public:
         return &canvas;
     }
 
+    [[nodiscard]] double lastCanvasDrawMs() const {
+        return canvas_draw_ms;
+    }
+
     void init();
     void checkChangedDPR();
 
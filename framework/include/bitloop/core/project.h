@@ -117,6 +117,11 @@ protected:
     int scene_index = -1;
     std::vector<Viewport*> mounted_to_viewports;
 
+    // Opt-in: viewportProcess() only touches this scene and its viewport (no shared project
+    // state), so the scene's viewports may be processed on the task pool, in parallel with
+    // other scenes. Viewports sharing a scene are still processed in order
+    bool parallel_viewport_process = false;
+
     // Mounting to/from viewport
     void registerMount(Viewport* viewport);
     void registerUnmount(Viewport* viewport);
@@ -126,12 +131,10 @@ protected:
     virtual void _sceneAttributes() {}
 
     // In case Scene uses double buffer
-    virtual void updateLiveBuffers() {}
-    virtual void updateShadowBuffers() {}
-    virtual bool changedLive() { return false; }
-    virtual bool changedShadow() { return false; }
-    virtual void markLiveValues() {}
-    virtual void markShadowValues() {}
+    virtual bool pullShadowChanges() { return false; } // Worker thread
+    virtual void pushLiveChanges() {}                   // Worker thread
+    virtual void pullLiveChanges() {}                   // GUI thread
+    virtual void pushShadowChanges() {}                 // GUI thread
 
     //
     
@@ -202,6 +205,16 @@ public:
 
     [[nodiscard]] double fps(int average_samples = 1) const { return 1000.0 / frame_dt(average_samples); }
 
+    // Deadline for this frame's compute (from the frame budget), after which progressive
+    // work should yield so the display keeps presenting at its refresh rate
+    [[nodiscard]] std::chrono::steady_clock::time_point frameDeadline() const;
+    [[nodiscard]] int frameBudgetRemainingMs() const; // >= 1
+
+    // Fraction of full resolution the canvas currently renders at (1 unless the project enables
+    // dynamic_resolution). Stage coordinates are unaffected, bitmaps can be computed at this
+    // fraction of their stage size and stretched over it
+    [[nodiscard]] double resolutionScale() const;
+
     ///FRect combinedViewportsRect()
     ///{
     ///    FRect ret{};
@@ -256,12 +269,10 @@ protected:
 
 private:
 
-    void updateLiveBuffers() override final   { DoubleBuffer<VarBufferType>::updateLiveBuffer(); }
-    void updateShadowBuffers() override final { DoubleBuffer<VarBufferType>::updateShadowBuffer(); }
-    void markLiveValues() override final      { DoubleBuffer<VarBufferType>::markLiveValues();   }
-    void markShadowValues() override final    { DoubleBuffer<VarBufferType>::markShadowValues(); }
-    bool changedLive() override final         { return DoubleBuffer<VarBufferType>::changedLive(); }
-    bool changedShadow() override final       { return DoubleBuffer<VarBufferType>::changedShadow(); }
+    bool pullShadowChanges() override final { return DoubleBuffer<VarBufferType>::pullShadowChanges(); }
+    void pushLiveChanges() override final   { DoubleBuffer<VarBufferType>::pushLiveChanges(); }
+    void pullLiveChanges() override final   { DoubleBuffer<VarBufferType>::pullLiveChanges(); }
+    void pushShadowChanges() override final { DoubleBuffer<VarBufferType>::pushShadowChanges(); }
 };
 
 class Viewport : public Painter
@@ -432,6 +443,7 @@ class ProjectBase
     Layout viewports;
     int scene_counter = 0;
     int sim_uid = -1;
+    bool layout_prepared = false; // Prepared (e.g. in the background) but not yet started
 
     int dt_projectProcess = 0;
     double dt_frameProcess = 0;
@@ -439,12 +451,17 @@ class ProjectBase
     std::chrono::steady_clock::time_point last_frame_time 
         = std::chrono::steady_clock::now();
 
+    // Set by the worker from the frame budget before each process
+    std::chrono::steady_clock::time_point frame_deadline
+        = std::chrono::steady_clock::time_point::max();
+
     Viewport* ctx_focused = nullptr;
     Viewport* ctx_hovered = nullptr;
 
 protected:
 
     friend class ProjectWorker;
+    friend class HeadlessRunner;
     friend class Layout;
     friend class SceneBase;
 
@@ -456,6 +473,18 @@ protected:
     bool paused = false;
     bool done_single_process = false;
 
+    // Frames the worker may record ahead of the GUI (see FramePipeline). Draw calls are
+    // recorded into a display list on the worker, so replaying one doesn't read live scene
+    // state. Frames which draw an Image are still drawn in lockstep (pixels upload at replay)
+    int pipeline_depth = 2;
+
+    // Opt-in: the canvas renders at reduced resolution while interacting or over budget (see
+    // DynamicResolution). Scenes can match bitmap computes to resolutionScale()
+    bool dynamic_resolution = false;
+
+    // Records the frame-level draw calls (background, clipping, splitters) while recording
+    SimplePainter frame_painter;
+
     void configure(int sim_uid, Canvas* canvas, ImDebugLog* project_log);
 
     [[nodiscard]] DVec2 surfaceSize(); // Dimensions of canvas (or FBO if recording)
@@ -468,51 +497,33 @@ protected:
     virtual void updateProjectLiveBuffer() {}
     virtual void updateProjectShadowBuffer() {}
 
-    // Exposed methods for updating project (and contained scenes)
-    // live/shadow buffers from project_worker.
+    // Exposed methods for syncing project (and contained scenes)
+    // live/shadow buffers from project_worker (live) and main_window (shadow).
     // 
     // Even if this is a BasicProject (no double buffer), Scenes might
     // still inherit DoubleBuffer if they inherit DoubleBuffer
 
-    virtual void updateLiveBuffers()
+    virtual bool pullShadowChanges()
     {
+        bool applied = false;
         for (SceneBase* scene : viewports.all_scenes)
-            scene->updateLiveBuffers();
+            applied |= scene->pullShadowChanges();
+        return applied;
     }
-    virtual void updateShadowBuffers()
+    virtual void pushLiveChanges()
     {
         for (SceneBase* scene : viewports.all_scenes)
-            scene->updateShadowBuffers();
-    }
-
-    virtual bool changedLive()
-    {
-        for (SceneBase* scene : viewports.all_scenes) {
-            if (scene->changedLive())
-                return true;
-        }
-        return false;
-    }
-
-    virtual bool changedShadow()
-    {
-        for (SceneBase* scene : viewports.all_scenes) {
-            if (scene->changedShadow())
-                return true;
-        }
-        return false;
+            scene->pushLiveChanges();
     }
-
-    virtual void markLiveValues()
+    virtual void pullLiveChanges()
     {
         for (SceneBase* scene : viewports.all_scenes)
-            scene->markLiveValues();
+            scene->pullLiveChanges();
     }
-
-    virtual void markShadowValues()
+    virtual void pushShadowChanges()
     {
         for (SceneBase* scene : viewports.all_scenes)
-            scene->markShadowValues();
+            scene->pushShadowChanges();
     }
 
     // ---- Project Management ----
@@ -522,7 +533,8 @@ protected:
     void _projectPause();
     void _projectDestroy();
     void _projectProcess();
-    void _projectDraw();
+    void _projectRecord(DisplayList& list); // Worker thread
+    void _projectDraw(SimplePainter* ctx);
 
     std::vector<FingerInfo> pressed_fingers;
     void _onEvent(SDL_Event& e);
@@ -732,6 +744,9 @@ public:
 
     [[nodiscard]] int fboWidth() { return canvas->fboWidth(); }
     [[nodiscard]] int fboHeight() { return canvas->fboHeight(); }
+    [[nodiscard]] double resolutionScale() const { return canvas->resolutionScale(); }
+
+    [[nodiscard]] std::chrono::steady_clock::time_point frameDeadline() const { return frame_deadline; }
 
     virtual std::vector<std::string> categorize()
     {
@@ -772,30 +787,26 @@ protected:
         DoubleBuffer<VarBufferType>::shadow_attributes.populate();
     }
 
-    void updateLiveBuffers() override
+    bool pullShadowChanges() override
     {
-        ProjectBase::updateLiveBuffers(); // call on Scenes
-        DoubleBuffer<VarBufferType>::updateLiveBuffer();
+        bool applied = ProjectBase::pullShadowChanges(); // call on Scenes
+        applied |= DoubleBuffer<VarBufferType>::pullShadowChanges();
+        return applied;
     }
-    void updateShadowBuffers() override
+    void pushLiveChanges() override
     {
-        ProjectBase::updateShadowBuffers(); // call on Scenes
-        DoubleBuffer<VarBufferType>::updateShadowBuffer();
+        ProjectBase::pushLiveChanges(); // call on Scenes
+        DoubleBuffer<VarBufferType>::pushLiveChanges();
     }
-    void markLiveValues() override
+    void pullLiveChanges() override
     {
-        ProjectBase::markLiveValues(); // call on Scenes
-        DoubleBuffer<VarBufferType>::markLiveValues();
+        ProjectBase::pullLiveChanges(); // call on Scenes
+        DoubleBuffer<VarBufferType>::pullLiveChanges();
     }
-    void markShadowValues() override
-    { 
-        ProjectBase::markShadowValues(); // call on Scenes
-        DoubleBuffer<VarBufferType>::markShadowValues();
-    }
-    bool changedShadow() override
-    { 
-        if (ProjectBase::changedShadow()) return true; // call on Scenes
-        return DoubleBuffer<VarBufferType>::changedShadow();
+    void pushShadowChanges() override
+    {
+        ProjectBase::pushShadowChanges(); // call on Scenes
+        DoubleBuffer<VarBufferType>::pushShadowChanges();
     }
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "threads.h"
+#include "display_list.h"
 #include <SDL3/SDL.h>
 
 BL_BEGIN_NS
@@ -41,15 +42,42 @@ class ProjectWorker
     static ProjectWorker* singleton;
 
 
-    std::vector<SDL_Event> input_event_queue;
-    std::mutex event_queue_mutex;
+    // Input events: GUI thread (producer) -> worker thread (consumer)
+    Thread::SPSCRing<SDL_Event, 1024> input_events;
+    std::vector<SDL_Event> staged_events; // GUI thread only, awaiting flushEvents()
 
     std::thread worker_thread;
 
     ProjectBase* active_project = nullptr;
 
-    std::vector<ProjectCommandEvent> project_command_queue;
+    // One per frame slot: recorded by the worker, replayed by the GUI (see FramePipeline)
+    DisplayList display_lists[FramePipeline::frame_slots];
 
+    // GUI thread only. Hash of the list last drawn to the canvas, so an identical frame
+    // (nothing moved) can be presented without redrawing it
+    size_t drawn_hash = 0;
+    bool drawn_valid = false;
+
+    std::mutex project_command_mutex;
+    std::vector<ProjectCommandEvent> project_command_queue; // Pushed by GUI thread
+    std::vector<ProjectCommandEvent> pending_commands;      // Worker thread only, waiting on a project build
+
+    // Project constructed & prepared on a background task (requested, or pre-warmed)
+    struct ProjectBuild
+    {
+        int uid;
+        ProjectBase* project = nullptr;
+        Thread::TaskGroup task;
+    };
+
+    std::vector<std::unique_ptr<ProjectBuild>> project_builds; // Worker thread only
+
+    ProjectBuild* requestBuild(int uid, Thread::Priority priority);
+    ProjectBase* takeBuild(int uid);
+    void prewarmNeighbours(int uid);
+    void releaseBuilds();
+
+    void processProjectCommands();
     void _destroyActiveProject();
 
     void _onEvent(SDL_Event& e);
@@ -63,7 +91,9 @@ protected:
     friend class MainWindow;
     friend class ProjectBase;
 
-    void draw();
+    void draw();                              // Replay the frame being drawn
+    [[nodiscard]] bool frameUnchanged();      // Frame being drawn is already on the canvas
+    void invalidateDrawnFrame() { drawn_valid = false; }
     void populateAttributes();
 
 public:
@@ -74,6 +104,7 @@ public:
 
     ProjectWorker(SharedSync& _shared_sync) : shared_sync(_shared_sync) {
         singleton = this;
+        staged_events.reserve(64);
     }
 
     // ======== Thread Control ========
@@ -84,19 +115,27 @@ public:
     // ======== Events / Data ========
     void handleProjectCommands(ProjectCommandEvent& e);
 
-    void pushDataToShadow();       // Feed Live data to shadow buffer (i.e. Queue it)
-    void pullDataFromShadow();     // Process queued events
+    void pushDataToShadow();       // Publish changed live data to shadow buffer
+    bool pullDataFromShadow();     // Apply UI edits to live buffer (returns true if any)
 
-    void queueEvent(const SDL_Event& event); // Feed SDL event to event queue
-    void pollEvents(bool discardBatch);      // Process queued data (*if* modified by ImGui inputs)
+    void queueEvent(const SDL_Event& event); // Feed SDL event to event queue (motion is coalesced)
+    void flushEvents();                      // Publish staged events to the worker (after polling SDL)
+    void pollEvents(bool discardBatch);      // Process queued events (discarded if ImGui modified data)
 
     // ======== Project Control ========
     [[nodiscard]] ProjectBase* getActiveProject() { return active_project; }
 
-    void setActiveProject(int uid)  { project_command_queue.push_back({ ProjectCommandType::PROJECT_SET,   uid }); }
-    void startProject()             { project_command_queue.push_back({ ProjectCommandType::PROJECT_START, ProjectID::CURRENT_PROJECT }); }
-    void stopProject()              { project_command_queue.push_back({ ProjectCommandType::PROJECT_STOP,  ProjectID::CURRENT_PROJECT }); }
-    void pauseProject()             { project_command_queue.push_back({ ProjectCommandType::PROJECT_PAUSE, ProjectID::CURRENT_PROJECT }); }
+    void queueProjectCommand(ProjectCommandEvent e)
+    {
+        std::lock_guard<std::mutex> lock(project_command_mutex);
+        project_command_queue.push_back(e);
+    }
+
+    // The current project keeps running until a newly set project has been built in the background
+    void setActiveProject(int uid)  { queueProjectCommand({ ProjectCommandType::PROJECT_SET,   uid }); }
+    void startProject()             { queueProjectCommand({ ProjectCommandType::PROJECT_START, ProjectID::CURRENT_PROJECT }); }
+    void stopProject()              { queueProjectCommand({ ProjectCommandType::PROJECT_STOP,  ProjectID::CURRENT_PROJECT }); }
+    void pauseProject()             { queueProjectCommand({ ProjectCommandType::PROJECT_PAUSE, ProjectID::CURRENT_PROJECT }); }
 };
 
 BL_END_NS
\ No newline at end of file
@@ -8,10 +8,18 @@
 #include <future>
 #include <functional>
 #include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <chrono>
+#include <cmath>
 
 #include <vector>
 #include <queue>
 #include <deque>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <type_traits>
 
 #if defined(__EMSCRIPTEN__)
 #include <emscripten/threading.h>
@@ -23,7 +31,6 @@
 #include <sys/types.h>
 #endif
 
-#include "BS_thread_pool.hpp"
 #include "concurrentqueue/concurrentqueue.h"
 
 #define BL_BEGIN_NS namespace BL {
@@ -36,12 +43,6 @@ namespace Thread
     using moodycamel::ConcurrentQueue;
     using moodycamel::BlockingConcurrentQueue;
 
-    [[nodiscard]] static BS::thread_pool<BS::tp::none>& pool()
-    {
-        static BS::thread_pool pool;
-        return pool;
-    }
-
     [[nodiscard]] inline unsigned int idealThreadCount()
     {
         // 1. Try the standard C++ hint
@@ -104,53 +105,756 @@ namespace Thread
 
         return { start, start + size };   // [start, end)
     }
+
+    /// ======== SPSC ring ========
+
+    // Fixed-capacity lock-free queue for exactly one producer thread and one consumer thread
+    template<typename T, size_t Capacity>
+    class SPSCRing
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static constexpr size_t mask = Capacity - 1;
+
+        alignas(64) std::atomic<size_t> head{ 0 }; // Next slot to write (producer)
+        alignas(64) std::atomic<size_t> tail{ 0 }; // Next slot to read (consumer)
+        alignas(64) T slots[Capacity];
+
+    public:
+
+        // Producer
+        [[nodiscard]] bool push(const T& value)
+        {
+            const size_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) == Capacity)
+                return false;
+
+            slots[h & mask] = value;
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer
+        [[nodiscard]] bool pop(T& out)
+        {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_acquire))
+                return false;
+
+            out = slots[t & mask];
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer (snapshot, more may arrive)
+        [[nodiscard]] size_t size() const
+        {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+        }
+    };
+
+    /// ======== Topology ========
+
+    enum struct CoreClass
+    {
+        PERFORMANCE,
+        EFFICIENCY     // Hybrid CPUs (Intel E-cores, ARM LITTLE cores)
+    };
+
+    struct LogicalCore
+    {
+        int id = 0;    // OS index (Windows: group * 64 + index within group)
+        int numa_node = 0;
+        CoreClass core_class = CoreClass::PERFORMANCE;
+    };
+
+    struct Topology
+    {
+        std::vector<LogicalCore> cores; // Cores this process is allowed to run on
+        int numa_nodes = 1;
+        bool hybrid = false;
+        bool can_pin = false;
+
+        [[nodiscard]] const LogicalCore* find(int id) const
+        {
+            for (const LogicalCore& core : cores)
+                if (core.id == id) return &core;
+            return nullptr;
+        }
+    };
+
+    [[nodiscard]] const Topology& topology(); // Detected once, on first use
+    [[nodiscard]] int currentCore();           // -1 if unknown
+    bool pinCurrentThread(int core_id);
+
+    /// ======== Scheduler config ========
+
+    struct Config
+    {
+        int  thread_count = 0;              // 0 = one worker per usable core
+        bool pin_workers = false;           // Pin each worker to its own logical core
+        bool use_efficiency_cores = true;   // Also place workers on efficiency cores
+    };
+
+    // Must be called before the scheduler is first used (returns false if it's already running)
+    bool configure(const Config& config);
+    [[nodiscard]] const Config& config();
+
+    /// ======== Task scheduling ========
+    //
+    // Single pool of worker threads shared by everything. Each task has a priority class,
+    // and idle workers always take the highest class available:
+    //
+    //  INTERACTIVE:  compute for the frame being shown while the user interacts
+    //  PROGRESSIVE:  refinement of an already-presented frame
+    //  BACKGROUND:   caching, encoding, decoding... (keep tasks short, they aren't preempted)
+    //
+    // Tasks submitted from a worker go to that worker's local queue (taken LIFO for locality,
+    // stolen FIFO by idle workers), other threads submit to the global queues.
+
+    enum struct Priority
+    {
+        INTERACTIVE,
+        PROGRESSIVE,
+        BACKGROUND,
+        COUNT
+    };
+
+    class Scheduler;
+
+    // Tracks completion of a set of tasks. wait() helps run queued tasks rather than just
+    // blocking, so it's safe to wait on a group from within a task. cancel() skips any of
+    // the group's tasks which haven't started yet.
+    class TaskGroup
+    {
+        friend class Scheduler;
+
+        std::atomic<int> pending{ 0 };
+        std::atomic<bool> cancelled{ false };
+        std::atomic<int> help_limit{ 0 }; // Least urgent priority submitted (wait() only helps up to this)
+
+        std::mutex error_mutex;
+        std::exception_ptr error;
+
+    public:
+
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup&) = delete;
+        ~TaskGroup()
+        {
+            try { wait(); }
+            catch (...) {} // Nobody left to report to
+        }
+
+        void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+        [[nodiscard]] bool isCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+        [[nodiscard]] bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+        void wait(); // Rethrows the first exception thrown by a task
+    };
+
+    class Scheduler
+    {
+        struct Task
+        {
+            std::function<void()> fn;
+            TaskGroup* group = nullptr;
+        };
+
+        using TaskQueues = std::deque<Task>[(int)Priority::COUNT];
+
+        struct Worker
+        {
+            std::mutex mutex;
+            TaskQueues local;
+            std::thread thread;
+
+            LogicalCore core;
+            bool pinned = false;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        std::mutex global_mutex;
+        TaskQueues global;
+
+        std::mutex sleep_mutex;
+        std::condition_variable sleep_cv;
+        std::atomic<int> queued{ 0 };
+        std::atomic<bool> stopping{ false };
+
+        static int& workerIndex()
+        {
+            static thread_local int index = -1;
+            return index;
+        }
+
+        static bool popFront(std::deque<Task>& q, Task& out)
+        {
+            if (q.empty()) return false;
+            out = std::move(q.front());
+            q.pop_front();
+            return true;
+        }
+
+        static bool popBack(std::deque<Task>& q, Task& out)
+        {
+            if (q.empty()) return false;
+            out = std::move(q.back());
+            q.pop_back();
+            return true;
+        }
+
+        bool takeTask(Task& out, Priority max_priority = Priority::BACKGROUND)
+        {
+            if (queued.load(std::memory_order_acquire) == 0)
+                return false;
+
+            const int self = workerIndex();
+            const int n = (int)workers.size();
+
+            for (int p = 0; p <= (int)max_priority; p++)
+            {
+                // 1. Own queue (most recently pushed, likely still in cache)
+                if (self >= 0)
+                {
+                    std::lock_guard<std::mutex> lock(workers[self]->mutex);
+                    if (popBack(workers[self]->local[p], out)) break;
+                }
+
+                // 2. Global queue
+                {
+                    std::lock_guard<std::mutex> lock(global_mutex);
+                    if (popFront(global[p], out)) break;
+                }
+
+                // 3. Steal oldest task from another worker
+                bool stolen = false;
+                for (int i = 1; i <= n && !stolen; i++)
+                {
+                    int victim = (self + i + n) % n;
+                    if (victim == self) continue;
+                    std::lock_guard<std::mutex> lock(workers[victim]->mutex);
+                    stolen = popFront(workers[victim]->local[p], out);
+                }
+                if (stolen) break;
+            }
+
+            if (!out.fn)
+                return false;
+
+            queued.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+
+        static void runTask(Task& task)
+        {
+            TaskGroup* group = task.group;
+            if (!group || !group->isCancelled())
+            {
+                try {
+                    task.fn();
+                }
+                catch (...) {
+                    if (!group) throw;
+                    std::lock_guard<std::mutex> lock(group->error_mutex);
+                    if (!group->error) group->error = std::current_exception();
+                }
+            }
+
+            finishTask(group);
+        }
+
+        static void finishTask(TaskGroup* group)
+        {
+            if (group && group->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                group->pending.notify_all();
+        }
+
+        // Drop tasks which never started (cancelling their groups), so nothing waits on them forever
+        void discardQueued()
+        {
+            for (;;)
+            {
+                Task task;
+                if (!takeTask(task))
+                    break;
+
+                if (task.group)
+                    task.group->cancel();
+                finishTask(task.group);
+            }
+        }
+
+        void workerLoop(int index)
+        {
+            workerIndex() = index;
+
+            if (workers[index]->pinned)
+                workers[index]->pinned = pinCurrentThread(workers[index]->core.id);
+
+            while (!stopping.load(std::memory_order_relaxed))
+            {
+                Task task;
+                if (takeTask(task))
+                {
+                    runTask(task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                sleep_cv.wait(lock, [this] {
+                    return queued.load(std::memory_order_acquire) > 0 || stopping.load();
+                });
+            }
+        }
+
+    public:
+
+        explicit Scheduler(const Config& config)
+        {
+            const Topology& topo = topology();
+
+            // Performance cores first, so they're used before efficiency cores when there are fewer workers than cores
+            std::vector<LogicalCore> usable;
+            for (CoreClass core_class : { CoreClass::PERFORMANCE, CoreClass::EFFICIENCY })
+            {
+                if (core_class == CoreClass::EFFICIENCY && !config.use_efficiency_cores && !usable.empty())
+                    break;
+
+                for (const LogicalCore& core : topo.cores)
+                    if (core.core_class == core_class) usable.push_back(core);
+            }
+            if (usable.empty())
+                usable.push_back(LogicalCore{});
+
+            int thread_count = config.thread_count > 0 ? config.thread_count : (int)usable.size();
+            for (int i = 0; i < thread_count; i++)
+            {
+                auto worker = std::make_unique<Worker>();
+                worker->core = usable[i % usable.size()];
+                worker->pinned = config.pin_workers && topo.can_pin;
+                workers.push_back(std::move(worker));
+            }
+
+            for (int i = 0; i < (int)workers.size(); i++)
+                workers[i]->thread = std::thread(&Scheduler::workerLoop, this, i);
+        }
+
+        ~Scheduler()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+                stopping.store(true);
+            }
+            sleep_cv.notify_all();
+
+            // Queued tasks won't run once the workers stop. Discard again after joining, for
+            // anything submitted by tasks which were still running
+            discardQueued();
+            for (auto& w : workers)
+                w->thread.join();
+            discardQueued();
+        }
+
+        [[nodiscard]] int threadCount() const { return (int)workers.size(); }
+
+        // Index of the calling worker thread, or -1 if not called from a worker
+        [[nodiscard]] static int currentWorker() { return workerIndex(); }
+
+        // Class of core the calling thread is running on (fixed for pinned workers)
+        [[nodiscard]] CoreClass currentCoreClass() const
+        {
+            const int self = workerIndex();
+            if (self >= 0 && workers[self]->pinned)
+                return workers[self]->core.core_class;
+
+            if (!topology().hybrid)
+                return CoreClass::PERFORMANCE;
+
+            const LogicalCore* core = topology().find(currentCore());
+            return core ? core->core_class : CoreClass::PERFORMANCE;
+        }
+
+        template<typename F>
+        void submit(Priority priority, F&& fn, TaskGroup* group = nullptr)
+        {
+            if (group)
+            {
+                group->pending.fetch_add(1, std::memory_order_relaxed);
+
+                int limit = group->help_limit.load(std::memory_order_relaxed);
+                while (limit < (int)priority && !group->help_limit.compare_exchange_weak(limit, (int)priority));
+            }
+
+            Task task{ std::function<void()>(std::forward<F>(fn)), group };
+
+            const int self = workerIndex();
+            if (self >= 0)
+            {
+                std::lock_guard<std::mutex> lock(workers[self]->mutex);
+                workers[self]->local[(int)priority].push_back(std::move(task));
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(global_mutex);
+                global[(int)priority].push_back(std::move(task));
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+                queued.fetch_add(1, std::memory_order_release);
+            }
+            sleep_cv.notify_one();
+        }
+
+        // Run one queued task (no less urgent than max_priority) on the calling thread
+        bool runOne(Priority max_priority = Priority::BACKGROUND)
+        {
+            Task task;
+            if (!takeTask(task, max_priority))
+                return false;
+
+            runTask(task);
+            return true;
+        }
+    };
+
+    [[nodiscard]] Scheduler& scheduler(); // Started on first use with config()
+
+    [[nodiscard]] inline int workerCount() { return scheduler().threadCount(); }
+    [[nodiscard]] inline CoreClass currentCoreClass() { return scheduler().currentCoreClass(); }
+
+    template<typename F>
+    void submit(Priority priority, F&& fn, TaskGroup* group = nullptr)
+    {
+        scheduler().submit(priority, std::forward<F>(fn), group);
+    }
+
+    inline void TaskGroup::wait()
+    {
+        int remaining;
+        while ((remaining = pending.load(std::memory_order_acquire)) != 0)
+        {
+            // Don't let an urgent wait get stuck running less urgent work (e.g. a background project build)
+            if (!scheduler().runOne((Priority)help_limit.load(std::memory_order_relaxed)))
+                pending.wait(remaining, std::memory_order_acquire);
+        }
+
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+
+    /// ======== NUMA first-touch ========
+    //
+    // Pages are placed on the NUMA node of the thread which first writes to them. Buffers which
+    // are filled by all workers should be allocated with FirstTouchAllocator (so resize() doesn't
+    // touch the memory) and initialized with parallelFill(), spreading them across the nodes
+    // instead of placing them all on the node of whichever thread resized them.
+
+    template<typename T>
+    struct FirstTouchAllocator : std::allocator<T>
+    {
+        template<typename U> struct rebind { using other = FirstTouchAllocator<U>; };
+
+        FirstTouchAllocator() noexcept = default;
+        template<typename U> FirstTouchAllocator(const FirstTouchAllocator<U>&) noexcept {}
+
+        // Default-initialize (no write for trivial types) rather than value-initialize
+        template<typename U>
+        void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+    };
+
+    template<typename T>
+    void parallelFill(T* data, size_t count, const T& value, Priority priority = Priority::INTERACTIVE)
+    {
+        constexpr size_t min_block_bytes = 64 * 1024;
+        size_t blocks = std::min<size_t>(workerCount(), std::max<size_t>(1, count * sizeof(T) / min_block_bytes));
+
+        if (blocks <= 1)
+        {
+            std::fill(data, data + count, value);
+            return;
+        }
+
+        TaskGroup group;
+        for (auto [first, last] : splitRanges(count, blocks))
+            submit(priority, [=, &value]() { std::fill(data + first, data + last, value); }, &group);
+        group.wait();
+    }
 }
 
+/// ======== Frame pipeline ========
+//
+// The worker records frames, the GUI draws them. Each recorded frame gets a
+// generation number and one of 'frame_slots' slots (generation % frame_slots):
+//
+//   [ drawing (N) ] [ queued (N+1) ] [ recording (N+2) ]
+//
+// Back-pressure: the worker blocks *before* recording a frame while 'depth'
+// recorded frames are still undrawn. Frames are never dropped (simulations
+// advance per frame), so worker-to-screen latency is bounded by 'depth' frames.
+//
+//  depth == 1:  lockstep. Draw reads live project state, so it can't overlap processing
+//  depth == 2:  pipelined. Draw only replays its slot's display list, the worker records the next frame meanwhile
+
+struct FramePipeline
+{
+    static constexpr int max_depth = 2;
+    static constexpr int frame_slots = max_depth + 1;
+
+    int depth = 1;
+    uint64_t recorded = 0; // Frames published by worker
+    uint64_t drawn = 0;    // Frames drawn by GUI
+
+    [[nodiscard]] int inFlight() const { return static_cast<int>(recorded - drawn); }
+    [[nodiscard]] bool full() const { return inFlight() >= depth; }
+    [[nodiscard]] bool frameQueued() const { return recorded > drawn; }
+
+    [[nodiscard]] int recordSlot() const { return static_cast<int>(recorded % frame_slots); }
+    [[nodiscard]] int drawSlot() const { return static_cast<int>(drawn % frame_slots); }
+};
+
+// Decides how long the worker may spend computing each frame, so the display keeps
+// presenting at its refresh rate while the rest of the frame goes to progressive work.
+//
+//  GUI thread:     reportGuiFrame()  (vsync interval & canvas draw time)
+//  Worker thread:  beginWorkerFrame() -> deadline,  endWorkerFrame()
+//
+// The compute share is scaled down quickly when worker frames overrun, and recovers slowly
+class FrameBudget
+{
+    static constexpr double smoothing = 0.1;        // EMA weight of newest sample
+    static constexpr double safety_margin_ms = 1.0;
+    static constexpr double min_budget_ms = 1.0;
+
+    // Written by GUI thread
+    std::atomic<double> refresh_interval_ms{ 0.0 }; // From display mode (0 = unknown)
+    std::atomic<double> vsync_interval_ms{ 1000.0 / 60.0 };
+    std::atomic<double> draw_ms{ 0.0 };
+
+    // Worker thread only
+    double scale = 1.0;
+    double available_ms = 0.0;
+    std::chrono::steady_clock::time_point worker_frame_start;
+
+    static void smooth(std::atomic<double>& avg, double sample)
+    {
+        double v = avg.load(std::memory_order_relaxed);
+        avg.store(v + (sample - v) * smoothing, std::memory_order_relaxed);
+    }
+
+public:
+
+    // ======== GUI ========
+
+    void setRefreshRate(double hz)
+    {
+        refresh_interval_ms.store(hz > 0.0 ? 1000.0 / hz : 0.0, std::memory_order_relaxed);
+    }
+
+    void reportGuiFrame(double interval_ms, double canvas_draw_ms)
+    {
+        // Ignore hitches (e.g. window drag) so one stall doesn't skew the interval
+        if (interval_ms > 0.0 && interval_ms < 250.0)
+            smooth(vsync_interval_ms, interval_ms);
+
+        if (canvas_draw_ms >= 0.0)
+            smooth(draw_ms, canvas_draw_ms);
+    }
+
+    [[nodiscard]] double frameIntervalMs() const
+    {
+        // Never budget for a faster rate than the display can present
+        return std::max(vsync_interval_ms.load(std::memory_order_relaxed),
+                        refresh_interval_ms.load(std::memory_order_relaxed));
+    }
+
+    [[nodiscard]] double drawMs() const { return draw_ms.load(std::memory_order_relaxed); }
+
+    // ======== Worker ========
+
+    std::chrono::steady_clock::time_point beginWorkerFrame(int pipeline_depth)
+    {
+        worker_frame_start = std::chrono::steady_clock::now();
+
+        // When lockstep, the canvas draw and the worker frame alternate. When pipelined they overlap
+        available_ms = frameIntervalMs() - (pipeline_depth <= 1 ? drawMs() : 0.0) - safety_margin_ms;
+
+        double budget_ms = std::max(min_budget_ms, available_ms * scale);
+        return worker_frame_start + std::chrono::microseconds((int64_t)(budget_ms * 1000.0));
+    }
+
+    void endWorkerFrame()
+    {
+        double frame_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - worker_frame_start).count();
+
+        if (frame_ms > available_ms)
+            scale = std::max(0.1, scale * 0.8);
+        else
+            scale = std::min(1.0, scale + 0.02);
+    }
+};
+
+// Renders the canvas at a reduced resolution while the user interacts with it (drags, pinches,
+// scrolls) or while canvas draws overrun their share of the frame, and returns to full
+// resolution once input settles. The canvas upscales the result when presenting it.
+//
+//  Worker thread:  setEnabled() (per project),  reportInteraction() (applied input events)
+//  GUI thread:     update() -> resolution scale for the next canvas draw
+class DynamicResolution
+{
+    static constexpr double interaction_scale = 0.5;
+    static constexpr double min_scale = 0.25;
+    static constexpr double settle_ms = 250.0;      // Input quiet for this long = settled
+    static constexpr double max_draw_share = 0.5;   // Of the frame interval, before scaling down
+    static constexpr double quantum = 0.125;        // Scale steps (avoids resizing every frame)
+
+    std::atomic<bool> enabled{ false };
+    std::atomic<int64_t> last_interaction_us{ INT64_MIN / 2 };
+
+    // GUI thread only
+    double load_scale = 1.0;
+    int draws_since_step = 0;
+
+    [[nodiscard]] static int64_t nowUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+public:
+
+    // ======== Worker ========
+
+    void setEnabled(bool b) { enabled.store(b, std::memory_order_relaxed); }
+    void reportInteraction() { last_interaction_us.store(nowUs(), std::memory_order_relaxed); }
+
+    // ======== GUI ========
+
+    [[nodiscard]] bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] bool interacting() const
+    {
+        return nowUs() - last_interaction_us.load(std::memory_order_relaxed) < (int64_t)(settle_ms * 1000.0);
+    }
+
+    // 'drawing' if the canvas draws this frame, 'draw_ms' is the smoothed canvas draw time
+    double update(bool drawing, double draw_ms, double frame_interval_ms)
+    {
+        if (!isEnabled())
+        {
+            load_scale = 1.0;
+            return 1.0;
+        }
+
+        // Scale down quickly when draws take too much of the frame, recover slowly. Steps
+        // wait a few draws, so the smoothed draw time can reflect the previous step
+        constexpr int draws_per_step = 8;
+        if (drawing && ++draws_since_step >= draws_per_step)
+        {
+            if (draw_ms > frame_interval_ms * max_draw_share)
+            {
+                load_scale = std::max(min_scale, load_scale * 0.8);
+                draws_since_step = 0;
+            }
+            else if (draw_ms < frame_interval_ms * max_draw_share * 0.5 && load_scale < 1.0)
+            {
+                load_scale = std::min(1.0, load_scale + 0.05);
+                draws_since_step = 0;
+            }
+        }
+
+        double scale = interacting() ? std::min(load_scale, interaction_scale) : load_scale;
+        return std::clamp(std::ceil(scale / quantum) * quantum, min_scale, 1.0);
+    }
+};
+
 struct SharedSync
 {
     std::atomic<bool> quitting{ false };
     //std::atomic<bool> editing_ui{ false };
-    std::atomic<bool> updating_live_buffer{ false };
 
-    std::mutex live_buffer_mutex;
+    // Live/shadow buffers sync lock-free. This only keeps the GUI populating attributes
+    // of a project while the worker handles project commands (i.e. destroys it)
     std::mutex shadow_buffer_mutex;
     std::mutex state_mutex;
 
     std::condition_variable cv;
-    std::condition_variable cv_updating_live_buffer;
 
     bool project_thread_started = false;
-    bool frame_ready = false;
-    bool frame_consumed = false;
-    
 
-    void wait_until_gui_consumes_frame()
+    // Guarded by state_mutex
+    FramePipeline frames;
+
+    FrameBudget budget;
+    DynamicResolution resolution;
+
+    // ======== Worker ========
+
+    void wait_until_can_record_frame()
     {
         std::unique_lock<std::mutex> lock(state_mutex);
-        cv.wait(lock, [this] {
-            return frame_consumed || quitting.load();
-        });
+        cv.wait(lock, [this] { return !frames.full() || quitting.load(); });
     }
 
-    void flag_ready_to_draw()
+    void wait_until_pipeline_drained()
+    {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        cv.wait(lock, [this] { return !frames.frameQueued() || quitting.load(); });
+    }
+
+    void set_pipeline_depth(int depth)
     {
         std::lock_guard<std::mutex> lock(state_mutex);
-        frame_ready = true;
-        frame_consumed = false;
+        frames.depth = std::clamp(depth, 1, FramePipeline::max_depth);
     }
 
-    void wait_until_gui_drawn()
+    [[nodiscard]] int record_slot()
     {
-        std::unique_lock<std::mutex> lock(state_mutex);
-        cv.wait(lock, [this] { return frame_consumed || quitting.load(); });
+        std::lock_guard<std::mutex> lock(state_mutex);
+        return frames.recordSlot();
+    }
+
+    void publish_frame()
+    {
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            frames.recorded++;
+        }
+        cv.notify_all();
+    }
+
+    // ======== GUI ========
+
+    [[nodiscard]] bool frame_ready()
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        return frames.frameQueued();
     }
 
-    void wait_until_live_buffer_updated()
+    [[nodiscard]] int draw_slot()
     {
-        std::unique_lock<std::mutex> live_lock(live_buffer_mutex);
-        cv_updating_live_buffer.wait(live_lock, [this]() {
-            return !updating_live_buffer.load();
-        });
+        std::lock_guard<std::mutex> lock(state_mutex);
+        return frames.drawSlot();
+    }
+
+    void flag_frame_drawn()
+    {
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            frames.drawn++;
+        }
+        cv.notify_all();
     }
 
     void quit()
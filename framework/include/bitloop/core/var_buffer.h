@@ -1,4 +1,11 @@
 #include "debug.h"
+#include "value_hash.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 template<typename T>
 concept VarBufferConcept = requires(T t, const T & rhs)
@@ -6,158 +13,324 @@ concept VarBufferConcept = requires(T t, const T & rhs)
     { t.populate() } -> std::same_as<void>;
 };
 
-struct BaseVariable
+// ======== SyncLayout ========
+// Static description of a VarBuffer type's synced members, built once per type from its
+// sync() list. Fields are addressed by offset, so the same layout applies to the live,
+// shadow and channel copies of the buffer without any per-variable allocations.
+//
+// Trivially-copyable members are compared/copied as raw bytes. Adjacent ones are joined
+// into spans so unchanged runs of members cost a single memcmp.
+//
+// Other members are compared with operator== against a marked copy, unless they're
+// SyncHashable, in which case only their hash is kept and compared (e.g. ImGradient,
+// where copying its colour cache every frame would be wasteful)
+
+enum struct SyncCheck
 {
-    std::string name;
-
-    BaseVariable(std::string_view name) : name(name) {}
-
-    virtual BaseVariable* clone() { return nullptr; }
-    //virtual std::string toString() { return "<na>"; }
-    virtual void setValue(const BaseVariable* rhs) = 0;
-    virtual bool equals(const BaseVariable* rhs) const = 0;
+    BYTES,    // memcmp / memcpy
+    HASH,     // syncHash() / operator=
+    COMPARE   // operator== / operator=
 };
 
-template<typename T>
-struct Variable final : public BaseVariable
+struct SyncField
 {
-    using element_type =
-        std::conditional_t<std::is_array_v<T>,
-        std::remove_extent_t<T>,
-        T>;
-
-    using storage_ptr = element_type*;
+    std::string name;
+    ptrdiff_t offset;
+    size_t size;
+    SyncCheck check;
 
-    storage_ptr ptr = nullptr;
-    bool owns_data = false;
+    void   (*copy)(void* dst, const void* src);
+    bool   (*equals)(const void* a, const void* b);
+    size_t (*hash)(const void* v);
+};
 
-    Variable(std::string_view name, storage_ptr v, bool auto_destruct)
-        : BaseVariable(name), ptr(v), owns_data(auto_destruct)
-    {}
+struct SyncSpan
+{
+    ptrdiff_t offset;
+    size_t size;
+    int first_field;
+    int last_field;
+};
 
-    ~Variable()
-    {
-        if (owns_data && ptr)
-        {
-            // Make sure we only delete the clones, not variables which were allocated by simulations
-            delete ptr;
-            ptr = nullptr;
-        }
-    }
+struct SyncLayout
+{
+    std::vector<SyncField> fields;
+    std::vector<SyncSpan> spans;  // BYTES fields
+    std::vector<int> others;      // HASH/COMPARE fields
 
-    void setValue(const BaseVariable* rhs) override
+    template<typename T>
+    void add(const char* name, ptrdiff_t offset)
     {
-        const auto rhs_var = dynamic_cast<const Variable<T>*>(rhs);
-        if (!rhs_var)
-            return; // bad cast
+        SyncField field{ name, offset, sizeof(T), SyncCheck::BYTES, nullptr, nullptr, nullptr };
 
-        if constexpr (std::is_array_v<T>)
+        if constexpr (std::is_trivially_copyable_v<T>)
         {
-            constexpr std::size_t N = std::extent_v<T>;
-            std::copy(rhs_var->ptr, rhs_var->ptr + N, ptr);
+            field.check = SyncCheck::BYTES;
         }
         else
         {
-            *ptr = *rhs_var->ptr;
+            field.copy = [](void* dst, const void* src)
+            {
+                if constexpr (std::is_array_v<T>)
+                    std::copy(std::begin(*static_cast<const T*>(src)), std::end(*static_cast<const T*>(src)), std::begin(*static_cast<T*>(dst)));
+                else
+                    *static_cast<T*>(dst) = *static_cast<const T*>(src);
+            };
+
+            if constexpr (SyncHashable<T>)
+            {
+                field.check = SyncCheck::HASH;
+                field.hash = [](const void* v) -> size_t { return syncHash(*static_cast<const T*>(v)); };
+            }
+            else
+            {
+                /// If you get an error here, your data type requires an operator==(const T&) overload
+                field.check = SyncCheck::COMPARE;
+                field.equals = [](const void* a, const void* b) -> bool
+                {
+                    if constexpr (std::is_array_v<T>)
+                        return std::equal(std::begin(*static_cast<const T*>(a)), std::end(*static_cast<const T*>(a)), std::begin(*static_cast<const T*>(b)));
+                    else
+                        return *static_cast<const T*>(a) == *static_cast<const T*>(b);
+                };
+            }
         }
+
+        fields.push_back(std::move(field));
     }
 
-    bool equals(const BaseVariable* rhs) const override
+    // 'base_offset' converts offsets from the VarBuffer base to the most derived buffer type
+    void finalize(ptrdiff_t base_offset)
     {
-        const auto rhs_var = dynamic_cast<const Variable<T>*>(rhs);
-        if (!rhs_var)
-            return false; // bad cast
+        for (SyncField& f : fields)
+            f.offset += base_offset;
 
-        if constexpr (std::is_array_v<T>)
+        std::vector<int> order;
+        for (int i = 0; i < (int)fields.size(); i++)
         {
-            constexpr std::size_t N = std::extent_v<T>;
-            return std::equal(ptr, ptr + N, rhs_var->ptr);
+            if (fields[i].check == SyncCheck::BYTES)
+                order.push_back(i);
+            else
+                others.push_back(i);
         }
-        else if constexpr (std::is_standard_layout_v<T> && std::is_trivially_copyable_v<T>)
+
+        std::sort(order.begin(), order.end(), [this](int a, int b) { return fields[a].offset < fields[b].offset; });
+
+        // Reorder BYTES fields by offset so each span covers a contiguous range of field indices
+        std::vector<SyncField> sorted;
+        for (int i : order) sorted.push_back(fields[i]);
+        for (int i : others) sorted.push_back(fields[i]);
+        fields = std::move(sorted);
+
+        const int byte_count = (int)order.size();
+        for (int i = 0; i < (int)others.size(); i++)
+            others[i] = byte_count + i;
+
+        for (int i = 0; i < byte_count; i++)
         {
-            // Safe to compare as raw memory
-            return std::memcmp(ptr, rhs_var->ptr, sizeof(T)) == 0;
+            const SyncField& f = fields[i];
+            if (!spans.empty())
+            {
+                SyncSpan& span = spans.back();
+                ptrdiff_t span_end = span.offset + (ptrdiff_t)span.size;
+
+                // Duplicate sync() of the same member
+                if (f.offset >= span.offset && f.offset + (ptrdiff_t)f.size <= span_end)
+                {
+                    span.last_field = i;
+                    continue;
+                }
+
+                // Adjacent (no padding between them)
+                if (f.offset == span_end)
+                {
+                    span.size += f.size;
+                    span.last_field = i;
+                    continue;
+                }
+            }
+            spans.push_back({ f.offset, f.size, i, i });
         }
+    }
+
+    [[nodiscard]] size_t size() const { return fields.size(); }
+
+    static void* at(void* base, const SyncField& f) { return static_cast<char*>(base) + f.offset; }
+    static const void* at(const void* base, const SyncField& f) { return static_cast<const char*>(base) + f.offset; }
+
+    void copyField(int i, void* dst_base, const void* src_base) const
+    {
+        const SyncField& f = fields[i];
+        if (f.check == SyncCheck::BYTES)
+            std::memcpy(at(dst_base, f), at(src_base, f), f.size);
         else
-        {
-            /// If you get an error here, your data type requires an operator==(const T&) overload
-            return *ptr == *rhs_var->ptr;
-        }
+            f.copy(at(dst_base, f), at(src_base, f));
+    }
+};
+
+// ======== SyncMarks ========
+// Values one side last exchanged with the other, to detect what changed since.
+// Holds a marked copy of BYTES/COMPARE fields, and just the hash of HASH fields.
+
+template<typename VarBufferType>
+struct SyncMarks
+{
+    std::unique_ptr<VarBufferType> marked = std::make_unique<VarBufferType>();
+    std::vector<size_t> hashes;
+
+    void init(const SyncLayout& layout, const VarBufferType& src)
+    {
+        hashes.assign(layout.size(), 0);
+        for (int i = 0; i < (int)layout.size(); i++)
+            mark(layout, i, &src);
+    }
+
+    void mark(const SyncLayout& layout, int i, const void* src_base)
+    {
+        const SyncField& f = layout.fields[i];
+        if (f.check == SyncCheck::HASH)
+            hashes[i] = f.hash(SyncLayout::at(src_base, f));
+        else
+            layout.copyField(i, marked.get(), src_base);
     }
 
-    Variable* clone() override
+    // Re-marks each field of 'cur' which differs from its marked value, and calls changed(i) for it
+    template<typename ChangedFn>
+    void markChanged(const SyncLayout& layout, const VarBufferType& cur, ChangedFn&& changed)
     {
-        if constexpr (std::is_array_v<T>)
+        const void* cur_base = &cur;
+        const void* marked_base = marked.get();
+
+        for (const SyncSpan& span : layout.spans)
         {
-            constexpr std::size_t N = std::extent_v<T>;
-            auto* new_arr = new element_type[N];
-            std::copy(ptr, ptr + N, new_arr);
-            return new Variable(name, new_arr, true);
+            if (std::memcmp(static_cast<const char*>(cur_base) + span.offset,
+                            static_cast<const char*>(marked_base) + span.offset, span.size) == 0)
+                continue;
+
+            for (int i = span.first_field; i <= span.last_field; i++)
+            {
+                const SyncField& f = layout.fields[i];
+                if (std::memcmp(SyncLayout::at(cur_base, f), SyncLayout::at(marked_base, f), f.size) != 0)
+                {
+                    std::memcpy(SyncLayout::at(marked.get(), f), SyncLayout::at(cur_base, f), f.size);
+                    changed(i);
+                }
+            }
         }
-        else
+
+        for (int i : layout.others)
         {
-            return new Variable(name, new element_type(*ptr), true);
+            const SyncField& f = layout.fields[i];
+            if (f.check == SyncCheck::HASH)
+            {
+                size_t h = f.hash(SyncLayout::at(cur_base, f));
+                if (h != hashes[i])
+                {
+                    hashes[i] = h;
+                    changed(i);
+                }
+            }
+            else if (!f.equals(SyncLayout::at(cur_base, f), SyncLayout::at(marked_base, f)))
+            {
+                f.copy(SyncLayout::at(marked.get(), f), SyncLayout::at(cur_base, f));
+                changed(i);
+            }
         }
     }
-
-    //std::string toString() override
-    //{
-    //    std::stringstream ss;
-    //    ss << *ptr;
-    //    return ss.str();
-    //}
 };
 
-struct VariableEntry
+// ======== SyncChannel ========
+// Lock-free triple buffer carrying changed variables from one thread to the other.
+//
+// The writer fills its back slot and swaps it with the middle slot. The reader swaps
+// the middle slot with its front slot only if it's fresh. Neither side ever waits.
+//
+// Each slot records the writer generation at which every value last changed, and a
+// slot only re-copies values changed since it was last written. Publishes the reader
+// never saw are therefore never lost, they're folded into the next one.
+
+template<typename VarBufferType>
+struct SyncChannel
 {
-    int id;
-    std::string name;
+    struct Slot
+    {
+        std::unique_ptr<VarBufferType> values = std::make_unique<VarBufferType>();
+        std::vector<uint64_t> changed_gen;
+        std::vector<size_t> hashes;   // Of HASH fields, so the reader needn't rehash
+        uint64_t generation = 0;      // Writer generation when published
+        uint64_t ack = 0;             // Generation the writer had received from the reverse channel
+    };
 
-    // Actual live/shadow buffers
-    BaseVariable* shadow_ptr    = nullptr;
-    BaseVariable* live_ptr      = nullptr;
-
-    // "Before" buffers to compare against and detect changes
-    BaseVariable* shadow_marked = nullptr;
-    BaseVariable* live_marked   = nullptr;
-
-    void updateLive()           { live_ptr->setValue(shadow_ptr); }
-    void updateShadow()         { shadow_ptr->setValue(live_ptr); }
-    void markLiveValue()        { live_marked->setValue(live_ptr); }
-    void markShadowValue()      { shadow_marked->setValue(shadow_ptr); }
-    bool liveChanged()   const  { return !live_ptr->equals(live_marked); }
-    bool shadowChanged() const  { return !shadow_ptr->equals(shadow_marked); }
-
-    //void print()
-    //{
-    //    BL::print() << "Shadow: " << shadow_ptr->toString() 
-    //                << "  Live: " << live_ptr->toString();
-    //}
-};
+    static constexpr uint8_t fresh_bit = 0x4;
 
-struct VariableMap : public std::vector<VariableEntry>
-{
-    void markLiveValues()   { for (size_t i=0; i<size(); i++) at(i).markLiveValue(); }
-    void markShadowValues() { for (size_t i=0; i<size(); i++) at(i).markShadowValue(); }
-    bool changedLive() {
-        for (size_t i = 0; i < size(); i++) {
-            if (at(i).liveChanged())
-                return true;
+    Slot slots[3];
+    std::atomic<uint8_t> middle{ 1 };
+
+    // ---- Writer state ----
+    int back = 0;
+    uint64_t generation = 0;
+    std::vector<uint64_t> changed_gen;
+    std::vector<int> changed;         // Fields changed this generation
+
+    // ---- Reader state ----
+    int front = 2;
+    uint64_t received = 0;
+
+    void init(const SyncLayout& layout, const VarBufferType& src)
+    {
+        for (Slot& slot : slots)
+        {
+            for (int i = 0; i < (int)layout.size(); i++)
+                layout.copyField(i, slot.values.get(), &src);
+            slot.changed_gen.assign(layout.size(), 0);
+            slot.hashes.assign(layout.size(), 0);
         }
-        return false;
+        changed_gen.assign(layout.size(), 0);
+        changed.reserve(layout.size());
+    }
+
+    // Writer: stamp field with the generation about to be published
+    void setChanged(int i)
+    {
+        if (changed.empty()) generation++;
+        changed_gen[i] = generation;
+        changed.push_back(i);
     }
-    bool changedShadow() {
-        for (size_t i = 0; i < size(); i++)  {
-            if (at(i).shadowChanged())
-                return true;
+
+    // Writer: copy values changed since the back slot was last written, then hand it over
+    void publish(const SyncLayout& layout, const VarBufferType& src, const std::vector<size_t>& src_hashes, uint64_t ack)
+    {
+        Slot& slot = slots[back];
+        for (int i = 0; i < (int)layout.size(); i++)
+        {
+            if (changed_gen[i] > slot.generation)
+            {
+                layout.copyField(i, slot.values.get(), &src);
+                slot.changed_gen[i] = changed_gen[i];
+                slot.hashes[i] = src_hashes[i];
+            }
         }
-        return false;
+        slot.generation = generation;
+        slot.ack = ack;
+        changed.clear();
+
+        back = middle.exchange(static_cast<uint8_t>(back) | fresh_bit, std::memory_order_acq_rel) & ~fresh_bit;
+    }
+
+    // Reader: newest published slot, or nullptr if nothing was published since the last acquire
+    [[nodiscard]] const Slot* acquire()
+    {
+        if (!(middle.load(std::memory_order_relaxed) & fresh_bit))
+            return nullptr;
+
+        front = middle.exchange(static_cast<uint8_t>(front), std::memory_order_acq_rel) & ~fresh_bit;
+        return &slots[front];
     }
 };
 
 struct VarBuffer
 {
-    std::vector<BaseVariable*> buffer_var_ptrs;
+    SyncLayout* registering_layout = nullptr;
 
     VarBuffer() = default;
     VarBuffer(const VarBuffer&) = delete;
@@ -167,10 +340,11 @@ struct VarBuffer
     template<typename T>
     void _sync(const char* name, T& v)
     {
-        if constexpr (std::is_array_v<T>)
-            buffer_var_ptrs.push_back(new Variable<T>(name, v, false));   // v  -> element*
-        else
-            buffer_var_ptrs.push_back(new Variable<T>(name, &v, false));  // &v -> T*
+        if (!registering_layout)
+            return;
+
+        ptrdiff_t offset = reinterpret_cast<const char*>(&v) - reinterpret_cast<const char*>(this);
+        registering_layout->add<T>(name, offset);
     }
 
 
@@ -184,11 +358,14 @@ concept DerivedFromVarBuffer = std::derived_from<T, VarBuffer>;
 
 // ======== DoubleBuffer ========
 // Inherits from passed VarBuffer type, and stores an internal "shadow_attributes" VarBuffer
-// 
-// Call:  
+//
+// Call:
 //   sync(...)  inside VarBuffer::registerSynced()  to register a variable for tracking/syncing
-// 
-// Allows marking live/shadow variables states to detect changes that need syncing
+//
+// The live buffer is owned by the worker thread, the shadow buffer by the GUI thread.
+// Each side detects its own changes and publishes them through a SyncChannel, so neither
+// thread ever blocks the other. If both sides change a variable, the UI edit wins until
+// the worker acknowledges having received it.
 
 template<DerivedFromVarBuffer VarBufferType>
 class DoubleBuffer : public VarBufferType
@@ -196,84 +373,129 @@ class DoubleBuffer : public VarBufferType
 public:
 
 	VarBufferType shadow_attributes; // 2nd buffer, which is synced with the identical inherited VarBufferType
-    VariableMap var_map;
+
+    SyncMarks<VarBufferType> live_marks;
+    SyncMarks<VarBufferType> shadow_marks;
+
+    SyncChannel<VarBufferType> live_to_shadow; // Written by worker, read by GUI
+    SyncChannel<VarBufferType> shadow_to_live; // Written by GUI, read by worker
 
     DoubleBuffer() : shadow_attributes()
     {
-        // Let each buffer list their synced members with sync()
-        shadow_attributes.registerSynced();
-        VarBufferType::registerSynced();
+        const SyncLayout& layout = syncLayout();
 
-        // Join up the lists into a single 'var_map'
-        for (size_t i = 0; i < VarBufferType::buffer_var_ptrs.size(); i++)
+        live_marks.init(layout, live());
+        shadow_marks.init(layout, shadow_attributes);
+        live_to_shadow.init(layout, live());
+        shadow_to_live.init(layout, shadow_attributes);
+
+        // Initialize data on shadow *after* we start tracking, so that changes detected and synced
+        shadow_attributes.initData();
+        pushShadowChanges();
+    }
+
+    // Built once per VarBufferType (offsets are identical for every instance)
+    [[nodiscard]] const SyncLayout& syncLayout()
+    {
+        static const SyncLayout layout = [this]
         {
-            VariableEntry entry;
-            entry.shadow_ptr = shadow_attributes.buffer_var_ptrs[i];
-            entry.live_ptr = VarBufferType::buffer_var_ptrs[i];
-            entry.shadow_marked = entry.shadow_ptr->clone();
-            entry.live_marked = entry.live_ptr->clone();
+            SyncLayout l;
+            VarBufferType::registering_layout = &l;
+            VarBufferType::registerSynced();
+            VarBufferType::registering_layout = nullptr;
+            l.finalize(reinterpret_cast<const char*>(static_cast<const VarBuffer*>(&live())) -
+                       reinterpret_cast<const char*>(&live()));
+            return l;
+        }();
+        return layout;
+    }
+
+    /// ======== Worker thread ========
 
-            entry.id = (int)i;
-            entry.name = entry.live_ptr->name;
-            //entry.print();
+    // Apply values edited in the UI since the last pull. Returns true if any were applied
+    bool pullShadowChanges()
+    {
+        const auto* slot = shadow_to_live.acquire();
+        if (!slot)
+            return false;
 
-            var_map.push_back(entry);
+        const SyncLayout& layout = syncLayout();
+        bool applied = false;
+        for (int i = 0; i < (int)layout.size(); i++)
+        {
+            if (slot->changed_gen[i] > shadow_to_live.received)
+            {
+                receiveField(layout, live_marks, i, live(), *slot);
+                applied = true;
+            }
         }
 
-        // Initialize data on shadow *after* we start tracking, so that changes detected and synced
-        shadow_attributes.initData();
+        shadow_to_live.received = slot->generation;
+        return applied;
+    }
+
+    // Publish live values changed since the last push
+    void pushLiveChanges()
+    {
+        const SyncLayout& layout = syncLayout();
+        live_marks.markChanged(layout, live(), [&](int i) {
+            live_to_shadow.setChanged(i);
+        });
 
-        // Taken ownership of pointers, clear lists
-        shadow_attributes.buffer_var_ptrs.clear();
-        VarBufferType::buffer_var_ptrs.clear();
+        if (!live_to_shadow.changed.empty())
+            live_to_shadow.publish(layout, live(), live_marks.hashes, shadow_to_live.received);
     }
 
-    ///~DoubleBuffer()
-    ///{
-    ///    // todo: Clean up owned data pointers
-    ///    for (VariableEntry& entry : var_map)
-    ///    {
-    ///
-    ///    }
-    ///}
+    /// ======== GUI thread ========
 
-    void updateLiveBuffer()
+    // Apply values changed by the worker since the last pull (except pending UI edits)
+    void pullLiveChanges()
     {
-        for (VariableEntry& entry : var_map) {
-            if (entry.shadowChanged())
-                entry.updateLive();
+        const auto* slot = live_to_shadow.acquire();
+        if (!slot)
+            return;
+
+        const SyncLayout& layout = syncLayout();
+        for (int i = 0; i < (int)layout.size(); i++)
+        {
+            if (slot->changed_gen[i] <= live_to_shadow.received)
+                continue;
+
+            // Edited in UI, but worker hadn't received it yet
+            if (shadow_to_live.changed_gen[i] > slot->ack)
+                continue;
+
+            receiveField(layout, shadow_marks, i, shadow_attributes, *slot);
         }
+
+        live_to_shadow.received = slot->generation;
     }
-    void updateShadowBuffer()
+
+    // Publish values edited in the UI since the last push
+    void pushShadowChanges()
     {
-        for (VariableEntry& entry : var_map) {
-            if (entry.liveChanged())
-                entry.updateShadow();
-        }
+        const SyncLayout& layout = syncLayout();
+        shadow_marks.markChanged(layout, shadow_attributes, [&](int i) {
+            shadow_to_live.setChanged(i);
+        });
+
+        if (!shadow_to_live.changed.empty())
+            shadow_to_live.publish(layout, shadow_attributes, shadow_marks.hashes, live_to_shadow.received);
     }
 
-    void markLiveValues() { var_map.markLiveValues(); }
-    void markShadowValues() { var_map.markShadowValues(); }
-
-    bool changedLive() { return var_map.changedLive(); }
-    bool changedShadow() { return var_map.changedShadow(); }
-
-    //std::string pad(const std::string& str, int width) const
-    //{
-    //    return str + std::string(width > str.size() ? width - str.size() : 0, ' ');
-    //}
-    //std::string toString() const
-    //{
-    //    static const int name_len = 28;
-    //    static const int val_len = 10;
-    //
-    //    std::stringstream txt;
-    //    for (const auto& entry : var_map)
-    //        txt << pad(std::to_string(entry.id) + ". ", 4) << pad(entry.name, name_len)
-    //        << "SHADOW_MARKED: " << pad(entry.shadow_marked->toString(), val_len) << "   SHADOW_VAL: " << pad(entry.shadow_ptr->toString(), val_len)
-    //        << "    LIVE_MARKED:   " << pad(entry.live_marked->toString(), val_len) << "   LIVE_VAL: " << pad(entry.live_ptr->toString(), val_len)
-    //        << "\n";
-    //
-    //    return txt.str();
-    //}
+private:
+
+    VarBufferType& live() { return *this; }
+
+    // Copy received value into buffer, and mark it so it isn't echoed back
+    static void receiveField(const SyncLayout& layout, SyncMarks<VarBufferType>& marks, int i,
+        VarBufferType& dst, const typename SyncChannel<VarBufferType>::Slot& slot)
+    {
+        layout.copyField(i, &dst, slot.values.get());
+
+        if (layout.fields[i].check == SyncCheck::HASH)
+            marks.hashes[i] = slot.hashes[i];
+        else
+            layout.copyField(i, marks.marked.get(), slot.values.get());
+    }
 };
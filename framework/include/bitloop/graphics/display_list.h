@@ -0,0 +1,212 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+
+#include "nanovg/nanovg.h"
+#include "debug.h"
+
+BL_BEGIN_NS
+
+class Image;
+class NanoFont;
+
+enum struct DrawOp : uint8_t
+{
+    // State
+    SAVE,
+    RESTORE,
+    RESET_TRANSFORM,
+    TRANSFORM,          // a, b, c, d, e, f
+    TRANSLATE,          // x, y
+    ROTATE,             // angle
+    SCALE,              // x, y
+    SKEW_X,             // angle
+    SKEW_Y,             // angle
+    SCISSOR,            // x, y, w, h
+    RESET_SCISSOR,
+
+    // Styles
+    FILL_COLOR,         // r, g, b, a
+    STROKE_COLOR,       // r, g, b, a
+    STROKE_WIDTH,       // w
+    LINE_CAP,           // cap
+    LINE_JOIN,          // join
+    TEXT_ALIGN,         // align
+    FONT_SIZE,          // size
+    FONT_FACE,          // (next font)
+
+    // Paths
+    BEGIN_PATH,
+    MOVE_TO,            // x, y
+    LINE_TO,            // x, y
+    BEZIER_TO,          // x1, y1, x2, y2, x, y
+    QUAD_TO,            // cx, cy, x, y
+    ARC,                // cx, cy, r, a0, a1, winding
+    ARC_TO,             // x0, y0, x1, y1, r
+    CLOSE_PATH,
+    RECT,               // x, y, w, h
+    ROUNDED_RECT,       // x, y, w, h, r
+    CIRCLE,             // cx, cy, r
+    ELLIPSE,            // cx, cy, rx, ry
+    FILL,
+    STROKE,
+
+    // Output
+    TEXT,               // x, y, (next text run)
+    IMAGE,              // a, b, c, d, e, f, (next image)
+    CIRCLES             // r, count, colored, (next 'count' circles)
+};
+
+// Number of float arguments each op takes
+[[nodiscard]] constexpr int drawOpArgCount(DrawOp op)
+{
+    switch (op)
+    {
+    case DrawOp::TRANSFORM:    return 6;
+    case DrawOp::TRANSLATE:    return 2;
+    case DrawOp::ROTATE:       return 1;
+    case DrawOp::SCALE:        return 2;
+    case DrawOp::SKEW_X:       return 1;
+    case DrawOp::SKEW_Y:       return 1;
+    case DrawOp::SCISSOR:      return 4;
+    case DrawOp::FILL_COLOR:   return 4;
+    case DrawOp::STROKE_COLOR: return 4;
+    case DrawOp::STROKE_WIDTH: return 1;
+    case DrawOp::LINE_CAP:     return 1;
+    case DrawOp::LINE_JOIN:    return 1;
+    case DrawOp::TEXT_ALIGN:   return 1;
+    case DrawOp::FONT_SIZE:    return 1;
+    case DrawOp::MOVE_TO:      return 2;
+    case DrawOp::LINE_TO:      return 2;
+    case DrawOp::BEZIER_TO:    return 6;
+    case DrawOp::QUAD_TO:      return 4;
+    case DrawOp::ARC:          return 6;
+    case DrawOp::ARC_TO:       return 5;
+    case DrawOp::RECT:         return 4;
+    case DrawOp::ROUNDED_RECT: return 5;
+    case DrawOp::CIRCLE:       return 3;
+    case DrawOp::ELLIPSE:      return 4;
+    case DrawOp::TEXT:         return 2;
+    case DrawOp::IMAGE:        return 6;
+    case DrawOp::CIRCLES:      return 3;
+    default:                   return 0;
+    }
+}
+
+// ======== Display list ========
+//
+// Compact recording of SimplePainter calls. The worker records a frame's draw calls
+// (viewportDraw etc.) into one, and the GUI thread only replays it into nanovg, so
+// drawing no longer reads live scene state and can overlap processing the next frame.
+//
+// Arguments are packed into one float stream in op order. Text, fonts, images and circle
+// batches are kept in their own arrays and consumed in order by the ops that use them.
+//
+// Images are uploaded from their live pixels when replayed, so a list which draws
+// images must be replayed while the worker isn't writing to them (see drawsImages())
+
+class DisplayList
+{
+    std::vector<DrawOp> ops;
+    std::vector<float> args;
+
+    std::string text;
+    std::vector<std::pair<uint32_t, uint32_t>> text_runs; // (offset, length) into text
+
+    std::vector<std::shared_ptr<NanoFont>> fonts;
+    std::vector<Image*> images;
+
+    std::vector<float> circle_xy;           // (x, y) per circle
+    std::vector<uint32_t> circle_colors;    // RGBA8 per circle, for batches with colors
+
+    size_t content_hash = 0;
+
+public:
+
+    // Keeps capacity, so steady-state recording doesn't allocate
+    void clear()
+    {
+        ops.clear();
+        args.clear();
+        text.clear();
+        text_runs.clear();
+        fonts.clear();
+        images.clear();
+        circle_xy.clear();
+        circle_colors.clear();
+        content_hash = 0;
+    }
+
+    // ======== Recording (worker) ========
+
+    template<typename... Args>
+    void push(DrawOp op, Args... a)
+    {
+        ops.push_back(op);
+        (args.push_back(static_cast<float>(a)), ...);
+    }
+
+    void pushColor(DrawOp op, NVGcolor c)
+    {
+        push(op, c.r, c.g, c.b, c.a);
+    }
+
+    void pushText(float x, float y, std::string_view txt)
+    {
+        push(DrawOp::TEXT, x, y);
+        text_runs.push_back({ (uint32_t)text.size(), (uint32_t)txt.size() });
+        text.append(txt);
+    }
+
+    void pushFont(std::shared_ptr<NanoFont> font)
+    {
+        push(DrawOp::FONT_FACE);
+        fonts.push_back(std::move(font));
+    }
+
+    void pushImage(Image* image, const float(&m)[6])
+    {
+        push(DrawOp::IMAGE, m[0], m[1], m[2], m[3], m[4], m[5]);
+        images.push_back(image);
+    }
+
+    // One batch of circles, 'colors' may be null to draw them all in the fill style
+    void pushCircles(const float* xy, int count, float r, const uint32_t* colors)
+    {
+        push(DrawOp::CIRCLES, r, count, colors ? 1 : 0);
+        circle_xy.insert(circle_xy.end(), xy, xy + size_t(count) * 2);
+        if (colors)
+            circle_colors.insert(circle_colors.end(), colors, colors + count);
+    }
+
+    // Appends another list's ops (e.g. a retained path), scaling its stroke widths
+    void append(const DisplayList& other, float stroke_scale = 1.0f);
+
+    // Call once recorded, before publishing
+    void finish();
+
+    // Writes a copy to 'out' with bezier/quadratic curves flattened into line segments
+    // (to within 'tolerance'), and coordinates made relative to an origin near the
+    // geometry (returned), so it stays precise when drawn under a large transform
+    void flattenInto(DisplayList& out, float tolerance, float& origin_x, float& origin_y) const;
+
+    // Worker-side nanovg context with no renderer. While recording, painter state is applied
+    // to it as well, so transforms & text metrics can still be queried (worker thread only)
+    [[nodiscard]] static NVGcontext* measureContext();
+
+    // ======== Replay (GUI) ========
+
+    void replay(NVGcontext* vg, float stroke_scale = 1.0f) const;
+
+    [[nodiscard]] bool empty() const { return ops.empty(); }
+    [[nodiscard]] bool drawsImages() const { return !images.empty(); }
+
+    // Equal hashes mean an identical frame (unless it draws images, whose pixels may differ)
+    [[nodiscard]] size_t contentHash() const { return content_hash; }
+};
+
+BL_END_NS
@@ -9,11 +9,15 @@
 
 #include "nanovg/nanovg.h"
 #include <vector>
+#include <algorithm>
+#include <memory>
+#include <atomic>
 
 #include "bitloop/utility/math_helpers.h"
 #include "bitloop/utility/color.h"
 #include "threads.h"
 #include "camera.h"
+#include "nano_software.h"
 
 BL_BEGIN_NS
 
@@ -126,6 +130,87 @@ public:
     }
 };
 
+struct PixelRect
+{
+    int x, y, w, h;
+};
+
+// Streams RGBA texture uploads through a ring of pixel buffer objects. Dirty regions are
+// copied into a (persistently mapped when available) buffer and glTexSubImage2D is issued
+// from it, so the call returns without waiting for the transfer, which overlaps with
+// further GUI and worker work. Fences recycle buffers once the GPU has consumed them.
+//
+// GUI thread only. upload() returns false (use a direct upload instead) on GLES/WebGL,
+// or when every buffer is still in flight.
+class PixelUploadStream
+{
+    static constexpr int ring_size = 3;
+
+    struct Slot
+    {
+        GLuint pbo = 0;
+        GLsync fence = nullptr;
+        size_t capacity = 0;
+        uint8_t* mapped = nullptr; // Persistent mapping (GL 4.4+)
+    };
+
+    Slot slots[ring_size];
+    int next_slot = 0;
+
+    void release(); // Deferred to the GUI thread (may be destroyed by worker with its project)
+
+public:
+
+    PixelUploadStream() = default;
+    PixelUploadStream(const PixelUploadStream&) = delete;
+    ~PixelUploadStream() { release(); }
+
+    bool upload(NVGcontext* vg, int image, const uint8_t* pixels, int image_width, const std::vector<PixelRect>& rects);
+
+    // Deletes GL objects of destroyed streams (call on GUI thread with context current)
+    static void collectGarbage();
+};
+
+// Recycles texture & framebuffer storage, so resizing (window drags, docking layout changes,
+// bitmaps following the viewport) doesn't allocate GPU memory every frame. Storage is sized in
+// size classes (within 25% of each other), owners draw into a sub-rect of it, and only move to
+// new storage once they outgrow it or waste most of it. Released storage is kept for reuse by
+// any owner needing the same size class, until more than max_free of a kind are waiting.
+class StoragePool
+{
+public:
+
+    static constexpr int max_free = 4;
+
+    struct RenderTarget
+    {
+        GLuint fbo = 0, tex = 0, rbo = 0;
+        int width = 0, height = 0; // Storage size (a size class)
+    };
+
+    // Smallest size class >= n
+    [[nodiscard]] static int sizeClass(int n);
+
+    // Storage size (per dimension) for 'n', given the current storage size 'cap'. Grows
+    // geometrically, shrinks once more than half of the storage is unused
+    [[nodiscard]] static int capacityFor(int cap, int n);
+
+    // NEAREST-filtered RGBA nanovg images, w & h are size classes. Release from any thread
+    [[nodiscard]] static int acquireImage(NVGcontext* vg, int w, int h);
+    static void releaseImage(NVGcontext* vg, int image, int w, int h);
+
+    // Color texture + depth/stencil framebuffers, w & h are size classes (GUI thread)
+    [[nodiscard]] static RenderTarget acquireTarget(int w, int h);
+    static void releaseTarget(const RenderTarget& target);
+
+    // Deletes pooled images of 'vg', before the context itself is deleted (GUI thread)
+    static void releaseContext(NVGcontext* vg);
+
+    // Deletes 'vg's images beyond max_free, and GL render targets beyond max_free unless 'vg' is
+    // a software context (call on the thread drawing to 'vg', with GL current for GL contexts)
+    static void collectGarbage(NVGcontext* vg);
+};
+
 class Image
 {
     friend class SimplePainter;
@@ -139,26 +224,82 @@ protected:
         IVec2 bmp_size;
     };
 
+    // Pixels are stored in (stride x storage_height), a StoragePool size class, with the bitmap
+    // in the top-left. The texture has the same size, so resizes within it don't reallocate
+    int stride = 0;
+    int storage_height = 0;
+
     int nano_img = 0;
+    NVGcontext* nano_vg = nullptr;
+    int tex_width = 0, tex_height = 0;
     bool pending_resize = false;
 
     std::vector<uint8_t> pixels;
     uint32_t* colors;
 
+    // ======== Dirty tracking ========
+    // Pixels are written from many worker threads, so each (row, 64px column tile) gets its
+    // own flag. Only dirty tiles are re-uploaded to the texture when drawn
+    static constexpr int dirty_tile_shift = 6;
+
+    int dirty_tile_cols = 0;
+    std::unique_ptr<std::atomic<uint8_t>[]> dirty_tiles;
+    std::atomic<bool> all_dirty{ true };
+
+    void markDirty(int x, int y)
+    {
+        std::atomic<uint8_t>& tile = dirty_tiles[size_t(y) * dirty_tile_cols + (x >> dirty_tile_shift)];
+        if (!tile.load(std::memory_order_relaxed))
+            tile.store(1, std::memory_order_relaxed);
+    }
+
+    // GUI thread only
+    std::vector<PixelRect> dirty_bands;
+    PixelUploadStream upload_stream;
+
 public:
 
     Image() : bmp_size{ 0, 0 }, colors(nullptr) {}
+    ~Image()
+    {
+        if (nano_img)
+            StoragePool::releaseImage(nano_vg, nano_img, tex_width, tex_height);
+    }
 
     [[nodiscard]] int width() const { return bmp_width; }
     [[nodiscard]] int height() const { return bmp_height; }
     [[nodiscard]] int imageId() const { return nano_img; }
 
+    // Texture size, the bitmap occupies its top-left (width() x height())
+    [[nodiscard]] int textureWidth() const { return tex_width; }
+    [[nodiscard]] int textureHeight() const { return tex_height; }
+
     void create(int w, int h) 
     {
         bmp_width = w; bmp_height = h;
-        pixels.assign(size_t(w) * h * 4, 0);
-        colors = reinterpret_cast<uint32_t*>(&pixels.front());
-        pending_resize = true;
+        if (w <= 0 || h <= 0)
+            return;
+
+        int new_stride = StoragePool::capacityFor(stride, w);
+        int new_height = StoragePool::capacityFor(storage_height, h);
+        if (new_stride != stride || new_height != storage_height)
+        {
+            stride = new_stride;
+            storage_height = new_height;
+            pixels.assign(size_t(stride) * storage_height * 4, 0);
+
+            int tile_cols = (stride + (1 << dirty_tile_shift) - 1) >> dirty_tile_shift;
+            dirty_tiles = std::make_unique<std::atomic<uint8_t>[]>(size_t(tile_cols) * storage_height);
+            pending_resize = true;
+        }
+        else
+        {
+            std::fill(pixels.begin(), pixels.begin() + size_t(stride) * h * 4, uint8_t(0));
+        }
+
+        colors = reinterpret_cast<uint32_t*>(pixels.data());
+        dirty_tile_cols = (w + (1 << dirty_tile_shift) - 1) >> dirty_tile_shift;
+        all_dirty = true;
     }
 
     void clear(Color c)
@@ -166,10 +307,13 @@ public:
         if (pixels.size() == 0)
             return;
         uint32_t u32 = c.u32;
-        uint32_t* pixel = colors;
-        uint32_t count = bmp_width * bmp_height;
-        for (uint32_t i=0; i< count; i++)
-            *pixel++ = u32;
+        for (int y = 0; y < bmp_height; y++)
+        {
+            uint32_t* pixel = colors + size_t(y) * stride;
+            for (int x = 0; x < bmp_width; x++)
+                *pixel++ = u32;
+        }
+        all_dirty = true;
     }
 
     void clear(int r, int g, int b, int a)
@@ -179,17 +323,19 @@ public:
 
     void setPixel(int x, int y, uint32_t rgba)
     {
-        size_t i = (size_t(y) * bmp_width + x);
+        size_t i = (size_t(y) * stride + x);
         colors[i] = rgba;
+        markDirty(x, y);
     }
 
     void setPixel(int x, int y, int r, int g, int b, int a=255)
     {
-        size_t i = (size_t(y) * bmp_width + x) * 4;
+        size_t i = (size_t(y) * stride + x) * 4;
         pixels[i++] = r;
         pixels[i++] = g;
         pixels[i++] = b;
         pixels[i++] = a;
+        markDirty(x, y);
     }
 
     void setPixelSafe(int x, int y, uint32_t rgba)
@@ -199,11 +345,12 @@ public:
         {
             return;
         }
-        size_t i = (size_t(y) * bmp_width + x) * 4;
+        size_t i = (size_t(y) * stride + x) * 4;
         pixels[i + 0] = rgba & 0xFF;
         pixels[i + 1] = (rgba >> 8) & 0xFF;
         pixels[i + 2] = (rgba >> 16) & 0xFF;
         pixels[i + 3] = (rgba >> 24) & 0xFF;
+        markDirty(x, y);
     }
 
     void setPixelSafe(int x, int y, int r, int g, int b, int a = 255)
@@ -213,16 +360,17 @@ public:
         {
             return;
         }
-        size_t i = (size_t(y) * bmp_width + x) * 4;
+        size_t i = (size_t(y) * stride + x) * 4;
         pixels[i + 0] = r;
         pixels[i + 1] = g;
         pixels[i + 2] = b;
         pixels[i + 3] = a;
+        markDirty(x, y);
     }
 
     [[nodiscard]] Color getPixel(int x, int y) const
     {
-        size_t i = (size_t(y) * bmp_width + x) * 4;
+        size_t i = (size_t(y) * stride + x) * 4;
         return 
             pixels[i] |
             pixels[i + 1] << 8 | 
@@ -238,7 +386,7 @@ public:
             return 0;
         }
 
-        size_t i = (size_t(y) * bmp_width + x) * 4;
+        size_t i = (size_t(y) * stride + x) * 4;
         return
             pixels[i] | 
             pixels[i + 1] << 8 | 
@@ -253,16 +401,98 @@ protected:
         if (bmp_width <= 0 || bmp_height <= 0)
             return;
 
+        dirty_bands.clear();
+
         if (pending_resize)
         {
-            if (nano_img) nvgDeleteImage(vg, nano_img);
-            nano_img = nvgCreateImageRGBA(vg, bmp_width, bmp_height, NVG_IMAGE_NEAREST, pixels.data());
+            // Outgrew (or mostly stopped using) the texture
+            if (nano_img) StoragePool::releaseImage(nano_vg, nano_img, tex_width, tex_height);
+            nano_img = StoragePool::acquireImage(vg, stride, storage_height);
+            nano_vg = vg;
+            tex_width = stride;
+            tex_height = storage_height;
             pending_resize = false;
+            all_dirty = true;
+        }
+
+        if (all_dirty.exchange(false))
+        {
+            clearDirty();
+            dirty_bands.push_back({ 0, 0, bmp_width, bmp_height });
         }
         else
         {
-            nvgUpdateImage(vg, nano_img, pixels.data());
+            collectDirtyBands();
+        }
+
+        if (dirty_bands.empty())
+            return;
+
+        // Asynchronous if possible (GL only), otherwise upload directly
+        if (nvgIsSoftware(vg) || !upload_stream.upload(vg, nano_img, pixels.data(), stride, dirty_bands))
+        {
+            NVGparams* params = nvgInternalParams(vg);
+            for (const PixelRect& r : dirty_bands)
+                params->renderUpdateTexture(params->userPtr, nano_img, r.x, r.y, r.w, r.h, pixels.data());
+        }
+    }
+
+    void clearDirty()
+    {
+        size_t count = size_t(dirty_tile_cols) * bmp_height;
+        for (size_t i = 0; i < count; i++)
+            dirty_tiles[i].store(0, std::memory_order_relaxed);
+        all_dirty = false;
+    }
+
+    // Gathers bands of dirty rows (each spanning its dirty tile columns) into dirty_bands
+    void collectDirtyBands()
+    {
+        // Bands separated by fewer clean rows than this are merged, to limit the number of uploads
+        constexpr int max_row_gap = 4;
+
+        int band_y0 = -1, band_y1 = -1;
+        int band_t0 = dirty_tile_cols, band_t1 = -1;
+
+        auto flushBand = [&]()
+        {
+            if (band_y0 < 0) return;
+            int x0 = band_t0 << dirty_tile_shift;
+            int x1 = std::min(bmp_width, (band_t1 + 1) << dirty_tile_shift);
+            dirty_bands.push_back({ x0, band_y0, x1 - x0, band_y1 - band_y0 + 1 });
+            band_y0 = band_y1 = -1;
+            band_t0 = dirty_tile_cols;
+            band_t1 = -1;
+        };
+
+        for (int y = 0; y < bmp_height; y++)
+        {
+            std::atomic<uint8_t>* row = &dirty_tiles[size_t(y) * dirty_tile_cols];
+
+            int t0 = -1, t1 = -1;
+            for (int t = 0; t < dirty_tile_cols; t++)
+            {
+                if (row[t].load(std::memory_order_relaxed))
+                {
+                    row[t].store(0, std::memory_order_relaxed);
+                    if (t0 < 0) t0 = t;
+                    t1 = t;
+                }
+            }
+
+            if (t0 < 0)
+                continue;
+
+            if (band_y0 >= 0 && y - band_y1 > max_row_gap)
+                flushBand();
+
+            if (band_y0 < 0) band_y0 = y;
+            band_y1 = y;
+            band_t0 = std::min(band_t0, t0);
+            band_t1 = std::max(band_t1, t1);
         }
+
+        flushBand();
     }
 
     /*void draw(NVGcontext* vg, double x, double y, double w, double h)
@@ -385,12 +615,29 @@ public:
         return static_cast<IVec2>(worldToUVRatio(p) / bmp_size);
     }
 
+    // Claims the next [first, end) rows for a worker. Performance cores take chunks proportional
+    // to the remaining work, efficiency cores take single rows so they can't straggle at the end
+    // of a frame. With a timeout, single rows keep the cut-off precise.
+    [[nodiscard]] std::pair<int, int> claimRows(std::atomic<int>& next_row, int thread_count, bool single_rows) const
+    {
+        int chunk = 1;
+        if (!single_rows && Thread::currentCoreClass() != Thread::CoreClass::EFFICIENCY)
+        {
+            int remaining = bmp_height - next_row.load(std::memory_order_relaxed);
+            chunk = std::max(1, remaining / (4 * thread_count));
+        }
+
+        const int first = next_row.fetch_add(chunk, std::memory_order_relaxed);
+        return { first, std::min(first + chunk, bmp_height) };
+    }
+
     template<typename T = double, typename Callback>
     bool forEachPixel(
         int& current_row,
         Callback&& callback,
-        int thread_count = Thread::idealThreadCount(),
-        int timeout_ms = 0)
+        int thread_count = Thread::workerCount(),
+        int timeout_ms = 0,
+        Thread::Priority priority = Thread::Priority::INTERACTIVE)
     {
         static_assert(std::is_invocable_r_v<void, Callback, int, int>,
             "Callback must be: void(int x, int y)");
@@ -402,67 +649,40 @@ public:
         if (thread_count > 0)
         {
             auto start_time = std::chrono::steady_clock::now();
+            Camera* active_camera = Camera::active;
 
-            std::vector<std::future<void>> futures(thread_count);
-            std::vector<std::atomic<bool>> active_threads(thread_count);
-
-            for (int ti = 0; ti < thread_count; ti++)
-                active_threads[ti].store(false);
-
+            std::atomic<int> next_row{ current_row };
             std::atomic<bool> timed_out{ false };
 
-            // Continuously spin checking for idle threads and scheduling new rows...
-            while (!timed_out.load(std::memory_order_relaxed))
+            // Each task keeps claiming rows until none remain (or the timeout is exceeded)
+            Thread::TaskGroup group;
+            for (int ti = 0; ti < thread_count; ti++)
             {
-                for (int ti = 0; ti < thread_count; ti++)
+                Thread::submit(priority, [&]()
                 {
-                    if (timed_out.load(std::memory_order_relaxed))
-                        break;
-
-                    if (active_threads[ti].load(std::memory_order_relaxed))
-                        continue;
-
-                    // Found an idle thread...
+                    Camera::ActiveScope camera_scope(active_camera);
 
-                    const int thread_index = ti;
-                    const int row = current_row++;
-
-                    if (row >= bmp_height)
-                    {
-                        timed_out.store(true);
-                        break;
-                    }
-
-                    active_threads[ti].store(true);
-
-                    futures[ti] = Thread::pool().submit_task([&, row, thread_index]()
+                    while (!timed_out.load(std::memory_order_relaxed))
                     {
-                        for (int bmp_x = 0; bmp_x < bmp_width; ++bmp_x)
-                            std::forward<Callback>(callback)(bmp_x, row);
+                        auto [first_row, end_row] = claimRows(next_row, thread_count, timeout_ms != 0);
+                        if (first_row >= end_row)
+                            break;
 
-                        // After each row solved, check if timeout exceeded
-                        if (std::chrono::steady_clock::now() - start_time >= timeout)
-                        {
-                            // If so, signal that we shouldn't pick up any new tasks - break out the loop
-                            timed_out.store(true);
-                        }
-                        else
+                        for (int row = first_row; row < end_row; row++)
                         {
-                            // Otherwise, schedule the next available row
-                            active_threads[thread_index].store(false);
+                            for (int bmp_x = 0; bmp_x < bmp_width; ++bmp_x)
+                                callback(bmp_x, row);
                         }
-                    });
-                }
 
-                std::this_thread::yield();
+                        if (std::chrono::steady_clock::now() - start_time >= timeout)
+                            timed_out.store(true, std::memory_order_relaxed);
+                    }
+                }, &group);
             }
+            group.wait();
 
-            // After timing out, wait for remaining threads to finalize
-            for (int ti = 0; ti < thread_count; ti++)
-            {
-                if (futures[ti].valid())
-                    futures[ti].get();
-            }
+            // Rows are claimed in order and every claimed row is finished, so resume after them
+            current_row = std::min(next_row.load(), bmp_height);
         }
         else
         {
@@ -489,9 +709,10 @@ public:
     bool forEachWorldPixel(
         int& current_row,
         Callback&& callback,
-        int thread_count = Thread::idealThreadCount(),
+        int thread_count = Thread::workerCount(),
         int timeout_ms = 0,
-        std::atomic<bool>*busy = nullptr
+        std::atomic<bool>*busy = nullptr,
+        Thread::Priority priority = Thread::Priority::INTERACTIVE
     )
     {
         auto timeout = timeout_ms ?
@@ -516,89 +737,65 @@ public:
             }
 
             auto start_time = std::chrono::steady_clock::now();
+            Camera* active_camera = Camera::active;
 
-            std::vector<std::future<void>> futures(thread_count);
-            std::vector<std::atomic<bool>> active_threads(thread_count);
-            
-            for (int ti = 0; ti < thread_count; ti++)
-                active_threads[ti].store(false);
-            
+            std::atomic<int> next_row{ current_row };
             std::atomic<bool> timed_out{ false };
 
-            // Continuously spin checking for idle threads and scheduling new rows...
-            while (!timed_out.load(std::memory_order_relaxed))
+            // Each task keeps claiming rows until none remain (or the timeout is exceeded)
+            Thread::TaskGroup group;
+            for (int ti = 0; ti < thread_count; ti++)
             {
-                for (int ti = 0; ti < thread_count; ti++)
+                Thread::submit(priority, [&, thread_index = ti]()
                 {
-                    if (timed_out.load(std::memory_order_relaxed))
-                        break;
+                    Camera::ActiveScope camera_scope(active_camera);
 
-                    if (active_threads[ti].load(std::memory_order_relaxed))
-                        continue;
-
-                    // Found an idle thread...
-
-                    const int thread_index = ti;
-                    const int row = current_row++;
-
-                    if (row >= bmp_height)
+                    while (!timed_out.load(std::memory_order_relaxed))
                     {
-                        timed_out.store(true);
-                        break;
-                    }
-                  
-                    active_threads[thread_index].store(true, std::memory_order_relaxed);
-                    if (busy) busy[thread_index].store(true, std::memory_order_relaxed);
+                        auto [first_row, end_row] = claimRows(next_row, thread_count, timeout_ms != 0);
+                        if (first_row >= end_row)
+                            break;
 
-                    futures[ti] = Thread::pool().submit_task([&, row, thread_index]()
-                    {
-                        // Interpolate row pixel coordinate and invoke callback
-                        T bmp_fx, bmp_fy = static_cast<T>(row) + T{ 0.5 };
-                        T _v = bmp_fy / t_bmp_h;
-                        T scan_left_x = ax + (dx - ax) * _v;
-                        T scan_left_y = ay + (dy - ay) * _v;
-                        T scan_right_x = bx + (cx - bx) * _v;
-                        T scan_right_y = by + (cy - by) * _v;
-                        for (int bmp_x = 0; bmp_x < bmp_width; ++bmp_x)
+                        for (int row = first_row; row < end_row; row++)
                         {
-                            bmp_fx = static_cast<T>(bmp_x) + T{ 0.5 };
-                            T _u = bmp_fx / t_bmp_w;
-                            T wx = scan_left_x + (scan_right_x - scan_left_x) * _u;
-                            T wy = scan_left_y + (scan_right_y - scan_left_y) * _u;
-
-                            if constexpr (std::is_invocable_r_v<void, Callback, int, int, T, T, int>)
-                                std::forward<Callback>(callback)(bmp_x, row, wx, wy, thread_index); 
-                            else if constexpr (std::is_invocable_r_v<void, Callback, int, int, T, T>)
-                                std::forward<Callback>(callback)(bmp_x, row, wx, wy);
-                            else 
-                                static_assert(sizeof(Callback) == 0,
-                                    "Callback must be: void( int x, int y, float_t wx, float_y wy, [[optional]] int thread_index)");
-                        }
+                            if (busy) busy[thread_index].store(true, std::memory_order_relaxed);
+
+                            // Interpolate row pixel coordinate and invoke callback
+                            T bmp_fx, bmp_fy = static_cast<T>(row) + T{ 0.5 };
+                            T _v = bmp_fy / t_bmp_h;
+                            T scan_left_x = ax + (dx - ax) * _v;
+                            T scan_left_y = ay + (dy - ay) * _v;
+                            T scan_right_x = bx + (cx - bx) * _v;
+                            T scan_right_y = by + (cy - by) * _v;
+                            for (int bmp_x = 0; bmp_x < bmp_width; ++bmp_x)
+                            {
+                                bmp_fx = static_cast<T>(bmp_x) + T{ 0.5 };
+                                T _u = bmp_fx / t_bmp_w;
+                                T wx = scan_left_x + (scan_right_x - scan_left_x) * _u;
+                                T wy = scan_left_y + (scan_right_y - scan_left_y) * _u;
+
+                                if constexpr (std::is_invocable_r_v<void, Callback, int, int, T, T, int>)
+                                    callback(bmp_x, row, wx, wy, thread_index);
+                                else if constexpr (std::is_invocable_r_v<void, Callback, int, int, T, T>)
+                                    callback(bmp_x, row, wx, wy);
+                                else 
+                                    static_assert(sizeof(Callback) == 0,
+                                        "Callback must be: void( int x, int y, float_t wx, float_y wy, [[optional]] int thread_index)");
+                            }
 
-                        // After each row solved, check if timeout exceeded
-                        if (std::chrono::steady_clock::now() - start_time >= timeout)
-                        {
-                            // If so, signal that we shouldn't pick up any new tasks - break out the loop
-                            timed_out.store(true);
-                        }
-                        else
-                        {
-                            // Otherwise, schedule the next available row
-                            active_threads[thread_index].store(false);
                             if (busy) busy[thread_index].store(false, std::memory_order_relaxed);
                         }
-                    });
-                }
 
-                std::this_thread::yield();
+                        // After each claim solved, check if timeout exceeded
+                        if (std::chrono::steady_clock::now() - start_time >= timeout)
+                            timed_out.store(true, std::memory_order_relaxed);
+                    }
+                }, &group);
             }
+            group.wait();
 
-            // After timing out, wait for remaining threads to finalize
-            for (int ti = 0; ti < thread_count; ti++)
-            {
-                if (futures[ti].valid())
-                    futures[ti].get();
-            }
+            // Rows are claimed in order and every claimed row is finished, so resume after them
+            current_row = std::min(next_row.load(), bmp_height);
         }
         else
         {
@@ -641,7 +838,7 @@ public:
     template<typename Callback>
     void forEachPixel(
         Callback&& callback,
-        int thread_count = Thread::idealThreadCount())
+        int thread_count = Thread::workerCount())
     {
         int row = 0;
         forEachPixel(
@@ -656,7 +853,7 @@ public:
     void forEachWorldPixel(
         Camera* camera,
         Callback&& callback,
-        int thread_count = Thread::idealThreadCount())
+        int thread_count = Thread::workerCount())
     {
         int row = 0;
         forEachWorldPixel(
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <span>
+#include <unordered_map>
 
 #include "platform.h"
 
@@ -8,6 +12,9 @@
 #include "nanovg/nanovg_gl.h"
 
 #include "nano_bitmap.h"
+#include "display_list.h"
+#include "text_layout.h"
+#include "vector_paths.h"
 #include "camera.h"
 #include "debug.h"
 
@@ -29,7 +36,8 @@ enum struct LineCap
 enum struct LineJoin
 {
     JOIN_BEVEL = NVGlineCap::NVG_BEVEL,
-    JOIN_MITER = NVGlineCap::NVG_MITER
+    JOIN_MITER = NVGlineCap::NVG_MITER,
+    JOIN_ROUND = NVGlineCap::NVG_ROUND
 };
 enum struct TextAlign
 {
@@ -75,14 +83,36 @@ enum struct BlendFactor
 class NanoFont
 {
     friend class SimplePainter;
+    friend class DisplayList;
 
 protected:
 
     std::string path;
     int id = 0;
     bool created = false;
+    NVGcontext* owner = nullptr; // Context 'id' belongs to
+    int measure_id = 0;          // Display list measuring context (worker thread)
+    bool measure_created = false;
     float size = 16.0f;
 
+    // Font id on 'vg', created on first use. Contexts other than the owner (e.g. a
+    // software canvas) look it up by path
+    int contextId(NVGcontext* vg)
+    {
+        if (!created)
+        {
+            id = nvgCreateFont(vg, path.c_str(), path.c_str());
+            owner = vg;
+            created = true;
+        }
+
+        if (vg == owner)
+            return id;
+
+        int other = nvgFindFont(vg, path.c_str());
+        return other >= 0 ? other : nvgCreateFont(vg, path.c_str(), path.c_str());
+    }
+
 public:
 
     static std::shared_ptr<NanoFont> create(const char* virtual_path)
@@ -118,6 +148,11 @@ protected:
 
     NVGcontext* vg = nullptr;
 
+    // While recording, 'vg' is the display list's measuring context. State (transforms,
+    // fonts, styles) is applied to it *and* recorded, so it can still be queried. Path
+    // and output calls are only recorded
+    DisplayList* display_list = nullptr;
+
     TextAlign text_align = TextAlign::ALIGN_LEFT;
     TextBaseline text_baseline = TextBaseline::BASELINE_TOP;
 
@@ -126,6 +161,10 @@ protected:
     
     double global_scale = 1.0;
 
+    template<typename... Args>
+    void record(DrawOp op, Args... args) const { if (display_list) display_list->push(op, args...); }
+    void recordColor(DrawOp op, NVGcolor c) const { if (display_list) display_list->pushColor(op, c); }
+
 public:
 
     void setGlobalScale(double _global_scale) {
@@ -135,14 +174,15 @@ public:
         return global_scale; 
     }
 
-    void setRenderTarget(NVGcontext* nvg_ctx) { vg = nvg_ctx; }
+    void setRenderTarget(NVGcontext* nvg_ctx, DisplayList* list = nullptr) { vg = nvg_ctx; display_list = list; }
     [[nodiscard]] NVGcontext* getRenderTarget() { return vg; }
+    [[nodiscard]] bool recording() const { return display_list != nullptr; }
     [[nodiscard]] std::shared_ptr<NanoFont> getDefaultFont() { return default_font; }
 
     // ======== Transforms ========
 
-    void save() const { nvgSave(vg); }
-    void restore() { nvgRestore(vg); }
+    void save() const { nvgSave(vg); record(DrawOp::SAVE); }
+    void restore() { nvgRestore(vg); record(DrawOp::RESTORE); }
     struct LocalTransform
     {
         SimplePainter* painter;
@@ -150,67 +190,77 @@ public:
         ~LocalTransform() { painter->restore(); }
     };
 
-    void resetTransform()                                    { nvgResetTransform(vg); }
-    void transform(const glm::mat3& m)                       { nvgTransform(vg, m[0][0], m[0][1], m[1][0], m[1][1], m[2][0], m[2][1]); }
-    glm::mat3 currentTransform() const                       { float x[6]; nvgCurrentTransform(vg, x); return glm::mat3(x[0], x[1], 0, x[2], x[3], 0, x[4], x[5], 1); }
-
-    void translate(double x, double y)                       { nvgTranslate(vg, (float)(x), (float)(y)); }
-    void translate(DVec2 p)                                  { nvgTranslate(vg, (float)(p.x), (float)(p.y)); }
-    void rotate(double angle)                                { nvgRotate(vg, (float)(angle)); }
-    void scale(double scale)                                 { nvgScale(vg, (float)(scale), (float)(scale)); }
-    void scale(double scale_x, double scale_y)               { nvgScale(vg, (float)(scale_x), (float)(scale_y)); }
-    void skewX(double angle)                                 { nvgSkewX(vg, (float)(angle)); }
-    void skewY(double angle)                                 { nvgSkewY(vg, (float)(angle)); }
-    void setClipRect(double x, double y, double w, double h) { nvgScissor(vg, (float)(x), (float)(y), (float)(w), (float)(h)); }
-    void resetClipping() { nvgResetScissor(vg); }
+    void resetTransform() { nvgResetTransform(vg); record(DrawOp::RESET_TRANSFORM); }
+    void transform(const glm::mat3& m)
+    {
+        nvgTransform(vg, m[0][0], m[0][1], m[1][0], m[1][1], m[2][0], m[2][1]);
+        record(DrawOp::TRANSFORM, m[0][0], m[0][1], m[1][0], m[1][1], m[2][0], m[2][1]);
+    }
+    glm::mat3 currentTransform() const { float x[6]; nvgCurrentTransform(vg, x); return glm::mat3(x[0], x[1], 0, x[2], x[3], 0, x[4], x[5], 1); }
+
+    void translate(double x, double y)                       { nvgTranslate(vg, (float)(x), (float)(y)); record(DrawOp::TRANSLATE, x, y); }
+    void translate(DVec2 p)                                  { translate(p.x, p.y); }
+    void rotate(double angle)                                { nvgRotate(vg, (float)(angle)); record(DrawOp::ROTATE, angle); }
+    void scale(double scale)                                 { this->scale(scale, scale); }
+    void scale(double scale_x, double scale_y)               { nvgScale(vg, (float)(scale_x), (float)(scale_y)); record(DrawOp::SCALE, scale_x, scale_y); }
+    void skewX(double angle)                                 { nvgSkewX(vg, (float)(angle)); record(DrawOp::SKEW_X, angle); }
+    void skewY(double angle)                                 { nvgSkewY(vg, (float)(angle)); record(DrawOp::SKEW_Y, angle); }
+    void setClipRect(double x, double y, double w, double h) { nvgScissor(vg, (float)(x), (float)(y), (float)(w), (float)(h)); record(DrawOp::SCISSOR, x, y, w, h); }
+    void resetClipping()                                     { nvgResetScissor(vg); record(DrawOp::RESET_SCISSOR); }
 
     // ======== Styles ========
 
-    void setStrokeStyle(const Color& color)                  { nvgStrokeColor(vg, nvgRGBA(color.r, color.g, color.b, color.a)); }
-    void setFillStyle(const Color& color)                    { nvgFillColor(vg, nvgRGBA(color.r, color.g, color.b, color.a)); }
-    void setFillStyle(const float(&color)[3])                { nvgFillColor(vg, {color[0], color[1], color[2], 1.0f}); }
-    void setFillStyle(const float(&color)[4])                { nvgFillColor(vg, {color[0], color[1], color[2], color[3]}); }
-    void setFillStyle(int r, int g, int b, int a = 255)      { nvgFillColor(vg, nvgRGBA(r, g, b, a)); }
-    void setStrokeStyle(int r, int g, int b, int a = 255)    { nvgStrokeColor(vg, nvgRGBA(r, g, b, a)); }
-    void setLineWidth(double w)                              { nvgStrokeWidth(vg, (float)(w)); }
-    void setLineCap(LineCap cap)                             { nvgLineCap(vg, (int)cap); }
-    void setLineJoin(LineJoin join)                          { nvgLineJoin(vg, (int)join); }
+    void setFillStyle(NVGcolor c)                            { nvgFillColor(vg, c); recordColor(DrawOp::FILL_COLOR, c); }
+    void setStrokeStyle(NVGcolor c)                          { nvgStrokeColor(vg, c); recordColor(DrawOp::STROKE_COLOR, c); }
+    void setStrokeStyle(const Color& color)                  { setStrokeStyle(nvgRGBA(color.r, color.g, color.b, color.a)); }
+    void setFillStyle(const Color& color)                    { setFillStyle(nvgRGBA(color.r, color.g, color.b, color.a)); }
+    void setFillStyle(const float(&color)[3])                { setFillStyle(NVGcolor{ color[0], color[1], color[2], 1.0f }); }
+    void setFillStyle(const float(&color)[4])                { setFillStyle(NVGcolor{ color[0], color[1], color[2], color[3] }); }
+    void setFillStyle(int r, int g, int b, int a = 255)      { setFillStyle(nvgRGBA(r, g, b, a)); }
+    void setStrokeStyle(int r, int g, int b, int a = 255)    { setStrokeStyle(nvgRGBA(r, g, b, a)); }
+    void setLineWidth(double w)                              { nvgStrokeWidth(vg, (float)(w)); record(DrawOp::STROKE_WIDTH, w); }
+    void setLineCap(LineCap cap)                             { nvgLineCap(vg, (int)cap); record(DrawOp::LINE_CAP, (int)cap); }
+    void setLineJoin(LineJoin join)                          { nvgLineJoin(vg, (int)join); record(DrawOp::LINE_JOIN, (int)join); }
 
     // ======== Paths ========
 
-    void beginPath()                                         { nvgBeginPath(vg); }
-    void moveTo(double x, double y)                          { nvgMoveTo(vg, (float)(x), (float)(y)); }
-    void lineTo(double x, double y)                          { nvgLineTo(vg, (float)(x), (float)(y)); }
-    void moveTo(DVec2 p)                                     { nvgMoveTo(vg, (float)(p.x), (float)(p.y)); }
-    void lineTo(DVec2 p)                                     { nvgLineTo(vg, (float)(p.x), (float)(p.y)); }
-    void stroke()                                            { nvgStroke(vg); }
-    void fill()                                              { nvgFill(vg); }
-    void closePath()                                         { nvgClosePath(vg); }
+    void beginPath()                                         { if (display_list) record(DrawOp::BEGIN_PATH); else nvgBeginPath(vg); }
+    void moveTo(double x, double y)                          { if (display_list) record(DrawOp::MOVE_TO, x, y); else nvgMoveTo(vg, (float)(x), (float)(y)); }
+    void lineTo(double x, double y)                          { if (display_list) record(DrawOp::LINE_TO, x, y); else nvgLineTo(vg, (float)(x), (float)(y)); }
+    void moveTo(DVec2 p)                                     { moveTo(p.x, p.y); }
+    void lineTo(DVec2 p)                                     { lineTo(p.x, p.y); }
+    void stroke()                                            { if (display_list) record(DrawOp::STROKE); else nvgStroke(vg); }
+    void fill()                                              { if (display_list) record(DrawOp::FILL); else nvgFill(vg); }
+    void closePath()                                         { if (display_list) record(DrawOp::CLOSE_PATH); else nvgClosePath(vg); }
 
     void bezierTo(double x1, double y1, double x2, double y2, double x, double y) {
-        nvgBezierTo(vg, (float)(x1), (float)(y1), (float)(x2), (float)(y2), (float)(x), (float)(y));
+        if (display_list) record(DrawOp::BEZIER_TO, x1, y1, x2, y2, x, y);
+        else nvgBezierTo(vg, (float)(x1), (float)(y1), (float)(x2), (float)(y2), (float)(x), (float)(y));
     }
     void bezierTo(DVec2 p1, DVec2 p2, DVec2 p) {
-        nvgBezierTo(vg, (float)p1.x, (float)p1.y, (float)p2.x, (float)p2.y, (float)p.x, (float)p.y);
+        bezierTo(p1.x, p1.y, p2.x, p2.y, p.x, p.y);
     }
     void quadraticTo(double cx, double cy, double x, double y) {
-        nvgQuadTo(vg, (float)(cx), (float)(cy), (float)(x), (float)(y));
+        if (display_list) record(DrawOp::QUAD_TO, cx, cy, x, y);
+        else nvgQuadTo(vg, (float)(cx), (float)(cy), (float)(x), (float)(y));
     }
     void quadraticTo(DVec2 c, DVec2 p) {
-        nvgQuadTo(vg, (float)c.x, (float)c.y, (float)p.x, (float)p.y);
+        quadraticTo(c.x, c.y, p.x, p.y);
     }
 
     void arc(double cx, double cy, double r, double a0, double a1, PathWinding winding = PathWinding::WINDING_CCW) {
-        nvgArc(vg, (float)(cx), (float)(cy), (float)(r), (float)(a0), (float)(a1), (int)winding);
+        if (display_list) record(DrawOp::ARC, cx, cy, r, a0, a1, (int)winding);
+        else nvgArc(vg, (float)(cx), (float)(cy), (float)(r), (float)(a0), (float)(a1), (int)winding);
     }
     void arc(DVec2 cen, double r, double a0, double a1, PathWinding winding = PathWinding::WINDING_CCW) {
-        nvgArc(vg, (float)(cen.x), (float)(cen.y), (float)(r), (float)(a0), (float)(a1), (int)winding);
+        arc(cen.x, cen.y, r, a0, a1, winding);
     }
     void arcTo(double x0, double y0, double x1, double y1, double r) {
-        nvgArcTo(vg, (float)(x0), (float)(y0), (float)(x1), (float)(y1), (float)(r));
+        if (display_list) record(DrawOp::ARC_TO, x0, y0, x1, y1, r);
+        else nvgArcTo(vg, (float)(x0), (float)(y0), (float)(x1), (float)(y1), (float)(r));
     }
     void arcTo(DVec2 p0, DVec2 p1, double r) {
-        nvgArcTo(vg, (float)(p0.x), (float)(p0.y), (float)(p1.x), (float)(p1.y), (float)(r));
+        arcTo(p0.x, p0.y, p1.x, p1.y, r);
     }
 
     template<typename PointT> void drawPath(const std::vector<PointT>& path) {
@@ -223,24 +273,51 @@ public:
 
     // ======== Shapes ========
 
-    void circle(double cx, double cy, double r) { nvgCircle(vg, (float)(cx), (float)(cy), (float)(r)); }
-    void circle(DVec2 p, double r) { nvgCircle(vg, (float)(p.x), (float)(p.y), (float)(r)); }
-    void ellipse(double cx, double cy, double rx, double ry) { nvgEllipse(vg, (float)(cx), (float)(cy), (float)(rx), (float)(ry)); }
-    void ellipse(DVec2 cen, DVec2 size) { nvgEllipse(vg, (float)(cen.x), (float)(cen.y), (float)(size.x), (float)(size.y)); }
-    void fillRect(double x, double y, double w, double h) { nvgBeginPath(vg); nvgRect(vg, (float)(x), (float)(y), (float)(w), (float)(h)); nvgFill(vg); }
-    void strokeRect(double x, double y, double w, double h) { nvgBeginPath(vg); nvgRect(vg, (float)(x), (float)(y), (float)(w), (float)(h)); nvgStroke(vg); }
+    void circle(double cx, double cy, double r) {
+        if (display_list) record(DrawOp::CIRCLE, cx, cy, r);
+        else nvgCircle(vg, (float)(cx), (float)(cy), (float)(r));
+    }
+    void circle(DVec2 p, double r) { circle(p.x, p.y, r); }
+    void ellipse(double cx, double cy, double rx, double ry) {
+        if (display_list) record(DrawOp::ELLIPSE, cx, cy, rx, ry);
+        else nvgEllipse(vg, (float)(cx), (float)(cy), (float)(rx), (float)(ry));
+    }
+    void ellipse(DVec2 cen, DVec2 size) { ellipse(cen.x, cen.y, size.x, size.y); }
+    void rect(double x, double y, double w, double h) {
+        if (display_list) record(DrawOp::RECT, x, y, w, h);
+        else nvgRect(vg, (float)(x), (float)(y), (float)(w), (float)(h));
+    }
+    void roundedRect(double x, double y, double w, double h, double r) {
+        if (display_list) record(DrawOp::ROUNDED_RECT, x, y, w, h, r);
+        else nvgRoundedRect(vg, (float)(x), (float)(y), (float)(w), (float)(h), (float)(r));
+    }
+    void fillRect(double x, double y, double w, double h) { beginPath(); rect(x, y, w, h); fill(); }
+    void strokeRect(double x, double y, double w, double h) { beginPath(); rect(x, y, w, h); stroke(); }
 
     void strokeRoundedRect(double x, double y, double w, double h, double r)
     {
-        nvgBeginPath(vg);
-        nvgRoundedRect(vg, (float)(x), (float)(y), (float)(w), (float)(h), (float)(r));
-        nvgStroke(vg);
+        beginPath();
+        roundedRect(x, y, w, h, r);
+        stroke();
     }
     void fillRoundedRect(double x, double y, double w, double h, double r)
     {
-        nvgBeginPath(vg);
-        nvgRoundedRect(vg, (float)(x), (float)(y), (float)(w), (float)(h), (float)(r));
-        nvgFill(vg);
+        beginPath();
+        roundedRect(x, y, w, h, r);
+        fill();
+    }
+
+    // ======== Batched circles ========
+
+    // Fills 'count' circles of radius 'r' centered on packed (x, y) pairs, with one draw call per
+    // run of equal RGBA8 'colors' (or a single call in the fill style if 'colors' is null).
+    // Small circles are quads sampling a disc sprite, large ones fall back to paths
+    static void paintCircles(NVGcontext* ctx, const float* xy, int count, float r, const uint32_t* colors);
+
+    void fillCircles(const float* xy, int count, double r, const uint32_t* colors = nullptr)
+    {
+        if (display_list) display_list->pushCircles(xy, count, (float)r, colors);
+        else paintCircles(vg, xy, count, (float)r, colors);
     }
 
     // ======== Image ========
@@ -253,27 +330,79 @@ public:
     //    bmp.drawSheared(vg, quad);
     //}
 
+    // Fills the unit square, transformed by m, with the image (uploading changed pixels first).
+    // GUI thread only, recorded images are painted when replayed
+    static void paintImage(NVGcontext* ctx, Image& bmp, const float* m)
+    {
+        bmp.refreshData(ctx);
+
+        // The bitmap is the top-left of its texture, so stretch the texture beyond the unit square
+        float extent_x = bmp.width() > 0 ? (float)bmp.textureWidth() / (float)bmp.width() : 1.0f;
+        float extent_y = bmp.height() > 0 ? (float)bmp.textureHeight() / (float)bmp.height() : 1.0f;
+
+        nvgSave(ctx);
+        nvgTransform(ctx, m[0], m[1], m[2], m[3], m[4], m[5]);
+        NVGpaint paint = nvgImagePattern(ctx, 0, 0, extent_x, extent_y, 0.0f, bmp.imageId(), 1.0f);
+        nvgBeginPath(ctx);
+        nvgRect(ctx, 0, 0, 1, 1);
+        nvgFillPaint(ctx, paint);
+        nvgFill(ctx);
+        nvgRestore(ctx);
+    }
+
+    void drawImageTransformed(Image& bmp, const float(&m)[6])
+    {
+        if (display_list) display_list->pushImage(&bmp, m);
+        else paintImage(vg, bmp, m);
+    }
+
     // ======== Text ========
 
-    void setTextAlign(TextAlign align)          { text_align = align;       nvgTextAlign(vg, (int)(text_align) | (int)(text_baseline)); }
-    void setTextBaseline(TextBaseline baseline) { text_baseline = baseline; nvgTextAlign(vg, (int)(text_align) | (int)(text_baseline)); }
-    void setFontSize(double size_pts)           { nvgFontSize(vg, (float)(global_scale * size_pts)); }
+    void setTextAlign(TextAlign align)          { text_align = align;       applyTextAlign(); }
+    void setTextBaseline(TextBaseline baseline) { text_baseline = baseline; applyTextAlign(); }
+    void applyTextAlign()
+    {
+        int align = (int)(text_align) | (int)(text_baseline);
+        nvgTextAlign(vg, align);
+        record(DrawOp::TEXT_ALIGN, align);
+    }
+    void setFontSize(double size_pts)
+    {
+        float size = (float)(global_scale * size_pts);
+        nvgFontSize(vg, size);
+        record(DrawOp::FONT_SIZE, size);
+    }
     void setFont(std::shared_ptr<NanoFont> font)
     {
         if (font == active_font)
             return;
 
-        if (!font->created)
+        if (display_list)
         {
-            font->id = nvgCreateFont(vg, font->path.c_str(), font->path.c_str());
-            font->created = true;
+            // Created on the GUI context when replayed, the measuring context needs its own copy
+            if (!font->measure_created)
+            {
+                font->measure_id = nvgCreateFont(vg, font->path.c_str(), font->path.c_str());
+                font->measure_created = true;
+
+                // Todo: Check if font changed and update even if already created
+                setFontSize(font->size);
+            }
 
-            // Todo: Check if font changed and update even if already created
-            nvgFontSize(vg, (float)global_scale * font->size);
+            nvgFontFaceId(vg, font->measure_id);
+            display_list->pushFont(font);
+        }
+        else
+        {
+            if (!font->created)
+            {
+                // Todo: Check if font changed and update even if already created
+                nvgFontSize(vg, (float)global_scale * font->size);
+            }
 
+            nvgFontFaceId(vg, font->contextId(vg));
         }
 
-        nvgFontFaceId(vg, font->id);
         active_font = font;
     }
 
@@ -281,7 +410,7 @@ public:
     [[nodiscard]] DRect boundingBox(std::string_view txt) const
     {
         float bounds[4];
-        nvgTextBounds(vg, 0, 0, txt.data(), txt.data()+txt.size(), bounds);
+        TextLayoutCache::of(vg).bounds(txt, bounds);
         return DRect((double)(bounds[0]), (double)(bounds[1]), (double)(bounds[2] - bounds[0]), (double)(bounds[3] - bounds[1]));
     }
 
@@ -289,7 +418,8 @@ public:
     void fillText(std::string_view txt, double x, double y)
     {
         if (!active_font) setFont(default_font);
-        nvgText(vg, (float)(x), (float)(y), txt.data(), txt.data() + txt.size());
+        if (display_list) display_list->pushText((float)(x), (float)(y), txt);
+        else TextLayoutCache::of(vg).fillText((float)(x), (float)(y), txt);
     }
 };
 
@@ -303,6 +433,70 @@ public:
 
 class Painter : private SimplePainter
 {
+    struct RetainedPath
+    {
+        DisplayList source;         // As drawn, in world space
+        DisplayList flattened;      // Curves flattened, relative to origin
+        float origin_x = 0.0f;
+        float origin_y = 0.0f;
+        double flattened_zoom = 0.0;
+    };
+
+    std::unordered_map<std::string, RetainedPath> retained_paths;
+
+    template<typename Fn>
+    void capturePath(DisplayList& out, Fn&& draw)
+    {
+        // Record in world space with the camera transform switched off, leaving painter state as it was
+        DisplayList* target = display_list;
+        std::shared_ptr<NanoFont> font = active_font;
+        double width = line_width;
+        bool flags[3] = { camera.transform_coordinates, camera.scale_lines, camera.scale_sizes };
+
+        nvgSave(vg);
+        display_list = &out;
+        camera.transform_coordinates = camera.scale_lines = camera.scale_sizes = false;
+
+        draw();
+
+        camera.transform_coordinates = flags[0];
+        camera.scale_lines = flags[1];
+        camera.scale_sizes = flags[2];
+        display_list = target;
+        active_font = font;
+        line_width = width;
+        nvgRestore(vg);
+    }
+
+    void drawRetainedPath(RetainedPath& path);
+    void emitVectorPaths(const VectorPaths& paths);
+
+    // Reused by drawCircles() / drawPoints()
+    std::vector<float> batch_xy;
+    std::vector<uint32_t> batch_colors;
+
+    template<typename PointT>
+    void batchCircles(std::span<const PointT> positions, double r, std::span<const Color> colors)
+    {
+        batch_xy.resize(positions.size() * 2);
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            DVec2 p = PT(positions[i].x, positions[i].y);
+            batch_xy[i * 2] = (float)p.x;
+            batch_xy[i * 2 + 1] = (float)p.y;
+        }
+
+        // Colors only apply if there's one per circle
+        const uint32_t* packed = nullptr;
+        if (!colors.empty() && colors.size() == positions.size())
+        {
+            batch_colors.assign(colors.begin(), colors.end());
+            packed = batch_colors.data();
+        }
+
+        SimplePainter::fillCircles(batch_xy.data(), (int)positions.size(), r, packed);
+    }
+
     double _avgZoom() {
         return (fabs(camera.zoomX()) + fabs(camera.zoomY())) * 0.5;
     }
@@ -471,6 +665,31 @@ public:
     void strokeEllipse(double cx, double cy, double r) { strokeEllipse(cx, cy, r, r); }
     void fillEllipse(double cx, double cy, double r)   { fillEllipse(cx, cy, r, r); }
 
+    // ======== Batched circles ========
+
+    // Fills every circle with one draw call (per run of equal 'colors', otherwise in the fill
+    // style), rather than a path per circle. For particles, markers, etc.
+    // Positions follow camera.transform_coordinates, the radius follows camera.scale_sizes
+    template<typename PointT>
+    void drawCircles(std::span<const PointT> positions, double radius, std::span<const Color> colors = {})
+    {
+        batchCircles(positions, SIZE(radius), colors);
+    }
+
+    // As drawCircles(), but dots have a fixed diameter in stage pixels whatever the zoom
+    template<typename PointT>
+    void drawPoints(std::span<const PointT> positions, double size = 1.0, std::span<const Color> colors = {})
+    {
+        batchCircles(positions, size * 0.5, colors);
+    }
+
+    template<typename PointT> void drawCircles(const std::vector<PointT>& positions, double radius, std::span<const Color> colors = {}) {
+        drawCircles(std::span<const PointT>(positions), radius, colors);
+    }
+    template<typename PointT> void drawPoints(const std::vector<PointT>& positions, double size = 1.0, std::span<const Color> colors = {}) {
+        drawPoints(std::span<const PointT>(positions), size, colors);
+    }
+
     void drawArrow(DVec2 a, DVec2 b, Color color)
     {
         double dx = b.x - a.x;
@@ -517,17 +736,8 @@ public:
         DVec2 u = quad.b - quad.a;
         DVec2 v = quad.d - quad.a;
 
-        bmp.refreshData(vg);
-
-        nvgSave(vg);
-        nvgTransform(vg, (float)u.x, (float)u.y, (float)v.x, (float)v.y, (float)a.x, (float)a.y);
-        NVGpaint paint = nvgImagePattern(vg, 0, 0, 1, 1, 0.0f, bmp.imageId(), 1.0f);
-        nvgBeginPath(vg);
-        nvgRect(vg, 0, 0, 1, 1);
-        nvgFillPaint(vg, paint);
-        nvgFill(vg);
-
-        nvgRestore(vg);
+        const float m[6] = { (float)u.x, (float)u.y, (float)v.x, (float)v.y, (float)a.x, (float)a.y };
+        drawImageTransformed(bmp, m);
     }
     void drawImage(CanvasImage& bmp)
     {
@@ -606,11 +816,13 @@ public:
 
     [[nodiscard]] DRect boundingBox(std::string_view txt)
     {
-        save();
-        resetTransform();
-        transform(default_viewport_transform);
+        // Measured under the default transform, nothing is drawn so the state change isn't recorded
+        const glm::mat3& m = default_viewport_transform;
+        nvgSave(vg);
+        nvgResetTransform(vg);
+        nvgTransform(vg, m[0][0], m[0][1], m[1][0], m[1][1], m[2][0], m[2][1]);
         auto r = SimplePainter::boundingBox(txt);
-        restore();
+        nvgRestore(vg);
         return r;
     }
 
@@ -798,6 +1010,35 @@ public:
         SimplePainter::fillText(txt, align_full(PT(pos)));
     }
 
+    // ======== Retained paths ========
+    //
+    // Static geometry (e.g. an SVG) drawn by 'draw' is captured once per key, in world space.
+    // Its curves are flattened for the current zoom, and each frame draws the cached lines
+    // under a single camera transform rather than re-issuing (and nanovg re-flattening)
+    // every curve. Re-flattened from the capture (not re-drawn) once the zoom drifts far
+    // enough from the zoom it was flattened for.
+    //
+    // Follows camera.transform_coordinates & camera.scale_lines (not scale_sizes)
+
+    template<typename Fn>
+    void cachePath(const std::string& key, Fn&& draw)
+    {
+        auto [it, inserted] = retained_paths.try_emplace(key);
+        if (inserted)
+            capturePath(it->second.source, std::forward<Fn>(draw));
+
+        drawRetainedPath(it->second);
+    }
+
+    void uncachePath(const std::string& key) { retained_paths.erase(key); }
+    void clearPathCache() { retained_paths.clear(); }
+
+    // Packed vector paths (e.g. a converted SVG) in world space, retained by their cacheKey()
+    void drawVectorPaths(const VectorPaths& paths)
+    {
+        cachePath(paths.cacheKey(), [this, &paths] { emitVectorPaths(paths); });
+    }
+
     // ======== Axis Drawer ========
     void drawWorldAxis(
         double axis_opacity = 0.3,//0.3,
@@ -809,6 +1050,7 @@ public:
 
     using SimplePainter::setRenderTarget;
     using SimplePainter::getRenderTarget;
+    using SimplePainter::recording;
     using SimplePainter::setGlobalScale;
     using SimplePainter::getGlobalScale;
     //
@@ -843,22 +1085,76 @@ public:
     //using SimplePainter::quadraticTo;
 };
 
+enum struct CanvasBackend
+{
+    OPENGL,     // Renders into a GL framebuffer (texture())
+    SOFTWARE    // Rasterized on the CPU (pixels()), needs no GL context
+};
+
 class Canvas : public SimplePainter
 {
-    GLuint fbo = 0, tex = 0, rbo = 0;
+    CanvasBackend backend = CanvasBackend::OPENGL;
+
     int fbo_width = 0, fbo_height = 0;
 
+    // Pooled storage of at least fbo size (see StoragePool), so resizing within it only
+    // changes the area drawn to
+    StoragePool::RenderTarget target;
+    int storage_width = 0, storage_height = 0;
+
+    // Frames are drawn at fbo size, into the bottom-left (renderWidth() x renderHeight()) of the storage
+    std::atomic<double> resolution_scale{ 1.0 };
+
+    // Render size of the frame currently in storage (kept when only the scale changes, until redrawn)
+    int frame_width = 0, frame_height = 0;
+
+    std::vector<uint8_t> cpu_pixels; // SOFTWARE: premultiplied RGBA8, storage_width * 4 bytes per row
+
 public:
 
-    void create(double global_scale);
+    void create(double global_scale, CanvasBackend backend = CanvasBackend::OPENGL);
+    void destroy(); // Deletes the nanovg context and its images (GUI thread, GL context current)
     bool resize(int w, int h);
 
     void begin(float r, float g, float b, float a = 1.0);
     void end();
 
-    GLuint texture() { return tex; }
+    [[nodiscard]] CanvasBackend getBackend() const { return backend; }
+
+    GLuint texture() { return target.tex; }
     [[nodiscard]] int fboWidth() { return fbo_width; }
     [[nodiscard]] int fboHeight() { return fbo_height; }
+
+    // Size of the texture (or SOFTWARE pixel buffer) frames are drawn into
+    [[nodiscard]] int storageWidth() const { return storage_width; }
+    [[nodiscard]] int storageHeight() const { return storage_height; }
+
+    // ======== Dynamic resolution ========
+
+    // Fraction of the fbo size frames are rendered at (see DynamicResolution), returns true if
+    // the render size changed. Coordinates are unaffected, frames are scaled down when drawn
+    bool setResolutionScale(double scale);
+    [[nodiscard]] double resolutionScale() const { return resolution_scale.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] int renderWidth() const  { return std::max(1, (int)std::lround(fbo_width * resolutionScale())); }
+    [[nodiscard]] int renderHeight() const { return std::max(1, (int)std::lround(fbo_height * resolutionScale())); }
+
+    // Render size of the last drawn frame, which may differ from renderWidth() x renderHeight()
+    // until the next frame after a scale change
+    [[nodiscard]] int frameWidth() const  { return frame_width ? frame_width : renderWidth(); }
+    [[nodiscard]] int frameHeight() const { return frame_height ? frame_height : renderHeight(); }
+
+    // Texture coordinates of the last frame's top-right corner (for presenting just that area)
+    [[nodiscard]] float renderU() const { return storage_width ? (float)frameWidth() / (float)storage_width : 1.0f; }
+    [[nodiscard]] float renderV() const { return storage_height ? (float)frameHeight() / (float)storage_height : 1.0f; }
+
+    // SOFTWARE only: the last frame, premultiplied RGBA8 (storageWidth() * 4 bytes per row, the
+    // frame occupies the top-left frameWidth() x frameHeight())
+    [[nodiscard]] const uint8_t* pixels() const { return cpu_pixels.data(); }
+
+    // SOFTWARE only: the last frame as straight-alpha RGBA8, frameWidth() x frameHeight()
+    // (e.g. for writing to an image file). Empty for other backends
+    void readPixels(std::vector<uint8_t>& out) const;
 };
 
 GLuint loadSVG(const char* path, int outputWidth, int outputHeight);
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+#include "nanovg/nanovg.h"
+#include "debug.h"
+
+BL_BEGIN_NS
+
+// ======== Software nanovg renderer ========
+//
+// Renders nanovg on the CPU into a premultiplied RGBA8 buffer, so a Canvas (or a replayed
+// display list) can be drawn without a GL context, e.g. on GPU-less servers and in CI.
+//
+// Draw calls are queued as nanovg issues them and rasterized at nvgEndFrame(). The target
+// is split into horizontal bands, each rasterized by a different worker (every band walks
+// all calls in order, so blending stays correct). Fills & strokes get anti-aliased scanline
+// coverage (exact area per pixel), text is sampled from the glyph atlas.
+
+[[nodiscard]] NVGcontext* nvgCreateSoftware();
+void nvgDeleteSoftware(NVGcontext* vg);
+
+[[nodiscard]] bool nvgIsSoftware(NVGcontext* vg);
+
+// Target for the next nvgEndFrame(). nvgBeginFrame()'s size is stretched to fill it
+void nvgSoftwareFramebuffer(NVGcontext* vg, uint8_t* pixels, int width, int height, int stride);
+
+BL_END_NS
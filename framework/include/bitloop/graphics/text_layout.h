@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "nanovg/nanovg.h"
+#include "debug.h"
+
+BL_BEGIN_NS
+
+// ======== Text layout cache ========
+//
+// Shaped glyph runs & bounding boxes, keyed by the text and everything its shape depends on
+// (font, size, spacing, alignment and scale, which includes the device pixel ratio), so text
+// which doesn't change between frames (axis labels, print() lines) isn't shaped through
+// fontstash again. Changing font, size or DPR keys new layouts; glyph quads are re-shaped
+// whenever the font atlas evicts glyphs.
+//
+// One cache per nanovg context (see of()), only used by the thread drawing with that context
+
+class TextLayoutCache
+{
+    struct Layout
+    {
+        std::string text;
+        NVGtextLayoutState state{};
+
+        float bounds[4] = { 0, 0, 0, 0 };   // As nvgTextBounds() at 0,0
+        float advance = 0.0f;
+        bool measured = false;
+
+        std::vector<NVGvertex> quads;       // As nvgTextLayout()
+        int quads_generation = -1;          // Atlas generation 'quads' were shaped for
+    };
+
+    NVGcontext* vg;
+    std::unordered_map<size_t, Layout> layouts;
+
+    [[nodiscard]] Layout* find(std::string_view txt);
+
+public:
+
+    // Cleared when exceeded (e.g. text that changes every frame, like counters)
+    static constexpr size_t max_layouts = 4096;
+
+    explicit TextLayoutCache(NVGcontext* ctx) : vg(ctx) {}
+
+    // The cache for 'vg', created on first use
+    [[nodiscard]] static TextLayoutCache& of(NVGcontext* vg);
+
+    // As nvgTextBounds(vg, 0, 0, ...), returns the advance
+    float bounds(std::string_view txt, float out[4]);
+
+    // As nvgText()
+    void fillText(float x, float y, std::string_view txt);
+
+    void clear() { layouts.clear(); }
+    [[nodiscard]] size_t size() const { return layouts.size(); }
+};
+
+BL_END_NS
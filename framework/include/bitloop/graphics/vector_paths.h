@@ -0,0 +1,194 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+
+#include "debug.h"
+
+BL_BEGIN_NS
+
+// ======== Vector paths (.blvg) ========
+//
+// Packed stream of path commands & solid paints, converted from SVG at build time by the
+// svg2blvg tool (see bitloop_add_svg() in bitloopSimulation.cmake), so projects load vector
+// art as data rather than compiling it in as generated draw calls.
+//
+// Draw with Painter::drawVectorPaths(), which retains it as a single transform-batched draw.
+//
+// File layout (little-endian, each section 4-byte aligned):
+//
+//   Header
+//   Shape    shapes[shape_count]
+//   uint8_t  commands[command_count]     (padded to 4 bytes)
+//   float    coords[coord_count]         (x, y pairs consumed in command order)
+
+class VectorPaths
+{
+public:
+
+    static constexpr uint32_t file_version = 1;
+
+    enum struct Command : uint8_t
+    {
+        MOVE_TO,    // x, y
+        LINE_TO,    // x, y
+        BEZIER_TO,  // x1, y1, x2, y2, x, y
+        CLOSE
+    };
+
+    enum ShapeFlags : uint8_t
+    {
+        SHAPE_FILL   = 1 << 0,
+        SHAPE_STROKE = 1 << 1
+    };
+
+    struct Header
+    {
+        char magic[4] = { 'B', 'L', 'V', 'G' };
+        uint32_t version = file_version;
+        uint32_t shape_count = 0;
+        uint32_t command_count = 0;
+        uint32_t coord_count = 0;
+        float bounds[4] = { 0, 0, 0, 0 }; // min x, min y, max x, max y
+    };
+
+    struct Shape
+    {
+        uint32_t fill = 0;              // RGBA8 (r in the low byte)
+        uint32_t stroke = 0;            // RGBA8
+        float stroke_width = 1.0f;
+        uint32_t command_count = 0;     // commands (and their coords) belonging to this shape
+        uint8_t flags = 0;              // ShapeFlags
+        uint8_t line_cap = 0;           // NVGlineCap
+        uint8_t line_join = 0;          // NVGlineCap
+        uint8_t reserved = 0;
+    };
+
+    static_assert(std::endian::native == std::endian::little, ".blvg is stored little-endian");
+    static_assert(sizeof(Header) == 36 && sizeof(Shape) == 20);
+
+    std::vector<Shape> shapes;
+    std::vector<Command> commands;
+    std::vector<float> coords;
+    float bounds[4] = { 0, 0, 0, 0 };
+
+    [[nodiscard]] bool empty() const { return shapes.empty(); }
+
+    // Identifies the paths in a Painter's retained path cache (the file loaded from)
+    [[nodiscard]] const std::string& cacheKey() const { return cache_key; }
+
+    // ======== Serialization ========
+
+    [[nodiscard]] bool read(const uint8_t* data, size_t size)
+    {
+        Header header;
+        if (size < sizeof(Header))
+            return false;
+
+        std::memcpy(&header, data, sizeof(Header));
+        if (std::memcmp(header.magic, Header{}.magic, 4) != 0 || header.version != file_version)
+            return false;
+
+        size_t shapes_bytes = size_t(header.shape_count) * sizeof(Shape);
+        size_t commands_bytes = padded(header.command_count);
+        size_t coords_bytes = size_t(header.coord_count) * sizeof(float);
+        if (size < sizeof(Header) + shapes_bytes + commands_bytes + coords_bytes)
+            return false;
+
+        const uint8_t* p = data + sizeof(Header);
+        shapes.resize(header.shape_count);
+        commands.resize(header.command_count);
+        coords.resize(header.coord_count);
+
+        std::memcpy(shapes.data(), p, shapes_bytes);                      p += shapes_bytes;
+        std::memcpy(commands.data(), p, header.command_count);            p += commands_bytes;
+        std::memcpy(coords.data(), p, coords_bytes);
+        std::memcpy(bounds, header.bounds, sizeof(bounds));
+
+        return validate();
+    }
+
+    void write(std::vector<uint8_t>& out) const
+    {
+        Header header;
+        header.shape_count = (uint32_t)shapes.size();
+        header.command_count = (uint32_t)commands.size();
+        header.coord_count = (uint32_t)coords.size();
+        std::memcpy(header.bounds, bounds, sizeof(bounds));
+
+        out.clear();
+        out.resize(sizeof(Header) + shapes.size() * sizeof(Shape) + padded(commands.size()) + coords.size() * sizeof(float));
+
+        uint8_t* p = out.data();
+        std::memcpy(p, &header, sizeof(Header));                          p += sizeof(Header);
+        std::memcpy(p, shapes.data(), shapes.size() * sizeof(Shape));     p += shapes.size() * sizeof(Shape);
+        std::memcpy(p, commands.data(), commands.size());                 p += padded(commands.size());
+        std::memcpy(p, coords.data(), coords.size() * sizeof(float));
+    }
+
+    [[nodiscard]] bool load(const std::string& filepath)
+    {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (!read(data.data(), data.size()))
+            return false;
+
+        cache_key = filepath;
+        return true;
+    }
+
+    [[nodiscard]] bool save(const std::string& filepath) const
+    {
+        std::vector<uint8_t> data;
+        write(data);
+
+        std::ofstream file(filepath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+        return (bool)file;
+    }
+
+    [[nodiscard]] static int coordCount(Command cmd)
+    {
+        switch (cmd)
+        {
+        case Command::MOVE_TO:   return 2;
+        case Command::LINE_TO:   return 2;
+        case Command::BEZIER_TO: return 6;
+        default:                 return 0;
+        }
+    }
+
+private:
+
+    std::string cache_key = "vector_paths";
+
+    [[nodiscard]] static size_t padded(size_t bytes) { return (bytes + 3) & ~size_t(3); }
+
+    // Shapes must consume exactly the commands, and commands exactly the coords
+    [[nodiscard]] bool validate() const
+    {
+        size_t cmd_total = 0, coord_total = 0;
+        for (const Shape& shape : shapes)
+            cmd_total += shape.command_count;
+
+        if (cmd_total != commands.size())
+            return false;
+
+        for (Command cmd : commands)
+        {
+            if ((uint8_t)cmd > (uint8_t)Command::CLOSE)
+                return false;
+            coord_total += coordCount(cmd);
+        }
+        return coord_total == coords.size();
+    }
+};
+
+BL_END_NS
@@ -58,6 +58,8 @@
 #include <sstream>
 #include <utility>
 #include <cstdint>
+#include <string_view>
+#include <functional>
 
 struct ImGradientMark
 {
@@ -103,6 +105,9 @@ public:
     bool operator==(const ImGradient& rhs) const;
     bool operator!=(const ImGradient& rhs) const { return !(*this == rhs); }
 
+    // Hash of marks/editor state only (not the colour cache), for cheap change detection
+    size_t hash() const;
+
     /* Transformations ------------------------------------------------------- */
 
     static void lerp(ImGradient& out, const ImGradient& a, const ImGradient& b, float x)
@@ -182,6 +187,8 @@ private:
     uint32_t m_cachedColors[CACHE_SIZE]{};
 };
 
+inline size_t syncHash(const ImGradient& gradient) { return gradient.hash(); }
+
 /* ---------------------------- editor helpers ------------------------------ */
 namespace ImGui
 {
@@ -1506,6 +1506,9 @@ namespace ImSpline
 		friend bool SplineEditor(const char* label, Spline* spline, ImRect* grid_r, float max_editor_size);
 	};
 
+	// Hash is kept up to date by onChanged(), so synced splines needn't be compared point by point
+	inline size_t syncHash(const Spline& spline) { return spline.hash(); }
+
 
 	//inline ImColor adjustBrightness(ImColor c, float mult)
 	//{
@@ -1,95 +1,160 @@
-#include <functional>
-#include <unordered_map>
-#include <typeindex>
-#include <any>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "value_hash.h"
 
 ///--------------------------///
 /// Variable Changed Tracker ///
 ///--------------------------///
 
+// Tracks variables by (address, type), storing a 64-bit fingerprint per variable rather
+// than a copy. Small trivially-copyable values are fingerprinted by their exact bits,
+// larger ones by a hash (syncHash() if the type provides one, e.g. ImGradient).
+//
+// Only track variables with a stable address (e.g. scene members), never locals or
+// temporaries. Scenes may be processed on any worker thread, so a local's address
+// differs from frame to frame.
+//
+// Slots live in a flat open-addressed table which only grows when a new variable is
+// first tracked, so steady-state frames do no heap allocation.
+
 class ChangeTracker
 {
-    template <typename T>
-    struct StateMapPair {
-        std::unordered_map<T*, T> current;
-        std::unordered_map<T*, T> previous;
+    struct Slot
+    {
+        const void* addr = nullptr;
+        const void* type = nullptr;
+        uint64_t current = 0;
+        uint64_t previous = 0;
+        bool has_current = false;
+        bool has_previous = false;
     };
 
-    struct ClearCommit {
-        std::function<void()> clear;
-        std::function<void()> commit;
-    };
+    template<typename T>
+    static constexpr char type_tag = 0;
 
-    // one entry per type *in this tracker object*
-    mutable std::unordered_map<std::type_index, std::any>       store_;
-    mutable std::unordered_map<std::type_index, ClearCommit>    registry_;
+    mutable std::vector<Slot> slots;
+    mutable size_t used = 0;
+    mutable int shift = 64;
 
-    template <typename T>
-    StateMapPair<T>& getStateMap() const
+    template<typename T>
+    [[nodiscard]] static uint64_t fingerprint(const T& var)
     {
-        const auto idx = std::type_index(typeid(T));
-
-        auto it = store_.find(idx);
-        if (it == store_.end()) {
-            // first time we see this T -> create holder and hook up clear/commit
-            auto& holder = store_[idx];
-            holder.emplace<StateMapPair<T>>();
-            auto& maps = std::any_cast<StateMapPair<T>&>(holder);
-
-            registry_[idx] = {
-                [&maps]() { maps.current.clear(); maps.previous.clear(); },
-                [&maps]() { maps.previous = maps.current; }
-            };
-            return maps;
+        if constexpr (SyncHashable<T>)
+            return syncHash(var);
+        else if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(uint64_t))
+        {
+            uint64_t bits = 0;
+            std::memcpy(&bits, std::addressof(var), sizeof(T));
+            return bits;
         }
-        return std::any_cast<StateMapPair<T>&>(it->second);
+        else if constexpr (std::is_trivially_copyable_v<T>)
+            return syncHashBytes(std::addressof(var), sizeof(T));
+        else
+            return std::hash<T>()(var);
+    }
+
+    [[nodiscard]] size_t home(const void* addr, const void* type) const
+    {
+        uint64_t k = reinterpret_cast<uintptr_t>(addr) ^ (reinterpret_cast<uintptr_t>(type) << 1);
+        return static_cast<size_t>((k * 0x9e3779b97f4a7c15ull) >> shift);
+    }
+
+    void grow() const
+    {
+        std::vector<Slot> old = std::move(slots);
+        slots.assign(old.empty() ? 32 : old.size() * 2, Slot{});
+        shift = 64 - std::countr_zero(slots.size());
+        used = 0;
+
+        for (const Slot& s : old)
+        {
+            if (s.addr)
+            {
+                slotFor(s.addr, s.type) = s;
+                used++;
+            }
+        }
+    }
+
+    Slot& slotFor(const void* addr, const void* type) const
+    {
+        size_t mask = slots.size() - 1;
+        size_t i = home(addr, type);
+        while (slots[i].addr && (slots[i].addr != addr || slots[i].type != type))
+            i = (i + 1) & mask;
+        return slots[i];
     }
 
     template <typename T>
-    [[nodiscard]] bool variableChanged(T& var) const
+    [[nodiscard]] Slot& track(const T& var) const
     {
-        using NonConstT = std::remove_const_t<T>;
-        auto& maps = getStateMap<NonConstT>();
+        const void* type = &type_tag<std::remove_cv_t<T>>;
 
-        auto key = const_cast<NonConstT*>(std::addressof(var));
-        auto it = maps.previous.find(key);
+        if ((used + 1) * 2 > slots.size())
+            grow();
 
-        if (it != maps.previous.end()) {
-            bool changed = (var != it->second);
-            maps.current[key] = var;
-            return changed;
-        }
-        else {
-            maps.current[key] = var; // todo: Should never *begin* tracking here? Inconsistent results depending on when it's called
-            return false;
+        Slot& slot = slotFor(std::addressof(var), type);
+        if (!slot.addr)
+        {
+            slot.addr = std::addressof(var);
+            slot.type = type;
+            used++;
         }
+        return slot;
+    }
+
+    template <typename T>
+    [[nodiscard]] bool variableChanged(const T& var) const
+    {
+        Slot& slot = track(var);
+        uint64_t fp = fingerprint(var);
+
+        // todo: Should never *begin* tracking here? Inconsistent results depending on when it's called
+        bool changed = slot.has_previous && (fp != slot.previous);
+        slot.current = fp;
+        slot.has_current = true;
+        return changed;
     }
 
 public:
 
     ChangeTracker() = default;
 
+    // Every argument is recorded (no short-circuit), so each is compared against its
+    // value from the previous frame, regardless of which others changed
     template <typename... Args>
-    [[nodiscard]] bool Changed(Args&&... args) const
+    [[nodiscard]] bool Changed(const Args&... args) const
     {
-        return (variableChanged(std::forward<Args>(args)) || ...);
+        return (false | ... | variableChanged(args));
     }
 
     template <typename T>
     void commitCurrent(T& var)
     {
-        getStateMap<T>().current[&var] = var;
+        Slot& slot = track(var);
+        slot.current = fingerprint(var);
+        slot.has_current = true;
     }
 
     void clearCurrent()
     {
-        for (auto& [_, cc] : registry_)
-            cc.clear();
+        for (Slot& slot : slots)
+            slot.has_current = slot.has_previous = false;
     }
 
     void updateCurrent()
     {
-        for (auto& [_, cc] : registry_)
-            cc.commit();
+        for (Slot& slot : slots)
+        {
+            if (slot.has_current)
+            {
+                slot.previous = slot.current;
+                slot.has_previous = true;
+            }
+        }
     }
 };
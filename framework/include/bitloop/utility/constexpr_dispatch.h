@@ -43,23 +43,52 @@ struct idx_to_tuple<Idx, Last>
     using type = std::tuple<std::integral_constant<Last, static_cast<Last>(digit)>>;
 };
 
-template<typename Fun, typename... Ts>
+template<typename Fun, typename Filter, typename... Ts>
 struct enum_table_leading
 {
     template<DispatchArg... Es>
     struct impl
     {
-        using Ret = decltype(
-            std::declval<Fun>().template operator() < Ts... > (
-            std::integral_constant<Es, static_cast<Es>(0)>()...));
+        static constexpr std::size_t total = (domain_size_v<Es> * ...);
+
+        // Filter::allow<Ts..., Vs...> decides which combinations get an entry (void = all)
+        template<std::size_t I>
+        static consteval bool allowed()
+        {
+            if constexpr (std::is_void_v<Filter>)
+                return true;
+            else
+                return []<typename... Cs>(std::tuple<Cs...>*) {
+                    return Filter::template allow<Ts..., Cs::value...>;
+                }((typename idx_to_tuple<I, Es...>::type*)nullptr);
+        }
+
+        template<std::size_t... Is>
+        static consteval std::size_t find_first_allowed(std::index_sequence<Is...>)
+        {
+            std::size_t first = total;
+            ((first == total && allowed<Is>() ? (first = Is) : 0), ...);
+            return first;
+        }
+
+        static constexpr std::size_t first_allowed = find_first_allowed(std::make_index_sequence<total>{});
+        static_assert(first_allowed < total, "Dispatch filter rejects every combination");
+
+        // Deduce return type from an allowed entry, so rejected combinations are never instantiated
+        template<typename... Cs>
+        static auto ret_of(std::tuple<Cs...>*) -> decltype(
+            std::declval<Fun>().template operator() < Ts... > (Cs{}...));
+
+        using Ret = decltype(ret_of((typename idx_to_tuple<first_allowed, Es...>::type*)nullptr));
 
         using FnPtr = Ret(*)(Fun&);
-        static constexpr std::size_t total = (domain_size_v<Es> * ...);
 
         template<std::size_t I>
         static consteval FnPtr make_entry()
         {
-            return +[](Fun& f) -> Ret {
+            if constexpr (!allowed<I>())
+                return nullptr;
+            else return +[](Fun& f) -> Ret {
                 using Tup = typename idx_to_tuple<I, Es...>::type;
                 if constexpr (std::is_void_v<Ret>)
                     std::apply([&](auto... Cs) { f.template operator() < Ts... > (Cs...); }, Tup{});
@@ -74,24 +103,63 @@ struct enum_table_leading
         }
 
         static constexpr auto table = build(std::make_index_sequence<total>{});
+
+        static std::size_t index(Es... vs)
+        {
+            std::size_t idx = 0;
+            ((idx = idx * domain_size_v<Es> +static_cast<std::size_t>(vs)), ...);
+            return idx;
+        }
     };
 };
 
+// Dense dispatch, instantiates every combination of Es...
 template<typename... Ts, typename F, DispatchArg... Es>
 decltype(auto) table_invoke(F&& f, Es... vs)
 {
     using Fun = std::decay_t<F>;
-    using Tab = typename enum_table_leading<Fun, Ts...>::template impl<Es...>;
+    using Tab = typename enum_table_leading<Fun, void, Ts...>::template impl<Es...>;
+
+    if constexpr (std::is_void_v<typename Tab::Ret>)
+        Tab::table[Tab::index(vs...)](f);
+    else
+        return Tab::table[Tab::index(vs...)](f);
+}
+
+// Sparse dispatch, only instantiates combinations allowed by Filter. Anything else calls
+// fallback(vs...) at runtime, which is free to redirect to a supported combination.
+//
+//   struct KernelFilter {
+//       template<typename T, Mode M> static constexpr bool allow = std::is_floating_point_v<T> || M == Mode::A;
+//   };
+//   table_invoke_sparse<KernelFilter, T>(build_table(kernel, [&]), fallback, mode);
+template<typename Filter, typename... Ts, typename F, typename Fallback, DispatchArg... Es>
+decltype(auto) table_invoke_sparse(F&& f, Fallback&& fallback, Es... vs)
+{
+    using Fun = std::decay_t<F>;
+    using Tab = typename enum_table_leading<Fun, Filter, Ts...>::template impl<Es...>;
 
-    std::size_t idx = 0;
-    ((idx = idx * domain_size_v<Es> +static_cast<std::size_t>(vs)), ...);
+    auto entry = Tab::table[Tab::index(vs...)];
 
     if constexpr (std::is_void_v<typename Tab::Ret>)
-        Tab::table[idx](f);
+    {
+        if (entry) entry(f);
+        else       fallback(vs...);
+    }
     else
-        return Tab::table[idx](f);
+    {
+        if (entry) return entry(f);
+        return static_cast<typename Tab::Ret>(fallback(vs...));
+    }
 }
 
+/// Explicit-instantiation mode
+///
+/// Entries call the target template like any other call, so declaring its specialisations
+/// 'extern template' where the table is built stops them being compiled there. Each
+/// specialisation can then be explicitly instantiated in its own translation unit, which
+/// lets the build compile the heavy kernels in parallel.
+
 #define build_table(func, capture, ...)                         \
     capture <typename... Ts>(auto... Cs) -> decltype(auto) {    \
         return [&]<typename... Us>(std::tuple<Us...>*) {        \
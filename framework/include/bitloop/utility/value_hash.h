@@ -0,0 +1,24 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+// ======== Value hashing ========
+// Used to detect changes in large values without keeping (and comparing) a full copy of them.
+// A type opts in by providing an overload (found by ADL) of:
+//
+//   size_t syncHash(const T&)
+
+template<typename T>
+concept SyncHashable = requires(const T& v) { { syncHash(v) } -> std::convertible_to<size_t>; };
+
+inline size_t syncHashBytes(const void* data, size_t size)
+{
+    return std::hash<std::string_view>()(std::string_view(static_cast<const char*>(data), size));
+}
+
+inline void syncHashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
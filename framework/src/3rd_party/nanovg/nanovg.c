@@ -131,6 +131,7 @@ struct NVGcontext {
 	struct FONScontext* fs;
 	int fontImages[NVG_MAX_FONTIMAGES];
 	int fontImageIdx;
+	int fontAtlasGeneration;
 	int drawCallCount;
 	int fillTriCount;
 	int strokeTriCount;
@@ -2294,6 +2295,36 @@ void nvgStroke(NVGcontext* ctx)
 	}
 }
 
+void nvgFillTriangles(NVGcontext* ctx, const NVGvertex* verts, int nverts, int image)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint paint = state->fill;
+	NVGvertex* out;
+	int i;
+
+	if (nverts < 3) return;
+
+	out = nvg__allocTempVerts(ctx, nverts);
+	if (out == NULL) return;
+
+	for (i = 0; i < nverts; i++) {
+		nvgTransformPoint(&out[i].x, &out[i].y, state->xform, verts[i].x, verts[i].y);
+		out[i].u = verts[i].u;
+		out[i].v = verts[i].v;
+	}
+
+	paint.image = image;
+
+	// Apply global alpha
+	paint.innerColor.a *= state->alpha;
+	paint.outerColor.a *= state->alpha;
+
+	ctx->params.renderTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, out, nverts, ctx->fringeWidth);
+
+	ctx->drawCallCount++;
+	ctx->fillTriCount += nverts/3;
+}
+
 // Add fonts
 int nvgCreateFont(NVGcontext* ctx, const char* name, const char* filename)
 {
@@ -2436,6 +2467,7 @@ static int nvg__allocTextAtlas(NVGcontext* ctx)
 	}
 	++ctx->fontImageIdx;
 	fonsResetAtlas(ctx->fs, iw, ih);
+	ctx->fontAtlasGeneration++;
 	return 1;
 }
 
@@ -2537,6 +2569,102 @@ float nvgText(NVGcontext* ctx, float x, float y, const char* string, const char*
 	return iter.nextx / scale;
 }
 
+void nvgTextLayoutState(NVGcontext* ctx, NVGtextLayoutState* out)
+{
+	NVGstate* state = nvg__getState(ctx);
+	out->fontId = state->fontId;
+	out->align = state->textAlign;
+	out->flipped = nvg__isTransformFlipped(state->xform);
+	out->atlasGeneration = ctx->fontAtlasGeneration;
+	out->size = state->fontSize;
+	out->spacing = state->letterSpacing;
+	out->blur = state->fontBlur;
+	out->scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+}
+
+int nvgTextLayout(NVGcontext* ctx, const char* string, const char* end, NVGvertex* verts, int maxVerts)
+{
+	NVGstate* state = nvg__getState(ctx);
+	FONStextIter iter, prevIter;
+	FONSquad q;
+	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	int nverts = 0;
+	int retried = 0;
+	int isFlipped = nvg__isTransformFlipped(state->xform);
+
+	if (end == NULL)
+		end = string + strlen(string);
+
+	if (state->fontId == FONS_INVALID) return 0;
+
+	fonsSetSize(ctx->fs, state->fontSize*scale);
+	fonsSetSpacing(ctx->fs, state->letterSpacing*scale);
+	fonsSetBlur(ctx->fs, state->fontBlur*scale);
+	fonsSetAlign(ctx->fs, state->textAlign);
+	fonsSetFont(ctx->fs, state->fontId);
+
+	fonsTextIterInit(ctx->fs, &iter, 0, 0, string, end, FONS_GLYPH_BITMAP_REQUIRED);
+	prevIter = iter;
+	while (fonsTextIterNext(ctx->fs, &iter, &q)) {
+		if (iter.prevGlyphIndex == -1) { // can not retrieve glyph?
+			// A new atlas invalidates the quads so far, shape the whole run again
+			if (retried || !nvg__allocTextAtlas(ctx))
+				break;
+			retried = 1;
+			nverts = 0;
+			fonsTextIterInit(ctx->fs, &iter, 0, 0, string, end, FONS_GLYPH_BITMAP_REQUIRED);
+			prevIter = iter;
+			continue;
+		}
+		prevIter = iter;
+		if(isFlipped) {
+			float tmp;
+
+			tmp = q.y0; q.y0 = q.y1; q.y1 = tmp;
+			tmp = q.t0; q.t0 = q.t1; q.t1 = tmp;
+		}
+		if (nverts+6 <= maxVerts) {
+			nvg__vset(&verts[nverts], q.x0, q.y0, q.s0, q.t0); nverts++;
+			nvg__vset(&verts[nverts], q.x1, q.y1, q.s1, q.t1); nverts++;
+			nvg__vset(&verts[nverts], q.x1, q.y0, q.s1, q.t0); nverts++;
+			nvg__vset(&verts[nverts], q.x0, q.y0, q.s0, q.t0); nverts++;
+			nvg__vset(&verts[nverts], q.x0, q.y1, q.s0, q.t1); nverts++;
+			nvg__vset(&verts[nverts], q.x1, q.y1, q.s1, q.t1); nverts++;
+		}
+	}
+
+	nvg__flushTextTexture(ctx);
+	return nverts;
+}
+
+void nvgTextLayoutDraw(NVGcontext* ctx, float x, float y, const NVGvertex* verts, int nverts)
+{
+	NVGstate* state = nvg__getState(ctx);
+	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float invscale = 1.0f / scale;
+	float ox, oy;
+	NVGvertex* out;
+	int i;
+
+	if (nverts <= 0) return;
+
+	out = nvg__allocTempVerts(ctx, nverts);
+	if (out == NULL) return;
+
+	// Quads are on whole device pixels, keep them there
+	ox = floorf(x*scale + 0.5f);
+	oy = floorf(y*scale + 0.5f);
+
+	for (i = 0; i < nverts; i++) {
+		nvgTransformPoint(&out[i].x, &out[i].y, state->xform, (verts[i].x + ox)*invscale, (verts[i].y + oy)*invscale);
+		out[i].u = verts[i].u;
+		out[i].v = verts[i].v;
+	}
+
+	nvg__flushTextTexture(ctx);
+	nvg__renderText(ctx, out, nverts);
+}
+
 void nvgTextBox(NVGcontext* ctx, float x, float y, float breakRowWidth, const char* string, const char* end)
 {
 	NVGstate* state = nvg__getState(ctx);
@@ -80,6 +80,7 @@
 #include "project_worker.h"
 #include "main_window.h"
 #include "shared_sync.h"
+#include "headless.h"
 
 using namespace BL;
 
@@ -88,6 +89,13 @@ SharedSync shared_sync;
 //std::unordered_map<size_t, size_t> thread_map;
 
 
+// Lets the frame budget know the display's refresh interval (when the platform reports it)
+static void updateRefreshRate()
+{
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window));
+    shared_sync.budget.setRefreshRate(mode ? (double)mode->refresh_rate : 0.0);
+}
+
 void gui_loop()
 {
     // ======== Poll SDL events ========
@@ -103,10 +111,16 @@ void gui_loop()
             case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
                 Platform()->resized();
                 break;
+            case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
+                updateRefreshRate();
+                break;
             default: ProjectWorker::instance()->queueEvent(e); break;
         }
     }
 
+    // Publish coalesced motion for this frame
+    ProjectWorker::instance()->flushEvents();
+
     Platform()->update();
 
     // ======== Prepare frame ========
@@ -125,10 +139,25 @@ void gui_loop()
     glClear(GL_COLOR_BUFFER_BIT);
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     SDL_GL_SwapWindow(window);
+
+    // ======== Measure frame pacing (swap-to-swap interval & canvas draw cost) ========
+    static auto last_swap = std::chrono::steady_clock::now();
+    auto now = std::chrono::steady_clock::now();
+    shared_sync.budget.reportGuiFrame(
+        std::chrono::duration<double, std::milli>(now - last_swap).count(),
+        MainWindow::instance()->lastCanvasDrawMs());
+    last_swap = now;
 }
 
-int bitloop_main(int, char* [])
+int bitloop_main(int argc, char* argv[])
 {
+    // ======== Headless (software canvas, no window) ========
+    {
+        HeadlessRunner::Options headless;
+        if (HeadlessRunner::parseArgs(argc, argv, headless))
+            return HeadlessRunner::run(headless);
+    }
+
     // ======== SDL Window setup ========
     {
         SDL_Init(SDL_INIT_VIDEO);
@@ -178,6 +207,7 @@ int bitloop_main(int, char* [])
         gl_context = SDL_GL_CreateContext(window);
         SDL_GL_MakeCurrent(window, gl_context);
         SDL_GL_SetSwapInterval(1); // enforces 60fps / v-sync
+        updateRefreshRate();
 
         #ifndef __EMSCRIPTEN__
         if (!gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress)) {
@@ -223,6 +253,7 @@ int bitloop_main(int, char* [])
 
             // Gracefully exit
             ProjectWorker::instance()->end();
+            MainWindow::instance()->getCanvas()->destroy();
 
             ImGui_ImplOpenGL3_Shutdown();
             ImGui_ImplSDL3_Shutdown();
@@ -0,0 +1,174 @@
+#include "headless.h"
+#include "platform.h"
+#include "project.h"
+#include "project_worker.h"
+#include "nano_canvas.h"
+#include "display_list.h"
+#include "imgui_log.h"
+#include "imgui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+BL_BEGIN_NS
+
+bool HeadlessRunner::parseArgs(int argc, char* argv[], Options& options)
+{
+    bool headless = false;
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+        if (!strcmp(arg, "--headless"))
+            headless = true;
+        else if (!strcmp(arg, "--project") && value)
+            options.project = argv[++i];
+        else if (!strcmp(arg, "--size") && value)
+        {
+            if (sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2)
+                BL::print() << "headless: expected --size WxH, got " << value << "\n";
+        }
+        else if (!strcmp(arg, "--frames") && value)
+            options.frames = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(arg, "--out") && value)
+            options.output = argv[++i];
+    }
+    return headless;
+}
+
+// Binary PPM (no image library needed), straight-alpha RGBA composited over black
+static bool writePPM(const std::string& path, const std::vector<uint8_t>& rgba, int w, int h)
+{
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    fprintf(file, "P6\n%d %d\n255\n", w, h);
+
+    std::vector<uint8_t> row(size_t(w) * 3);
+    for (int y = 0; y < h; y++)
+    {
+        const uint8_t* src = rgba.data() + size_t(y) * w * 4;
+        for (int x = 0; x < w; x++)
+        {
+            for (int c = 0; c < 3; c++)
+                row[x * 3 + c] = (uint8_t)((src[x * 4 + c] * src[x * 4 + 3] + 127) / 255);
+        }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+
+    return fclose(file) == 0;
+}
+
+int HeadlessRunner::renderProject(const ProjectInfo& info, const Options& options)
+{
+    Canvas canvas;
+    canvas.create(1.0, CanvasBackend::SOFTWARE);
+    canvas.resize(options.width, options.height);
+
+    std::unique_ptr<ProjectBase> project(info.creator());
+    project->configure(info.sim_uid, &canvas, &project_log);
+    project->_projectPrepare();
+    project->_projectStart();
+
+    // Same path as the worker & GUI threads: process, record the frame, replay it on the canvas
+    DisplayList display_list;
+    for (int frame = 0; frame < options.frames; frame++)
+    {
+        project->frame_deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::milli>(options.frame_budget_ms));
+
+        project->_projectProcess();
+
+        display_list.clear();
+        project->_projectRecord(display_list);
+
+        canvas.begin(0.05f, 0.05f, 0.1f, 1.0f);
+        display_list.replay(canvas.getRenderTarget());
+        canvas.end();
+    }
+
+    std::vector<uint8_t> pixels;
+    canvas.readPixels(pixels);
+    const int w = canvas.frameWidth();
+    const int h = canvas.frameHeight();
+
+    project->_projectDestroy();
+    project.reset();
+    canvas.destroy();
+
+    // A frame of a single color means nothing was drawn (or the rasterizer failed)
+    std::unordered_set<uint32_t> colors;
+    for (size_t i = 0; i + 3 < pixels.size() && colors.size() < 2; i += 4)
+    {
+        uint32_t c;
+        std::memcpy(&c, &pixels[i], 4);
+        colors.insert(c);
+    }
+
+    const std::string& name = info.path.back();
+    if (pixels.size() != size_t(w) * h * 4 || colors.size() < 2)
+    {
+        BL::print() << "headless: " << name << " drew a blank " << w << "x" << h << " frame\n";
+        return 2;
+    }
+
+    if (!options.output.empty() && !writePPM(options.output, pixels, w, h))
+    {
+        BL::print() << "headless: failed to write " << options.output << "\n";
+        return 1;
+    }
+
+    BL::print() << "headless: " << name << " rendered " << options.frames << " frames at " << w << "x" << h << "\n";
+    return 0;
+}
+
+int HeadlessRunner::run(const Options& options)
+{
+    if (options.width <= 0 || options.height <= 0)
+    {
+        BL::print() << "headless: invalid size " << options.width << "x" << options.height << "\n";
+        return 1;
+    }
+
+    std::vector<std::shared_ptr<ProjectInfo>> selected;
+    if (options.project.empty())
+        selected = ProjectBase::projectInfoList();
+    else if (auto info = ProjectBase::findProjectInfo(options.project.c_str()))
+        selected.push_back(info);
+
+    std::erase_if(selected, [](auto& info) { return !info->creator; });
+    if (selected.empty())
+    {
+        BL::print() << "headless: no project named \"" << options.project << "\"\n";
+        return 1;
+    }
+
+    if (selected.size() > 1 && !options.output.empty())
+    {
+        BL::print() << "headless: --out needs --project\n";
+        return 1;
+    }
+
+    // No window, only used to resolve data paths (fonts, assets)
+    PlatformManager platform(nullptr);
+
+    // Nothing is rendered with ImGui, but project code may still read its state
+    ImGui::CreateContext();
+
+    int result = 0;
+    for (auto& info : selected)
+        result = std::max(result, renderProject(*info, options));
+
+    ImGui::DestroyContext();
+    return result;
+}
+
+BL_END_NS
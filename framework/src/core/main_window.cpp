@@ -142,10 +142,7 @@ void MainWindow::populateProjectUI()
 {
     ImGui::BeginPaddedRegion(ScaleSize(10.0f));
   
-    // Stall until we've finishing copying the shadow buffer to the live buffer (on worker thread)
-    shared_sync.wait_until_live_buffer_updated();
-
-    // Shadow buffer is now up-to-date free to access (while worker does processing)
+    // Shadow buffer is owned by the GUI thread, worker changes are pulled in lock-free
     {
         std::unique_lock<std::mutex> shadow_lock(shared_sync.shadow_buffer_mutex);
         ProjectWorker::instance()->populateAttributes();
@@ -510,6 +507,18 @@ void MainWindow::populateViewport()
         static bool done_first_size = false;
         bool resized = canvas.resize(width, height);
 
+        // Pick this frame's render resolution (full unless interacting/over budget)
+        double resolution_scale = shared_sync.resolution.update(
+            need_draw,
+            shared_sync.budget.drawMs(),
+            shared_sync.budget.frameIntervalMs());
+
+        // Unlike a resize, the storage still holds the last frame, which keeps being presented
+        // (stretched over the viewport) until a frame is drawn at the new scale
+        bool rescaled = canvas.setResolutionScale(resolution_scale);
+
+        if (resized || rescaled)
+            ProjectWorker::instance()->invalidateDrawnFrame();
 
         if (!done_first_size)
         {
@@ -517,36 +526,37 @@ void MainWindow::populateViewport()
         }
         else if (shared_sync.project_thread_started)
         {
-            // Launch initial simulation 1 frame late (background thread)
-            if (!ProjectWorker::instance()->getActiveProject())
+            // Launch initial simulation 1 frame late (built in the background, so only request it once)
+            static bool requested_first_project = false;
+            if (!requested_first_project && !ProjectWorker::instance()->getActiveProject())
             {
+                requested_first_project = true;
                 auto first_project = ProjectBase::projectInfoList().front();
                 ProjectWorker::instance()->setActiveProject(first_project->sim_uid);
                 ProjectWorker::instance()->startProject();
-
-                // Kick-start work-render-work-render loop
-                need_draw = true;
             }
         }
 
         if (need_draw)
         {
-            // Stop the worker and draw the fresh frame
-            {
-                std::unique_lock<std::mutex> lock(shared_sync.state_mutex);
+            // Draw the oldest queued frame. When lockstep, the worker is blocked until
+            // it's drawn. When pipelined, it's already recording the next frame
+            auto draw_t0 = std::chrono::steady_clock::now();
 
+            // Replay the frame's display list, unless the canvas already shows an identical frame
+            if (!ProjectWorker::instance()->frameUnchanged())
+            {
                 canvas.begin(0.05f, 0.05f, 0.1f, 1.0f);
 
                 //BL::print() << "projectDraw()";
                 ProjectWorker::instance()->draw();
                 canvas.end();
-
-                shared_sync.frame_ready = false;
-                shared_sync.frame_consumed = true;
             }
 
-            // Let worker continue
-            shared_sync.cv.notify_one();
+            canvas_draw_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - draw_t0).count();
+
+            // Free the slot (wakes worker if it was waiting on back-pressure)
+            shared_sync.flag_frame_drawn();
         }
         else if (resized)
         {
@@ -556,12 +566,12 @@ void MainWindow::populateViewport()
             canvas.end();
         }
 
-        // Draw cached (or freshly generated) frame
+        // Draw cached (or freshly generated) frame, upscaling the rendered area to fill the viewport
         ImGui::Image(canvas.texture(), ImVec2(
             static_cast<float>(canvas.fboWidth()),
             static_cast<float>(canvas.fboHeight())),
-            ImVec2(0.0f, 1.0f),   // UV top-left (flipped)
-            ImVec2(1.0f, 0.0f)    // UV bottom-right);
+            ImVec2(0.0f, canvas.renderV()),   // UV top-left (flipped)
+            ImVec2(canvas.renderU(), 0.0f)    // UV bottom-right);
         );
     }
     ImGui::End();
@@ -576,10 +586,8 @@ void MainWindow::populateUI()
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
 
     // Determine if we are ready to draw *before* populating simulation imgui attributes
-    {
-        std::lock_guard<std::mutex> g(shared_sync.state_mutex);
-        need_draw = shared_sync.frame_ready;
-    }
+    need_draw = shared_sync.frame_ready();
+    canvas_draw_ms = -1.0;
 
     bool collapse_layout = vertical_layout || Platform()->max_char_rows() < 40.0f;
     if (collapse_layout)
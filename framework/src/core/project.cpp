@@ -56,6 +56,22 @@ void SceneBase::mountToAll(Layout& viewports)
         viewport->mountScene(this);
 }
 
+std::chrono::steady_clock::time_point SceneBase::frameDeadline() const
+{
+    return project->frameDeadline();
+}
+
+double SceneBase::resolutionScale() const
+{
+    return project->resolutionScale();
+}
+
+int SceneBase::frameBudgetRemainingMs() const
+{
+    auto remaining = frameDeadline() - std::chrono::steady_clock::now();
+    return std::max(1, (int)std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count());
+}
+
 void SceneBase::pollEvents()
 {
     ProjectWorker::instance()->pollEvents(false);
@@ -157,11 +173,16 @@ void Viewport::draw()
     setTextBaseline(TextBaseline::BASELINE_TOP);
     setFillStyle(255, 255, 255);
 
-    print_stream.seekg(0);
+    // Split in place (lines are usually the same each frame, so their layouts are cached)
+    std::string_view lines = print_stream.view();
     int line_index = 0;
-    std::string line;
-    while (std::getline(print_stream, line, '\n'))
+    while (!lines.empty())
+    {
+        size_t end = lines.find('\n');
+        std::string_view line = lines.substr(0, end);
         fillText(line, 5, 5 + (line_index++ * getGlobalScale() * 16.0f));
+        lines.remove_prefix(end == std::string_view::npos ? lines.size() : end + 1);
+    }
 
     camera.restoreCameraTransform();
     restore();
@@ -288,6 +309,8 @@ void ProjectBase::configure(int _sim_uid, Canvas* _canvas, ImDebugLog* shared_lo
     canvas = _canvas;
     project_log = shared_log;
 
+    frame_painter.setGlobalScale(canvas->getGlobalScale());
+
     viewports.project = this;
 
     started = false;
@@ -346,6 +369,7 @@ void ProjectBase::_projectPrepare()
     // Note: This is where old viewports get replaced
     scene_counter = 0;
     projectPrepare(newLayout());
+    layout_prepared = true;
 }
 
 void ProjectBase::_projectStart()
@@ -359,8 +383,10 @@ void ProjectBase::_projectStart()
 
     done_single_process = false;
 
-    // Prepare layout
-    _projectPrepare();
+    // Prepare layout (unless it was just prepared when the project was built)
+    if (!layout_prepared)
+        _projectPrepare();
+    layout_prepared = false;
 
     assert(viewports.count() >  0);
 
@@ -529,11 +555,11 @@ void ProjectBase::_projectProcess()
 
 
             // Allow project to handle process on each Viewport
-            for (Viewport* viewport : viewports)
+            auto processViewport = [this](Viewport* viewport)
             {
                 //viewport->camera.panZoomProcess();
                 viewport->scene->camera = &viewport->camera;
-                Camera::active = &viewport->camera;
+                Camera::ActiveScope camera_scope(&viewport->camera);
 
                 viewport->just_resized =
                     (viewport->w != viewport->old_w) ||
@@ -543,8 +569,32 @@ void ProjectBase::_projectProcess()
 
                 viewport->old_w = viewport->w;
                 viewport->old_h = viewport->h;
+            };
+
+            // Opted-in scenes fan out across the task pool (one task per scene, since a scene's
+            // viewports share its camera pointer & tracked state), the rest run here meanwhile
+            Thread::TaskGroup parallel_scenes;
+            for (SceneBase* scene : viewports.all_scenes)
+            {
+                if (!scene->parallel_viewport_process)
+                    continue;
+
+                Thread::submit(Thread::Priority::INTERACTIVE, [this, scene, &processViewport]()
+                {
+                    for (Viewport* viewport : viewports)
+                        if (viewport->scene == scene) processViewport(viewport);
+                }, &parallel_scenes);
+            }
+
+            for (Viewport* viewport : viewports)
+            {
+                if (!viewport->scene->parallel_viewport_process)
+                    processViewport(viewport);
             }
 
+            // Join before draw
+            parallel_scenes.wait();
+
             // Post-Process each scene
             for (SceneBase* scene : viewports.all_scenes)
                 scene->updateCurrent();
@@ -565,7 +615,25 @@ void ProjectBase::_projectProcess()
         done_single_process = true;
 }
 
-void ProjectBase::_projectDraw()
+void ProjectBase::_projectRecord(DisplayList& list)
+{
+    // Painter state is mirrored on the measuring context, which starts each frame fresh
+    // (like the canvas context does when the list is replayed)
+    NVGcontext* measure_vg = DisplayList::measureContext();
+    DVec2 surface_size = surfaceSize();
+    nvgBeginFrame(measure_vg, (float)surface_size.x, (float)surface_size.y, (float)canvas->getGlobalScale());
+
+    frame_painter.setRenderTarget(measure_vg, &list);
+    for (Viewport* viewport : viewports)
+        viewport->setRenderTarget(measure_vg, &list);
+
+    _projectDraw(&frame_painter);
+
+    nvgCancelFrame(measure_vg);
+    list.finish();
+}
+
+void ProjectBase::_projectDraw(SimplePainter* ctx)
 {
     if (!done_single_process) return;
     if (!started) return;
@@ -576,7 +644,6 @@ void ProjectBase::_projectDraw()
     ///    shaders_loaded = true;
     ///}
 
-    Canvas* ctx = canvas;
     DVec2 surface_size = surfaceSize();
 
     ctx->setFillStyle(10, 10, 15);
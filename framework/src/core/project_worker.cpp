@@ -21,6 +21,13 @@ void ProjectWorker::end()
 
         // Clean up
         _destroyActiveProject();
+
+        for (auto& build : project_builds)
+        {
+            build->task.wait();
+            delete build->project;
+        }
+        project_builds.clear();
     }
 }
 
@@ -42,13 +49,15 @@ void ProjectWorker::handleProjectCommands(ProjectCommandEvent& e)
     {
     case ProjectCommandType::PROJECT_SET:
     {
-        project_log.clear();
+        // Built in the background (see processProjectCommands), so this is just a swap
+        ProjectBase* project = takeBuild(e.project_uid);
 
+        project_log.clear();
         _destroyActiveProject();
+        active_project = project;
 
-        active_project = ProjectBase::findProjectInfo(e.project_uid)->creator();
-        active_project->configure(e.project_uid, MainWindow::instance()->getCanvas(), &project_log);
-        active_project->_projectPrepare();
+        if constexpr (PREWARM_NEIGHBOUR_PROJECTS)
+            prewarmNeighbours(e.project_uid);
     }
     break;
 
@@ -58,7 +67,7 @@ void ProjectWorker::handleProjectCommands(ProjectCommandEvent& e)
             active_project->_projectDestroy();
             active_project->_projectStart();
 
-            active_project->updateShadowBuffers();
+            active_project->pushLiveChanges();
         }
         break;
 
@@ -79,147 +88,321 @@ void ProjectWorker::handleProjectCommands(ProjectCommandEvent& e)
     }
 }
 
+/// ======== Background project builds ========
+
+ProjectWorker::ProjectBuild* ProjectWorker::requestBuild(int uid, Thread::Priority priority)
+{
+    for (auto& build : project_builds)
+    {
+        if (build->uid == uid)
+            return build.get();
+    }
+
+    auto info = ProjectBase::findProjectInfo(uid);
+    if (!info)
+        return nullptr;
+
+    auto build = std::make_unique<ProjectBuild>();
+    build->uid = uid;
+
+    // Construct & prepare off the worker thread (no GL work happens here), so the
+    // current project keeps running meanwhile
+    ProjectBuild* b = build.get();
+    Canvas* canvas = MainWindow::instance()->getCanvas();
+    Thread::submit(priority, [b, info, canvas]()
+    {
+        b->project = info->creator();
+        b->project->configure(b->uid, canvas, &project_log);
+        b->project->_projectPrepare();
+    }, &b->task);
+
+    project_builds.push_back(std::move(build));
+    return b;
+}
+
+ProjectBase* ProjectWorker::takeBuild(int uid)
+{
+    ProjectBuild* build = requestBuild(uid, Thread::Priority::INTERACTIVE);
+    if (!build)
+        return nullptr;
+
+    build->task.wait(); // Rethrows if construction failed
+    ProjectBase* project = build->project;
+
+    std::erase_if(project_builds, [build](auto& b) { return b.get() == build; });
+    return project;
+}
+
+void ProjectWorker::prewarmNeighbours(int uid)
+{
+    // Projects either side of this one in the project tree are the likeliest next picks
+    std::vector<int> leaves;
+    auto collect = [&](auto& self, ProjectInfoNode& node) -> void
+    {
+        if (node.project_info)
+            leaves.push_back(node.project_info->sim_uid);
+        for (auto& child : node.children)
+            self(self, child);
+    };
+    collect(collect, ProjectBase::projectTreeRootInfo());
+
+    auto it = std::find(leaves.begin(), leaves.end(), uid);
+    if (it == leaves.end())
+        return;
+
+    if (it != leaves.begin())
+        requestBuild(*(it - 1), Thread::Priority::BACKGROUND);
+    if (it + 1 != leaves.end())
+        requestBuild(*(it + 1), Thread::Priority::BACKGROUND);
+}
+
+void ProjectWorker::releaseBuilds()
+{
+    // Keep at most a couple of idle (pre-warmed) builds, dropping the oldest first
+    constexpr size_t max_idle_builds = 2;
+
+    size_t wanted = 0;
+    for (auto& e : pending_commands)
+        if (e.type == ProjectCommandType::PROJECT_SET) wanted++;
+
+    while (project_builds.size() > max_idle_builds + wanted)
+    {
+        auto it = std::find_if(project_builds.begin(), project_builds.end(), [&](auto& build)
+        {
+            return build->task.done() && std::none_of(pending_commands.begin(), pending_commands.end(),
+                [&](ProjectCommandEvent& e) { return e.type == ProjectCommandType::PROJECT_SET && e.project_uid.uid == build->uid; });
+        });
+
+        if (it == project_builds.end())
+            break; // Still building, release later
+
+        delete (*it)->project;
+        project_builds.erase(it);
+    }
+}
+
+void ProjectWorker::processProjectCommands()
+{
+    {
+        std::lock_guard<std::mutex> lock(project_command_mutex);
+        pending_commands.insert(pending_commands.end(), project_command_queue.begin(), project_command_queue.end());
+        project_command_queue.clear();
+    }
+
+    if (pending_commands.empty())
+        return;
+
+    // A newer project switch supersedes everything queued before it
+    auto last_set = std::find_if(pending_commands.rbegin(), pending_commands.rend(),
+        [](ProjectCommandEvent& e) { return e.type == ProjectCommandType::PROJECT_SET; });
+
+    if (last_set != pending_commands.rend())
+        pending_commands.erase(pending_commands.begin(), std::prev(last_set.base()));
+
+    // Commands can run up until a switch to a project which is still being built
+    size_t runnable = 0;
+    for (; runnable < pending_commands.size(); runnable++)
+    {
+        ProjectCommandEvent& e = pending_commands[runnable];
+        if (e.type != ProjectCommandType::PROJECT_SET)
+            continue;
+
+        ProjectBuild* build = requestBuild(e.project_uid, Thread::Priority::INTERACTIVE);
+        if (build && !build->task.done())
+            break;
+    }
+
+    if (runnable > 0)
+    {
+        // The GUI may still be drawing queued frames of the current project
+        shared_sync.wait_until_pipeline_drained();
+
+        // We don't call populateAttributes() if holding shadow_buffer_mutex,
+        // meaning we won't loop over scenes here while processing project commands
+        std::unique_lock<std::mutex> shadow_lock(shared_sync.shadow_buffer_mutex);
+
+        for (size_t i = 0; i < runnable; i++)
+            handleProjectCommands(pending_commands[i]);
+
+        pending_commands.erase(pending_commands.begin(), pending_commands.begin() + runnable);
+    }
+
+    releaseBuilds();
+}
+
 void ProjectWorker::worker_loop()
 {
-    bool shadow_changed = false;
+    int pipeline_depth = 1;
 
     while (!shared_sync.quitting.load())
     {
-        /// ======== Safe place to control project changes ========
-        if (!project_command_queue.empty())
-        {
-            // We don't call populateAttributes() if holding shadow_buffer_mutex,
-            // meaning we won't loop over scenes here while processing project commands
-            std::unique_lock<std::mutex> shadow_lock(shared_sync.shadow_buffer_mutex);
+        // Back-pressure: wait until there's a free frame slot (immediately after
+        // the previous frame is drawn when lockstep, or one frame ahead when pipelined)
+        shared_sync.wait_until_can_record_frame();
 
-            for (auto& e : project_command_queue) handleProjectCommands(e);
-            project_command_queue.clear();
-        }
+        if (shared_sync.quitting.load())
+            break;
 
-        // Wait for GUI to consume the freshly-rendered previous frame
-        shared_sync.wait_until_gui_consumes_frame();
+        /// ======== Safe place to control project changes ========
+        processProjectCommands();
 
+        /// ======== Record frame (while GUI thread draws previous/cached frame) ========
+        DisplayList& display_list = display_lists[shared_sync.record_slot()];
+        display_list.clear();
 
-        /// ======== Do heavy work (while GUI thread redraws cached frame) ========
         if (active_project) 
         {
-            /// ======== Update live values ========
-            {
-                //BL::print() << "----------------------------";
-                //BL::print() << "----- NEW WORKER FRAME -----";
-
-                // ======== Event polling ========
-                {
-                    active_project->markLiveValues();
-
-                    // If shadow data changed (due to ImGui inputs), discard pending SDL events since ImGui
-                    // already processed those events internally and they shouldn't be treated as canvas input
-                    bool discard_event_batch = shadow_changed;
-                    pollEvents(discard_event_batch);
-
-                    // If handled SDL event changed live buffer, immediately push those changes to shadow buffer
-                    if (active_project->changedLive())
-                        pushDataToShadow();
-                }
-                
-                // ======== Update Live Buffer ========
-                pullDataFromShadow();
-
-                // ======== Mark buffer states prior to process ========
-                {
-                    std::unique_lock<std::mutex> shadow_lock(shared_sync.shadow_buffer_mutex);
-                    active_project->markLiveValues();
-                    active_project->markShadowValues();
-                }
-
-                // ======== Process simulation (potentially heavy work) ========
-                active_project->_projectProcess();
-
-                
-                // ======== Update shadow buffer with *changed* live variables ========
-                {
-                    shadow_changed = active_project->changedShadow();
-                    if (!shadow_changed)
-                        pushDataToShadow();
-                }
-
-                //BL::print() << "----- END WORKER FRAME -----";
-                //BL::print() << "----------------------------";
-                //BL::print() << "";
-            }
-        }
+            //BL::print() << "----------------------------";
+            //BL::print() << "----- NEW WORKER FRAME -----";
+
+            // ======== Apply UI edits to live buffer ========
+            bool ui_edited = pullDataFromShadow();
 
-        /// ======== Flag ready to draw ========
-        shared_sync.flag_ready_to_draw();
+            // ======== Event polling ========
+            // If UI edited values, discard pending SDL events since ImGui already
+            // processed those events internally and they shouldn't be treated as canvas input
+            pollEvents(ui_edited);
 
-        /// ======== Wake GUI ========
-        shared_sync.cv.notify_one();
+            // ======== Process simulation (potentially heavy work) ========
+            active_project->frame_deadline = shared_sync.budget.beginWorkerFrame(pipeline_depth);
+            active_project->_projectProcess();
 
-        // Start draw timer
-        auto draw_t0 = std::chrono::steady_clock::now();
+            // ======== Record draw calls for the GUI to replay ========
+            active_project->_projectRecord(display_list);
 
-        // Wait for GUI to draw the freshly prepared data
-        shared_sync.wait_until_gui_drawn();
+            // ======== Publish changed live variables to shadow buffer ========
+            pushDataToShadow();
+            shared_sync.budget.endWorkerFrame();
 
+            // Images upload from live pixels when replayed, so don't record ahead of those
+            pipeline_depth = display_list.drawsImages() ? 1 : active_project->pipeline_depth;
+            shared_sync.set_pipeline_depth(pipeline_depth);
+            shared_sync.resolution.setEnabled(active_project->dynamic_resolution);
 
-        // Wait 16ms (minus time taken to draw the frame)
-        //using namespace std::chrono;
-        //auto draw_duration = steady_clock::now() - draw_t0;
-        //int draw_ms = static_cast<int>(duration_cast<milliseconds>(draw_duration).count());
+            //BL::print() << "----- END WORKER FRAME -----";
+            //BL::print() << "----------------------------";
+            //BL::print() << "";
+        }
+
+        /// ======== Publish frame & wake GUI ========
+        shared_sync.publish_frame();
     }
 }
 
 void ProjectWorker::pushDataToShadow()
 {
-    // While we update the shadow buffer, we should NOT 
-    // permit ui updates (force a small stall)
-    std::unique_lock<std::mutex> shadow_lock(shared_sync.shadow_buffer_mutex);
-    active_project->updateShadowBuffers();
+    // Lock-free, GUI picks up the changes next time it populates attributes
+    active_project->pushLiveChanges();
 }
 
-void ProjectWorker::pullDataFromShadow()
+bool ProjectWorker::pullDataFromShadow()
 {
-    //if (shared_sync.editing_ui.load())
+    return active_project->pullShadowChanges();
+}
+
+// Merges a motion event into the previous staged motion event from the same pointer.
+// Positions and timestamp take the newest values, relative motion accumulates
+static bool coalesceMotion(SDL_Event& staged, const SDL_Event& e)
+{
+    if (staged.type != e.type)
+        return false;
+
+    if (e.type == SDL_EVENT_MOUSE_MOTION)
+    {
+        auto& a = staged.motion;
+        const auto& b = e.motion;
+        if (a.windowID != b.windowID || a.which != b.which || a.state != b.state)
+            return false;
+
+        a.timestamp = b.timestamp;
+        a.x = b.x;
+        a.y = b.y;
+        a.xrel += b.xrel;
+        a.yrel += b.yrel;
+        return true;
+    }
+    else if (e.type == SDL_EVENT_FINGER_MOTION)
     {
-        /// Make sure we can't alter the shadow buffer while we copy them to live buffer
-        std::lock_guard<std::mutex> live_buffer_lock(shared_sync.live_buffer_mutex);
-        shared_sync.updating_live_buffer.store(true);
+        auto& a = staged.tfinger;
+        const auto& b = e.tfinger;
+        if (a.windowID != b.windowID || a.touchID != b.touchID || a.fingerID != b.fingerID)
+            return false;
+
+        a.timestamp = b.timestamp;
+        a.x = b.x;
+        a.y = b.y;
+        a.dx += b.dx;
+        a.dy += b.dy;
+        a.pressure = b.pressure;
+        return true;
+    }
+    return false;
+}
 
-        active_project->updateLiveBuffers();
+void ProjectWorker::queueEvent(const SDL_Event& event)
+{
+    const bool is_motion =
+        event.type == SDL_EVENT_MOUSE_MOTION ||
+        event.type == SDL_EVENT_FINGER_MOTION;
 
-        shared_sync.updating_live_buffer.store(false, std::memory_order_release);
+    if (is_motion)
+    {
+        // Only ever merge into the last staged event, so interleaved streams (mouse & fingers,
+        // or several fingers) and ordering relative to button/key events are preserved
+        if (!staged_events.empty() && coalesceMotion(staged_events.back(), event))
+            return;
 
-        // Inform GUI thread that 'updating_live_buffer' changed
-        shared_sync.cv_updating_live_buffer.notify_one();
+        staged_events.push_back(event);
+    }
+    else
+    {
+        // Discrete events are published immediately (with any motion preceding them)
+        staged_events.push_back(event);
+        flushEvents();
     }
 }
 
-void ProjectWorker::queueEvent(const SDL_Event& event)
+void ProjectWorker::flushEvents()
 {
-    std::lock_guard<std::mutex> lock(event_queue_mutex);
-    input_event_queue.push_back(event);
+    // If the worker has fallen behind and the ring is full, keep the rest staged until next flush
+    size_t published = 0;
+    while (published < staged_events.size() && input_events.push(staged_events[published]))
+        published++;
+
+    staged_events.erase(staged_events.begin(), staged_events.begin() + published);
 }
 
 void ProjectWorker::pollEvents(bool discardBatch)
 {
-    // Grab event queue data (and clear via swap with empty queue)
-    std::vector<SDL_Event> local;
-    {
-        std::lock_guard<std::mutex> lock(event_queue_mutex);
-        local.swap(input_event_queue);
-    }
+    // Only process what's queued now, events arriving meanwhile are left for the next poll
+    size_t count = input_events.size();
 
-    if (!discardBatch)
+    SDL_Event e;
+    while (count-- && input_events.pop(e))
     {
-        for (SDL_Event& e : local)
-            _onEvent(e);
+        if (discardBatch)
+            continue;
+
+        // Dragging, pinching & scrolling drop the canvas resolution until input settles
+        if ((e.type == SDL_EVENT_MOUSE_MOTION && e.motion.state != 0) ||
+            e.type == SDL_EVENT_FINGER_MOTION ||
+            e.type == SDL_EVENT_MOUSE_WHEEL)
+        {
+            shared_sync.resolution.reportInteraction();
+        }
+
+        _onEvent(e);
     }
 }
 
 void ProjectWorker::populateAttributes()
 {
     if (active_project)
+    {
+        active_project->pullLiveChanges();
         active_project->_populateAllAttributes();
+        active_project->pushShadowChanges();
+    }
 }
 
 void ProjectWorker::_onEvent(SDL_Event& e)
@@ -230,8 +413,17 @@ void ProjectWorker::_onEvent(SDL_Event& e)
 
 void ProjectWorker::draw()
 {
-    if (active_project)
-        active_project->_projectDraw();
+    const DisplayList& display_list = display_lists[shared_sync.draw_slot()];
+    display_list.replay(MainWindow::instance()->getCanvas()->getRenderTarget());
+
+    drawn_hash = display_list.contentHash();
+    drawn_valid = !display_list.drawsImages();
+}
+
+bool ProjectWorker::frameUnchanged()
+{
+    const DisplayList& display_list = display_lists[shared_sync.draw_slot()];
+    return drawn_valid && !display_list.empty() && display_list.contentHash() == drawn_hash;
 }
 
 BL_END_NS
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include "threads.h"
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <sched.h>
+#include <pthread.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#endif
+
+BL_BEGIN_NS
+
+namespace Thread
+{
+    /// ======== Topology detection ========
+
+    #if defined(__linux__) && !defined(__EMSCRIPTEN__)
+
+    // Parses sysfs cpu lists, e.g. "0-7,16-23"
+    static std::vector<int> readCpuList(const std::filesystem::path& path)
+    {
+        std::vector<int> ids;
+        std::ifstream file(path);
+        std::string list;
+        if (!file || !std::getline(file, list))
+            return ids;
+
+        size_t pos = 0;
+        while (pos < list.size())
+        {
+            size_t end = list.find(',', pos);
+            if (end == std::string::npos) end = list.size();
+
+            std::string range = list.substr(pos, end - pos);
+            size_t dash = range.find('-');
+            try {
+                int first = std::stoi(range.substr(0, dash));
+                int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                for (int id = first; id <= last; id++)
+                    ids.push_back(id);
+            }
+            catch (...) {}
+
+            pos = end + 1;
+        }
+        return ids;
+    }
+
+    static int readInt(const std::filesystem::path& path, int fallback)
+    {
+        std::ifstream file(path);
+        int value;
+        return (file >> value) ? value : fallback;
+    }
+
+    static Topology detectTopology()
+    {
+        namespace fs = std::filesystem;
+        Topology topo;
+
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            return topo;
+
+        // Intel hybrid: E-cores are listed by the cpu_atom PMU
+        std::vector<int> atom_cpus = readCpuList("/sys/devices/cpu_atom/cpus");
+
+        int max_capacity = 0;
+        std::vector<int> capacities;
+
+        for (int id = 0; id < CPU_SETSIZE; id++)
+        {
+            if (!CPU_ISSET(id, &allowed))
+                continue;
+
+            fs::path cpu_dir = fs::path("/sys/devices/system/cpu") / ("cpu" + std::to_string(id));
+
+            LogicalCore core;
+            core.id = id;
+
+            std::error_code ec;
+            for (const auto& entry : fs::directory_iterator(cpu_dir, ec))
+            {
+                std::string name = entry.path().filename().string();
+                if (name.rfind("node", 0) == 0 && name.size() > 4)
+                {
+                    try { core.numa_node = std::stoi(name.substr(4)); } catch (...) {}
+                    break;
+                }
+            }
+
+            if (std::find(atom_cpus.begin(), atom_cpus.end(), id) != atom_cpus.end())
+                core.core_class = CoreClass::EFFICIENCY;
+
+            // ARM big.LITTLE: relative capacity (1024 = biggest core)
+            int capacity = readInt(cpu_dir / "cpu_capacity", 0);
+            capacities.push_back(capacity);
+            max_capacity = std::max(max_capacity, capacity);
+
+            topo.cores.push_back(core);
+            topo.numa_nodes = std::max(topo.numa_nodes, core.numa_node + 1);
+        }
+
+        if (atom_cpus.empty() && max_capacity > 0)
+        {
+            for (size_t i = 0; i < topo.cores.size(); i++)
+            {
+                if (capacities[i] < max_capacity)
+                    topo.cores[i].core_class = CoreClass::EFFICIENCY;
+            }
+        }
+
+        topo.can_pin = true;
+        return topo;
+    }
+
+    int currentCore()
+    {
+        return sched_getcpu();
+    }
+
+    bool pinCurrentThread(int core_id)
+    {
+        if (core_id < 0 || core_id >= CPU_SETSIZE)
+            return false;
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core_id, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+
+    #elif defined(_WIN32)
+
+    static Topology detectTopology()
+    {
+        Topology topo;
+
+        DWORD len = 0;
+        GetLogicalProcessorInformationEx(RelationAll, nullptr, &len);
+        if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+            return topo;
+
+        std::vector<char> buffer(len);
+        if (!GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)buffer.data(), &len))
+            return topo;
+
+        struct NodeMask { WORD group; KAFFINITY mask; int node; };
+        std::vector<NodeMask> nodes;
+        BYTE max_efficiency = 0;
+        std::vector<BYTE> efficiency;
+
+        // NUMA nodes first, so cores can look up their node
+        for (DWORD offset = 0; offset < len;)
+        {
+            auto* info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer.data() + offset);
+            if (info->Relationship == RelationNumaNode)
+            {
+                const GROUP_AFFINITY& g = info->NumaNode.GroupMask;
+                nodes.push_back({ g.Group, g.Mask, (int)info->NumaNode.NodeNumber });
+                topo.numa_nodes = std::max(topo.numa_nodes, (int)info->NumaNode.NodeNumber + 1);
+            }
+            offset += info->Size;
+        }
+
+        for (DWORD offset = 0; offset < len;)
+        {
+            auto* info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer.data() + offset);
+            if (info->Relationship == RelationProcessorCore)
+            {
+                // Higher EfficiencyClass = faster core
+                for (WORD gi = 0; gi < info->Processor.GroupCount; gi++)
+                {
+                    const GROUP_AFFINITY& g = info->Processor.GroupMask[gi];
+                    for (int bit = 0; bit < (int)sizeof(KAFFINITY) * 8; bit++)
+                    {
+                        if (!(g.Mask & ((KAFFINITY)1 << bit)))
+                            continue;
+
+                        LogicalCore core;
+                        core.id = g.Group * 64 + bit;
+                        for (const NodeMask& n : nodes)
+                            if (n.group == g.Group && (n.mask & ((KAFFINITY)1 << bit))) core.numa_node = n.node;
+
+                        topo.cores.push_back(core);
+                        efficiency.push_back(info->Processor.EfficiencyClass);
+                        max_efficiency = std::max(max_efficiency, info->Processor.EfficiencyClass);
+                    }
+                }
+            }
+            offset += info->Size;
+        }
+
+        for (size_t i = 0; i < topo.cores.size(); i++)
+        {
+            if (efficiency[i] < max_efficiency)
+                topo.cores[i].core_class = CoreClass::EFFICIENCY;
+        }
+
+        topo.can_pin = true;
+        return topo;
+    }
+
+    int currentCore()
+    {
+        PROCESSOR_NUMBER n;
+        GetCurrentProcessorNumberEx(&n);
+        return n.Group * 64 + n.Number;
+    }
+
+    bool pinCurrentThread(int core_id)
+    {
+        if (core_id < 0)
+            return false;
+
+        GROUP_AFFINITY affinity = {};
+        affinity.Group = (WORD)(core_id / 64);
+        affinity.Mask = (KAFFINITY)1 << (core_id % 64);
+        return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+    }
+
+    #else
+
+    // Emscripten / macOS: no placement control, treat every core as equal
+    static Topology detectTopology()
+    {
+        return Topology{};
+    }
+
+    int currentCore()
+    {
+        return -1;
+    }
+
+    bool pinCurrentThread(int)
+    {
+        return false;
+    }
+
+    #endif
+
+    const Topology& topology()
+    {
+        static const Topology topo = []
+        {
+            Topology t = detectTopology();
+            if (t.cores.empty())
+            {
+                // Unknown layout, assume one NUMA node of equal cores
+                t = Topology{};
+                for (unsigned int i = 0; i < idealThreadCount(); i++)
+                    t.cores.push_back(LogicalCore{ (int)i });
+                t.can_pin = false;
+            }
+
+            bool has_performance = false, has_efficiency = false;
+            for (const LogicalCore& core : t.cores)
+            {
+                has_performance |= core.core_class == CoreClass::PERFORMANCE;
+                has_efficiency |= core.core_class == CoreClass::EFFICIENCY;
+            }
+            t.hybrid = has_performance && has_efficiency;
+            return t;
+        }();
+        return topo;
+    }
+
+    /// ======== Scheduler ========
+
+    static Config scheduler_config;
+    static std::atomic<bool> scheduler_started{ false };
+
+    bool configure(const Config& config)
+    {
+        if (scheduler_started.load())
+            return false;
+
+        scheduler_config = config;
+        return true;
+    }
+
+    const Config& config()
+    {
+        return scheduler_config;
+    }
+
+    Scheduler& scheduler()
+    {
+        static Scheduler instance = [] {
+            scheduler_started.store(true);
+            return Scheduler(scheduler_config);
+        }();
+        return instance;
+    }
+}
+
+BL_END_NS
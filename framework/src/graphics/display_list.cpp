@@ -0,0 +1,406 @@
+#include "display_list.h"
+#include "nano_canvas.h"
+#include "text_layout.h"
+#include "value_hash.h"
+#include <algorithm>
+#include <cmath>
+
+BL_BEGIN_NS
+
+/// ======== Recording ========
+
+void DisplayList::finish()
+{
+    size_t h = syncHashBytes(ops.data(), ops.size() * sizeof(DrawOp));
+    syncHashCombine(h, syncHashBytes(args.data(), args.size() * sizeof(float)));
+    syncHashCombine(h, syncHashBytes(text.data(), text.size()));
+    syncHashCombine(h, syncHashBytes(text_runs.data(), text_runs.size() * sizeof(text_runs[0])));
+    for (const auto& font : fonts)
+        syncHashCombine(h, std::hash<const void*>()(font.get()));
+    for (Image* image : images)
+        syncHashCombine(h, std::hash<const void*>()(image));
+    syncHashCombine(h, syncHashBytes(circle_xy.data(), circle_xy.size() * sizeof(float)));
+    syncHashCombine(h, syncHashBytes(circle_colors.data(), circle_colors.size() * sizeof(uint32_t)));
+
+    content_hash = h;
+}
+
+void DisplayList::append(const DisplayList& other, float stroke_scale)
+{
+    size_t first_arg = args.size();
+    ops.insert(ops.end(), other.ops.begin(), other.ops.end());
+    args.insert(args.end(), other.args.begin(), other.args.end());
+
+    if (stroke_scale != 1.0f)
+    {
+        float* a = args.data() + first_arg;
+        for (DrawOp op : other.ops)
+        {
+            if (op == DrawOp::STROKE_WIDTH)
+                a[0] *= stroke_scale;
+            a += drawOpArgCount(op);
+        }
+    }
+
+    // Text runs are offsets into this list's text
+    uint32_t text_offset = (uint32_t)text.size();
+    text.append(other.text);
+    for (auto [offset, length] : other.text_runs)
+        text_runs.push_back({ offset + text_offset, length });
+
+    fonts.insert(fonts.end(), other.fonts.begin(), other.fonts.end());
+    images.insert(images.end(), other.images.begin(), other.images.end());
+    circle_xy.insert(circle_xy.end(), other.circle_xy.begin(), other.circle_xy.end());
+    circle_colors.insert(circle_colors.end(), other.circle_colors.begin(), other.circle_colors.end());
+}
+
+/// ======== Flattening ========
+
+// Only reached when a curve is huge relative to the tolerance (zoomed far into it)
+constexpr int max_curve_segments = 256;
+
+// Segment count from Wang's formula, so no point on the curve strays more than 'tolerance'
+static int curveSegments(float ddx, float ddy, float degree_factor, float tolerance)
+{
+    float dd = std::sqrt(ddx * ddx + ddy * ddy);
+    int n = (int)std::ceil(std::sqrt(degree_factor * dd / tolerance));
+    return std::clamp(n, 1, max_curve_segments);
+}
+
+static void flattenCubic(DisplayList& out, float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3, float tolerance)
+{
+    float ddx = std::max(std::abs(x0 - 2 * x1 + x2), std::abs(x1 - 2 * x2 + x3));
+    float ddy = std::max(std::abs(y0 - 2 * y1 + y2), std::abs(y1 - 2 * y2 + y3));
+    int n = curveSegments(ddx, ddy, 0.75f, tolerance);
+
+    for (int i = 1; i <= n; i++)
+    {
+        float t = (float)i / (float)n;
+        float u = 1.0f - t;
+        float b0 = u * u * u, b1 = 3 * u * u * t, b2 = 3 * u * t * t, b3 = t * t * t;
+        out.push(DrawOp::LINE_TO,
+            b0 * x0 + b1 * x1 + b2 * x2 + b3 * x3,
+            b0 * y0 + b1 * y1 + b2 * y2 + b3 * y3);
+    }
+}
+
+static void flattenQuadratic(DisplayList& out, float x0, float y0, float x1, float y1, float x2, float y2, float tolerance)
+{
+    int n = curveSegments(std::abs(x0 - 2 * x1 + x2), std::abs(y0 - 2 * y1 + y2), 0.25f, tolerance);
+
+    for (int i = 1; i <= n; i++)
+    {
+        float t = (float)i / (float)n;
+        float u = 1.0f - t;
+        float b0 = u * u, b1 = 2 * u * t, b2 = t * t;
+        out.push(DrawOp::LINE_TO,
+            b0 * x0 + b1 * x1 + b2 * x2,
+            b0 * y0 + b1 * y1 + b2 * y2);
+    }
+}
+
+void DisplayList::flattenInto(DisplayList& out, float tolerance, float& origin_x, float& origin_y) const
+{
+    out.clear();
+    out.text = text;
+    out.text_runs = text_runs;
+    out.fonts = fonts;
+    out.images = images;
+
+    // Coordinates can only be offset while they're all in the same space, so the origin is
+    // the first point unless the geometry changes the transform itself
+    origin_x = origin_y = 0.0f;
+    {
+        bool found_origin = false;
+        bool transformed = false;
+        const float* a = args.data();
+        for (DrawOp op : ops)
+        {
+            switch (op)
+            {
+            case DrawOp::RESET_TRANSFORM:
+            case DrawOp::TRANSFORM:
+            case DrawOp::TRANSLATE:
+            case DrawOp::ROTATE:
+            case DrawOp::SCALE:
+            case DrawOp::SKEW_X:
+            case DrawOp::SKEW_Y:
+                transformed = true;
+                break;
+            case DrawOp::MOVE_TO:
+                if (!found_origin) { origin_x = a[0]; origin_y = a[1]; found_origin = true; }
+                break;
+            default:
+                break;
+            }
+            a += drawOpArgCount(op);
+        }
+
+        if (transformed)
+            origin_x = origin_y = 0.0f;
+    }
+
+    const float ox = origin_x, oy = origin_y;
+    const float* a = args.data();
+
+    out.circle_colors = circle_colors;
+    out.circle_xy.resize(circle_xy.size());
+    for (size_t i = 0; i < circle_xy.size(); i += 2)
+    {
+        out.circle_xy[i] = circle_xy[i] - ox;
+        out.circle_xy[i + 1] = circle_xy[i + 1] - oy;
+    }
+
+    // Current point & subpath start (only known after ops which end on a known point)
+    float cx = 0, cy = 0, sx = 0, sy = 0;
+    bool known = false;
+
+    for (DrawOp op : ops)
+    {
+        switch (op)
+        {
+        case DrawOp::BEGIN_PATH:
+            known = false;
+            out.push(op);
+            break;
+
+        case DrawOp::MOVE_TO:
+            cx = sx = a[0] - ox;
+            cy = sy = a[1] - oy;
+            known = true;
+            out.push(op, cx, cy);
+            break;
+
+        case DrawOp::LINE_TO:
+            cx = a[0] - ox;
+            cy = a[1] - oy;
+            out.push(op, cx, cy);
+            break;
+
+        case DrawOp::BEZIER_TO:
+        {
+            float x1 = a[0] - ox, y1 = a[1] - oy;
+            float x2 = a[2] - ox, y2 = a[3] - oy;
+            float x3 = a[4] - ox, y3 = a[5] - oy;
+            if (known) flattenCubic(out, cx, cy, x1, y1, x2, y2, x3, y3, tolerance);
+            else       out.push(op, x1, y1, x2, y2, x3, y3);
+            cx = x3;
+            cy = y3;
+        }
+        break;
+
+        case DrawOp::QUAD_TO:
+        {
+            float x1 = a[0] - ox, y1 = a[1] - oy;
+            float x2 = a[2] - ox, y2 = a[3] - oy;
+            if (known) flattenQuadratic(out, cx, cy, x1, y1, x2, y2, tolerance);
+            else       out.push(op, x1, y1, x2, y2);
+            cx = x2;
+            cy = y2;
+        }
+        break;
+
+        case DrawOp::CLOSE_PATH:
+            cx = sx;
+            cy = sy;
+            out.push(op);
+            break;
+
+        case DrawOp::ARC:
+            out.push(op, a[0] - ox, a[1] - oy, a[2], a[3], a[4], a[5]);
+            cx = a[0] - ox + a[2] * std::cos(a[4]);
+            cy = a[1] - oy + a[2] * std::sin(a[4]);
+            known = true;
+            break;
+
+        case DrawOp::RECT:
+            out.push(op, a[0] - ox, a[1] - oy, a[2], a[3]);
+            cx = sx = a[0] - ox;
+            cy = sy = a[1] - oy;
+            known = true;
+            break;
+
+        case DrawOp::ARC_TO:
+            out.push(op, a[0] - ox, a[1] - oy, a[2] - ox, a[3] - oy, a[4]);
+            known = false;
+            break;
+
+        case DrawOp::ROUNDED_RECT:
+            out.push(op, a[0] - ox, a[1] - oy, a[2], a[3], a[4]);
+            known = false;
+            break;
+
+        case DrawOp::CIRCLE:
+            out.push(op, a[0] - ox, a[1] - oy, a[2]);
+            known = false;
+            break;
+
+        case DrawOp::ELLIPSE:
+            out.push(op, a[0] - ox, a[1] - oy, a[2], a[3]);
+            known = false;
+            break;
+
+        case DrawOp::SCISSOR:
+            out.push(op, a[0] - ox, a[1] - oy, a[2], a[3]);
+            break;
+
+        case DrawOp::TEXT:
+            out.push(op, a[0] - ox, a[1] - oy);
+            break;
+
+        case DrawOp::IMAGE:
+            out.push(op, a[0], a[1], a[2], a[3], a[4] - ox, a[5] - oy);
+            break;
+
+        default:
+            out.ops.push_back(op);
+            out.args.insert(out.args.end(), a, a + drawOpArgCount(op));
+            break;
+        }
+
+        a += drawOpArgCount(op);
+    }
+}
+
+// Renderer callbacks for the measuring context. Nothing is ever rendered with it (paths
+// aren't applied to it), it only needs fontstash and the state stack
+static int  measureCreate(void*)                                             { return 1; }
+static int  measureCreateTexture(void*, int, int, int, int, const unsigned char*) { return 1; }
+static int  measureDeleteTexture(void*, int)                                 { return 1; }
+static int  measureUpdateTexture(void*, int, int, int, int, int, const unsigned char*) { return 1; }
+static int  measureGetTextureSize(void*, int, int*, int*)                    { return 0; }
+static void measureViewport(void*, float, float, float)                      {}
+static void measureCancel(void*)                                             {}
+static void measureFlush(void*)                                              {}
+static void measureFill(void*, NVGpaint*, NVGcompositeOperationState, NVGscissor*, float, const float*, const NVGpath*, int) {}
+static void measureStroke(void*, NVGpaint*, NVGcompositeOperationState, NVGscissor*, float, float, const NVGpath*, int) {}
+static void measureTriangles(void*, NVGpaint*, NVGcompositeOperationState, NVGscissor*, const NVGvertex*, int, float) {}
+static void measureDelete(void*)                                             {}
+
+NVGcontext* DisplayList::measureContext()
+{
+    struct MeasureContext
+    {
+        NVGcontext* vg = nullptr;
+
+        MeasureContext()
+        {
+            NVGparams params = {};
+            params.renderCreate = measureCreate;
+            params.renderCreateTexture = measureCreateTexture;
+            params.renderDeleteTexture = measureDeleteTexture;
+            params.renderUpdateTexture = measureUpdateTexture;
+            params.renderGetTextureSize = measureGetTextureSize;
+            params.renderViewport = measureViewport;
+            params.renderCancel = measureCancel;
+            params.renderFlush = measureFlush;
+            params.renderFill = measureFill;
+            params.renderStroke = measureStroke;
+            params.renderTriangles = measureTriangles;
+            params.renderDelete = measureDelete;
+            params.edgeAntiAlias = 1;
+            vg = nvgCreateInternal(&params);
+        }
+
+        ~MeasureContext()
+        {
+            if (vg) nvgDeleteInternal(vg);
+        }
+    };
+
+    static MeasureContext context;
+    return context.vg;
+}
+
+/// ======== Replay ========
+
+void DisplayList::replay(NVGcontext* vg, float stroke_scale) const
+{
+    const float* a = args.data();
+    size_t text_i = 0;
+    size_t font_i = 0;
+    size_t image_i = 0;
+    size_t circle_i = 0;
+    size_t circle_color_i = 0;
+    TextLayoutCache* text_layouts = nullptr;
+
+    for (DrawOp op : ops)
+    {
+        switch (op)
+        {
+        case DrawOp::SAVE:            nvgSave(vg); break;
+        case DrawOp::RESTORE:         nvgRestore(vg); break;
+        case DrawOp::RESET_TRANSFORM: nvgResetTransform(vg); break;
+        case DrawOp::TRANSFORM:       nvgTransform(vg, a[0], a[1], a[2], a[3], a[4], a[5]); a += 6; break;
+        case DrawOp::TRANSLATE:       nvgTranslate(vg, a[0], a[1]); a += 2; break;
+        case DrawOp::ROTATE:          nvgRotate(vg, a[0]); a += 1; break;
+        case DrawOp::SCALE:           nvgScale(vg, a[0], a[1]); a += 2; break;
+        case DrawOp::SKEW_X:          nvgSkewX(vg, a[0]); a += 1; break;
+        case DrawOp::SKEW_Y:          nvgSkewY(vg, a[0]); a += 1; break;
+        case DrawOp::SCISSOR:         nvgScissor(vg, a[0], a[1], a[2], a[3]); a += 4; break;
+        case DrawOp::RESET_SCISSOR:   nvgResetScissor(vg); break;
+
+        case DrawOp::FILL_COLOR:      nvgFillColor(vg, nvgRGBAf(a[0], a[1], a[2], a[3])); a += 4; break;
+        case DrawOp::STROKE_COLOR:    nvgStrokeColor(vg, nvgRGBAf(a[0], a[1], a[2], a[3])); a += 4; break;
+        case DrawOp::STROKE_WIDTH:    nvgStrokeWidth(vg, a[0] * stroke_scale); a += 1; break;
+        case DrawOp::LINE_CAP:        nvgLineCap(vg, (int)a[0]); a += 1; break;
+        case DrawOp::LINE_JOIN:       nvgLineJoin(vg, (int)a[0]); a += 1; break;
+        case DrawOp::TEXT_ALIGN:      nvgTextAlign(vg, (int)a[0]); a += 1; break;
+        case DrawOp::FONT_SIZE:       nvgFontSize(vg, a[0]); a += 1; break;
+        case DrawOp::FONT_FACE:
+        {
+            // Fonts are created on the replaying context the first time they're used
+            nvgFontFaceId(vg, fonts[font_i++]->contextId(vg));
+        }
+        break;
+
+        case DrawOp::BEGIN_PATH:      nvgBeginPath(vg); break;
+        case DrawOp::MOVE_TO:         nvgMoveTo(vg, a[0], a[1]); a += 2; break;
+        case DrawOp::LINE_TO:         nvgLineTo(vg, a[0], a[1]); a += 2; break;
+        case DrawOp::BEZIER_TO:       nvgBezierTo(vg, a[0], a[1], a[2], a[3], a[4], a[5]); a += 6; break;
+        case DrawOp::QUAD_TO:         nvgQuadTo(vg, a[0], a[1], a[2], a[3]); a += 4; break;
+        case DrawOp::ARC:             nvgArc(vg, a[0], a[1], a[2], a[3], a[4], (int)a[5]); a += 6; break;
+        case DrawOp::ARC_TO:          nvgArcTo(vg, a[0], a[1], a[2], a[3], a[4]); a += 5; break;
+        case DrawOp::CLOSE_PATH:      nvgClosePath(vg); break;
+        case DrawOp::RECT:            nvgRect(vg, a[0], a[1], a[2], a[3]); a += 4; break;
+        case DrawOp::ROUNDED_RECT:    nvgRoundedRect(vg, a[0], a[1], a[2], a[3], a[4]); a += 5; break;
+        case DrawOp::CIRCLE:          nvgCircle(vg, a[0], a[1], a[2]); a += 3; break;
+        case DrawOp::ELLIPSE:         nvgEllipse(vg, a[0], a[1], a[2], a[3]); a += 4; break;
+        case DrawOp::FILL:            nvgFill(vg); break;
+        case DrawOp::STROKE:          nvgStroke(vg); break;
+
+        case DrawOp::TEXT:
+        {
+            auto [offset, length] = text_runs[text_i++];
+            if (!text_layouts)
+                text_layouts = &TextLayoutCache::of(vg);
+
+            text_layouts->fillText(a[0], a[1], std::string_view(text.data() + offset, length));
+            a += 2;
+        }
+        break;
+
+        case DrawOp::IMAGE:
+            SimplePainter::paintImage(vg, *images[image_i++], a);
+            a += 6;
+            break;
+
+        case DrawOp::CIRCLES:
+        {
+            int count = (int)a[1];
+            const uint32_t* colors = nullptr;
+            if (a[2] != 0.0f)
+            {
+                colors = circle_colors.data() + circle_color_i;
+                circle_color_i += count;
+            }
+            SimplePainter::paintCircles(vg, circle_xy.data() + circle_i * 2, count, a[0], colors);
+            circle_i += count;
+            a += 3;
+        }
+        break;
+        }
+    }
+}
+
+BL_END_NS
@@ -6,6 +6,8 @@
 
 #include "nano_canvas.h"
 #include "project.h"
+#include <cstring>
+#include <algorithm>
 
 BL_BEGIN_NS
 
@@ -184,13 +186,255 @@ void Painter::drawWorldAxis(
     camera.restoreCameraTransform();
 }
 
-void Canvas::create(double _global_scale)
+void Painter::drawRetainedPath(RetainedPath& path)
 {
-    #ifdef __EMSCRIPTEN__
-    vg = nvgCreateGLES3(NVG_ANTIALIAS | NVG_STENCIL_STROKES);
-    #else
-    vg = nvgCreateGL3(NVG_ANTIALIAS | NVG_STENCIL_STROKES);
-    #endif
+    // Re-flatten when zoomed in enough for segments to show, or out enough to waste vertices
+    constexpr double max_zoom_in = 2.0;
+    constexpr double max_zoom_out = 4.0;
+
+    const double zoom = camera.transform_coordinates ? _avgZoom() : 1.0;
+    if (path.flattened_zoom <= 0.0 ||
+        zoom > path.flattened_zoom * max_zoom_in ||
+        zoom < path.flattened_zoom / max_zoom_out)
+    {
+        // Match nanovg's own tolerance (1/4 device pixel)
+        float tolerance = (float)(0.25 / (global_scale * zoom));
+        path.source.flattenInto(path.flattened, tolerance, path.origin_x, path.origin_y);
+        path.flattened_zoom = zoom;
+    }
+
+    save();
+
+    // World -> stage for the whole path (in double precision, relative to its origin)
+    const double ox = path.origin_x, oy = path.origin_y;
+    if (camera.transform_coordinates)
+    {
+        DVec2 o = camera.toStage(ox, oy);
+        DVec2 ex = camera.toStage(ox + 1.0, oy) - o;
+        DVec2 ey = camera.toStage(ox, oy + 1.0) - o;
+        transform(glm::mat3(
+            (float)ex.x, (float)ex.y, 0.0f,
+            (float)ey.x, (float)ey.y, 0.0f,
+            (float)o.x,  (float)o.y,  1.0f));
+    }
+    else
+    {
+        translate(ox, oy);
+    }
+
+    // nanovg scales stroke widths by the transform, so undo it unless lines scale with the camera
+    const float stroke_scale = (camera.transform_coordinates && !camera.scale_lines) ? (float)(1.0 / zoom) : 1.0f;
+    SimplePainter::setLineWidth(line_width * stroke_scale);
+
+    if (display_list)
+        display_list->append(path.flattened, stroke_scale);
+    else
+        path.flattened.replay(vg, stroke_scale);
+
+    restore();
+}
+
+void Painter::emitVectorPaths(const VectorPaths& paths)
+{
+    // Only called while capturing (camera transform off), so path calls go straight to the list
+    auto rgba = [](uint32_t c) {
+        return nvgRGBA(c & 0xff, (c >> 8) & 0xff, (c >> 16) & 0xff, (c >> 24) & 0xff);
+    };
+
+    const float* p = paths.coords.data();
+    const VectorPaths::Command* cmd = paths.commands.data();
+
+    for (const VectorPaths::Shape& shape : paths.shapes)
+    {
+        SimplePainter::beginPath();
+        for (uint32_t i = 0; i < shape.command_count; i++, cmd++)
+        {
+            switch (*cmd)
+            {
+            case VectorPaths::Command::MOVE_TO:   SimplePainter::moveTo(p[0], p[1]); break;
+            case VectorPaths::Command::LINE_TO:   SimplePainter::lineTo(p[0], p[1]); break;
+            case VectorPaths::Command::BEZIER_TO: SimplePainter::bezierTo(p[0], p[1], p[2], p[3], p[4], p[5]); break;
+            case VectorPaths::Command::CLOSE:     SimplePainter::closePath(); break;
+            }
+            p += VectorPaths::coordCount(*cmd);
+        }
+
+        if (shape.flags & VectorPaths::SHAPE_FILL)
+        {
+            SimplePainter::setFillStyle(rgba(shape.fill));
+            SimplePainter::fill();
+        }
+
+        if (shape.flags & VectorPaths::SHAPE_STROKE)
+        {
+            SimplePainter::setLineWidth(shape.stroke_width);
+            SimplePainter::setLineCap((LineCap)shape.line_cap);
+            SimplePainter::setLineJoin((LineJoin)shape.line_join);
+            SimplePainter::setStrokeStyle(rgba(shape.stroke));
+            SimplePainter::stroke();
+        }
+    }
+}
+
+/// ======== Batched circles ========
+
+// The sprite's disc has a 1 texel margin, so bilinear sampling fades to nothing at the quad edge
+constexpr int circle_sprite_size = 128;
+constexpr float circle_sprite_radius = circle_sprite_size * 0.5f - 1.0f;
+
+// Larger circles (in device pixels) are drawn as paths, before the sprite's edge visibly blurs
+constexpr float max_sprite_circle_radius = circle_sprite_radius;
+
+// Anti-aliased white disc
+static int createCircleSprite(NVGcontext* vg)
+{
+    constexpr int n = circle_sprite_size;
+    constexpr float c = n * 0.5f;
+    std::vector<uint8_t> rgba(n * n * 4);
+    for (int y = 0; y < n; y++)
+    {
+        for (int x = 0; x < n; x++)
+        {
+            float dx = x + 0.5f - c, dy = y + 0.5f - c;
+            float coverage = std::clamp(circle_sprite_radius + 0.5f - std::sqrt(dx * dx + dy * dy), 0.0f, 1.0f);
+            uint8_t* p = &rgba[(y * n + x) * 4];
+            p[0] = p[1] = p[2] = 255;
+            p[3] = (uint8_t)(coverage * 255.0f + 0.5f);
+        }
+    }
+
+    return nvgCreateImageRGBA(vg, n, n, NVG_IMAGE_GENERATE_MIPMAPS, rgba.data());
+}
+
+// Sprite and scratch vertices of one context. A context is only drawn to by one thread at
+// a time, so only finding its batch needs the lock
+struct CircleBatch
+{
+    NVGcontext* vg;
+    int sprite;
+    std::vector<NVGvertex> verts;
+};
+
+static std::mutex circle_batch_mutex;
+static std::vector<std::unique_ptr<CircleBatch>> circle_batches;
+
+// Created the first time a context draws sprite circles, deleted with the context (see Canvas::destroy)
+static CircleBatch& circleBatch(NVGcontext* vg)
+{
+    std::lock_guard<std::mutex> lock(circle_batch_mutex);
+    for (auto& batch : circle_batches)
+    {
+        if (batch->vg == vg)
+            return *batch;
+    }
+
+    circle_batches.push_back(std::make_unique<CircleBatch>(CircleBatch{ vg, createCircleSprite(vg), {} }));
+    return *circle_batches.back();
+}
+
+static void releaseCircleBatch(NVGcontext* vg)
+{
+    std::lock_guard<std::mutex> lock(circle_batch_mutex);
+    for (size_t i = 0; i < circle_batches.size(); i++)
+    {
+        if (circle_batches[i]->vg == vg)
+        {
+            nvgDeleteImage(vg, circle_batches[i]->sprite);
+            circle_batches.erase(circle_batches.begin() + i);
+            return;
+        }
+    }
+}
+
+void SimplePainter::paintCircles(NVGcontext* ctx, const float* xy, int count, float r, const uint32_t* colors)
+{
+    if (count <= 0 || r <= 0.0f)
+        return;
+
+    auto rgba = [](uint32_t c) {
+        return nvgRGBA(c & 0xff, (c >> 8) & 0xff, (c >> 16) & 0xff, (c >> 24) & 0xff);
+    };
+
+    // Calls fn(first, last) for each run of circles sharing a color
+    auto forEachRun = [&](auto&& fn)
+    {
+        for (int first = 0; first < count;)
+        {
+            int last = count;
+            if (colors)
+            {
+                last = first + 1;
+                while (last < count && colors[last] == colors[first])
+                    last++;
+                nvgFillColor(ctx, rgba(colors[first]));
+            }
+            fn(first, last);
+            first = last;
+        }
+    };
+
+    float m[6];
+    nvgCurrentTransform(ctx, m);
+    const float det = m[0] * m[3] - m[1] * m[2];
+    const float device_r = r * std::sqrt(std::abs(det));
+
+    if (colors)
+        nvgSave(ctx);
+
+    // The software renderer doesn't mipmap, so it rasterizes small circles exactly instead
+    if (device_r <= max_sprite_circle_radius && !nvgIsSoftware(ctx))
+    {
+        CircleBatch& batch = circleBatch(ctx);
+        std::vector<NVGvertex>& verts = batch.verts;
+        const float h = r * (circle_sprite_size * 0.5f) / circle_sprite_radius;
+
+        // Keep triangles front-facing (nanovg culls back faces) under a flipping transform
+        const int a = det < 0.0f ? 2 : 1;
+        const int b = 3 - a;
+
+        forEachRun([&](int first, int last)
+        {
+            verts.resize(size_t(last - first) * 6);
+            NVGvertex* v = verts.data();
+            for (int i = first; i < last; i++, v += 6)
+            {
+                float x0 = xy[i * 2] - h, y0 = xy[i * 2 + 1] - h;
+                float x1 = xy[i * 2] + h, y1 = xy[i * 2 + 1] + h;
+                v[0] = { x0, y0, 0, 0 }; v[a] = { x1, y1, 1, 1 }; v[b] = { x1, y0, 1, 0 };
+                v[3] = { x0, y0, 0, 0 }; v[3 + a] = { x0, y1, 0, 1 }; v[3 + b] = { x1, y1, 1, 1 };
+            }
+            nvgFillTriangles(ctx, verts.data(), (int)verts.size(), batch.sprite);
+        });
+    }
+    else
+    {
+        forEachRun([&](int first, int last)
+        {
+            nvgBeginPath(ctx);
+            for (int i = first; i < last; i++)
+                nvgCircle(ctx, xy[i * 2], xy[i * 2 + 1], r);
+            nvgFill(ctx);
+        });
+    }
+
+    if (colors)
+        nvgRestore(ctx);
+}
+
+void Canvas::create(double _global_scale, CanvasBackend _backend)
+{
+    backend = _backend;
+
+    if (backend == CanvasBackend::SOFTWARE)
+        vg = nvgCreateSoftware();
+    else
+    {
+        #ifdef __EMSCRIPTEN__
+        vg = nvgCreateGLES3(NVG_ANTIALIAS | NVG_STENCIL_STROKES);
+        #else
+        vg = nvgCreateGL3(NVG_ANTIALIAS | NVG_STENCIL_STROKES);
+        #endif
+    }
 
     setGlobalScale(_global_scale);
 
@@ -199,6 +443,37 @@ void Canvas::create(double _global_scale)
     SimplePainter::default_font->setSize(16.0f);
 }
 
+void Canvas::destroy()
+{
+    if (!vg)
+        return;
+
+    // Drop its images first, so a later context at the same address doesn't inherit stale ids
+    releaseCircleBatch(vg);
+    StoragePool::releaseContext(vg);
+
+    if (backend == CanvasBackend::SOFTWARE)
+        nvgDeleteSoftware(vg);
+    else
+    {
+        if (target.fbo)
+            StoragePool::releaseTarget(target);
+        target = {};
+
+        #ifdef __EMSCRIPTEN__
+        nvgDeleteGLES3(vg);
+        #else
+        nvgDeleteGL3(vg);
+        #endif
+    }
+
+    vg = nullptr;
+    cpu_pixels.clear();
+    fbo_width = fbo_height = 0;
+    storage_width = storage_height = 0;
+    frame_width = frame_height = 0;
+}
+
 bool Canvas::resize(int w, int h)
 {
     if ((w == fbo_width && fbo_height == h) ||
@@ -210,48 +485,406 @@ bool Canvas::resize(int w, int h)
     fbo_width = w;
     fbo_height = h;
 
-    if (fbo) glDeleteFramebuffers(1, &fbo);
-    if (tex) glDeleteTextures(1, &tex);
-    if (rbo) glDeleteRenderbuffers(1, &rbo);
+    // Small resizes stay within the current storage
+    int new_w = StoragePool::capacityFor(storage_width, w);
+    int new_h = StoragePool::capacityFor(storage_height, h);
+    if (new_w == storage_width && new_h == storage_height)
+        return true;
+
+    storage_width = new_w;
+    storage_height = new_h;
+
+    if (backend == CanvasBackend::SOFTWARE)
+    {
+        cpu_pixels.assign(size_t(storage_width) * storage_height * 4, 0);
+        return true;
+    }
+
+    if (target.fbo)
+        StoragePool::releaseTarget(target);
+
+    target = StoragePool::acquireTarget(storage_width, storage_height);
+    return true;
+}
+
+/// ======== PixelUploadStream ========
 
-    glGenFramebuffers(1, &fbo);
-    glGenTextures(1, &tex);
-    glGenRenderbuffers(1, &rbo);
+static std::mutex pbo_garbage_mutex;
+static std::vector<std::pair<GLuint, GLsync>> pbo_garbage;
 
-    glBindTexture(GL_TEXTURE_2D, tex);
+void PixelUploadStream::release()
+{
+    std::lock_guard<std::mutex> lock(pbo_garbage_mutex);
+    for (Slot& slot : slots)
+    {
+        if (slot.pbo)
+            pbo_garbage.push_back({ slot.pbo, slot.fence });
+        slot = Slot{};
+    }
+}
+
+void PixelUploadStream::collectGarbage()
+{
+    std::lock_guard<std::mutex> lock(pbo_garbage_mutex);
+    for (auto [pbo, fence] : pbo_garbage)
+    {
+        if (fence) glDeleteSync(fence);
+        glDeleteBuffers(1, &pbo);
+    }
+    pbo_garbage.clear();
+}
+
+bool PixelUploadStream::upload(NVGcontext* vg, int image, const uint8_t* pixels, int image_width, const std::vector<PixelRect>& rects)
+{
+    #ifdef __EMSCRIPTEN__
+    // WebGL can't map buffers
+    (void)vg; (void)image; (void)pixels; (void)image_width; (void)rects;
+    return false;
+    #else
+    Slot& slot = slots[next_slot];
+
+    // Never stall: if the GPU hasn't consumed this buffer yet, let the caller upload directly
+    if (slot.fence)
+    {
+        GLenum status = glClientWaitSync(slot.fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED)
+            return false;
+
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+    }
+
+    size_t bytes = 0;
+    for (const PixelRect& r : rects)
+        bytes += size_t(r.w) * r.h * 4;
+
+    const bool persistent = GLAD_GL_VERSION_4_4;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+
+    if (!slot.pbo || slot.capacity < bytes)
+    {
+        // (Re)allocate with headroom, so growing dirty regions don't reallocate every frame
+        if (slot.pbo)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glDeleteBuffers(1, &slot.pbo);
+        }
+
+        slot.capacity = bytes + bytes / 2;
+        glGenBuffers(1, &slot.pbo);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+
+        if (persistent)
+        {
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)slot.capacity, nullptr, flags);
+            slot.mapped = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)slot.capacity, flags);
+        }
+        else
+        {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)slot.capacity, nullptr, GL_STREAM_DRAW);
+            slot.mapped = nullptr;
+        }
+    }
+
+    uint8_t* dst = slot.mapped;
+    if (!persistent)
+    {
+        // Fence guarantees the GPU is done with this buffer, so no implicit sync is needed
+        dst = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)bytes,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    }
+
+    if (!dst)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return false;
+    }
+
+    // Pack each rect tightly
+    size_t offset = 0;
+    for (const PixelRect& r : rects)
+    {
+        const size_t row_bytes = size_t(r.w) * 4;
+        const uint8_t* src = pixels + (size_t(r.y) * image_width + r.x) * 4;
+        for (int y = 0; y < r.h; y++)
+        {
+            std::memcpy(dst + offset, src, row_bytes);
+            src += size_t(image_width) * 4;
+            offset += row_bytes;
+        }
+    }
+
+    if (!persistent)
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    // Upload from the buffer (returns without waiting for the transfer). Direct GL calls
+    // bypass nanovg's state cache, so restore the texture binding afterwards
+    GLint prev_texture = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &prev_texture);
+    glBindTexture(GL_TEXTURE_2D, nvglImageHandleGL3(vg, image));
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    offset = 0;
+    for (const PixelRect& r : rects)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)offset);
+        offset += size_t(r.w) * r.h * 4;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, (GLuint)prev_texture);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    next_slot = (next_slot + 1) % ring_size;
+    return true;
+    #endif
+}
+
+/// ======== StoragePool ========
+
+struct PooledImage
+{
+    NVGcontext* vg;
+    int image, width, height;
+};
+
+static std::mutex storage_pool_mutex;
+static std::vector<PooledImage> free_images;
+static std::vector<StoragePool::RenderTarget> free_targets;
+
+int StoragePool::sizeClass(int n)
+{
+    if (n <= 64)
+        return 64;
+
+    // Quarter steps between powers of two: 64, 80, 96, 112, 128, 160, ... 1024, 1280, 1536, ...
+    int pow2 = 1;
+    while (pow2 * 2 <= n)
+        pow2 *= 2;
+
+    const int step = pow2 / 4;
+    return (n + step - 1) / step * step;
+}
+
+int StoragePool::capacityFor(int cap, int n)
+{
+    if (n > cap)
+        return sizeClass(std::max(n, cap + cap / 2));
+    if (cap > 2 * sizeClass(n))
+        return sizeClass(n);
+    return cap;
+}
+
+int StoragePool::acquireImage(NVGcontext* vg, int w, int h)
+{
+    {
+        std::lock_guard<std::mutex> lock(storage_pool_mutex);
+        for (size_t i = 0; i < free_images.size(); i++)
+        {
+            const PooledImage& pooled = free_images[i];
+            if (pooled.vg == vg && pooled.width == w && pooled.height == h)
+            {
+                int image = pooled.image;
+                free_images.erase(free_images.begin() + i);
+                return image;
+            }
+        }
+    }
+
+    return nvgCreateImageRGBA(vg, w, h, NVG_IMAGE_NEAREST, nullptr);
+}
+
+void StoragePool::releaseImage(NVGcontext* vg, int image, int w, int h)
+{
+    std::lock_guard<std::mutex> lock(storage_pool_mutex);
+    free_images.push_back({ vg, image, w, h });
+}
+
+StoragePool::RenderTarget StoragePool::acquireTarget(int w, int h)
+{
+    {
+        std::lock_guard<std::mutex> lock(storage_pool_mutex);
+        for (size_t i = 0; i < free_targets.size(); i++)
+        {
+            if (free_targets[i].width == w && free_targets[i].height == h)
+            {
+                RenderTarget target = free_targets[i];
+                free_targets.erase(free_targets.begin() + i);
+                return target;
+            }
+        }
+    }
+
+    RenderTarget target;
+    target.width = w;
+    target.height = h;
+
+    glGenFramebuffers(1, &target.fbo);
+    glGenTextures(1, &target.tex);
+    glGenRenderbuffers(1, &target.rbo);
+
+    glBindTexture(GL_TEXTURE_2D, target.tex);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, target.rbo);
     glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, w, h);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.tex, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target.rbo);
 
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    return true;
+    return target;
+}
+
+void StoragePool::releaseTarget(const RenderTarget& target)
+{
+    std::lock_guard<std::mutex> lock(storage_pool_mutex);
+    free_targets.push_back(target);
+}
+
+void StoragePool::releaseContext(NVGcontext* vg)
+{
+    std::lock_guard<std::mutex> lock(storage_pool_mutex);
+    std::erase_if(free_images, [vg](const PooledImage& pooled)
+    {
+        if (pooled.vg != vg)
+            return false;
+        nvgDeleteImage(pooled.vg, pooled.image);
+        return true;
+    });
+}
+
+void StoragePool::collectGarbage(NVGcontext* vg)
+{
+    std::lock_guard<std::mutex> lock(storage_pool_mutex);
+
+    // Oldest first, only 'vg's images (other contexts may belong to other threads)
+    size_t own = std::count_if(free_images.begin(), free_images.end(),
+        [vg](const PooledImage& pooled) { return pooled.vg == vg; });
+
+    for (size_t i = 0; i < free_images.size() && own > (size_t)max_free;)
+    {
+        if (free_images[i].vg != vg)
+        {
+            i++;
+            continue;
+        }
+
+        nvgDeleteImage(vg, free_images[i].image);
+        free_images.erase(free_images.begin() + i);
+        own--;
+    }
+
+    // Render targets are GL objects, not tied to a nanovg context
+    if (nvgIsSoftware(vg))
+        return;
+
+    while (free_targets.size() > (size_t)max_free)
+    {
+        RenderTarget& target = free_targets.front();
+        glDeleteFramebuffers(1, &target.fbo);
+        glDeleteTextures(1, &target.tex);
+        glDeleteRenderbuffers(1, &target.rbo);
+        free_targets.erase(free_targets.begin());
+    }
+}
+
+/// ======== Canvas ========
+
+bool Canvas::setResolutionScale(double scale)
+{
+    int old_w = renderWidth(), old_h = renderHeight();
+    resolution_scale.store(std::clamp(scale, 0.1, 1.0), std::memory_order_relaxed);
+    return renderWidth() != old_w || renderHeight() != old_h;
 }
 
 void Canvas::begin(float r, float g, float b, float a)
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glViewport(0, 0, fbo_width, fbo_height);
-    glClearColor(r, g, b, a);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    // Drawn in fbo coordinates, nanovg's view maps them onto the (possibly smaller) render area
+    const int render_w = renderWidth();
+    const int render_h = renderHeight();
+    const double render_scale = fbo_width ? (double)render_w / fbo_width : 1.0;
+
+    frame_width = render_w;
+    frame_height = render_h;
+
+    StoragePool::collectGarbage(vg);
+
+    if (backend == CanvasBackend::SOFTWARE && !cpu_pixels.empty())
+    {
+        const uint8_t clear[4] = {
+            (uint8_t)(r * a * 255.0f + 0.5f),
+            (uint8_t)(g * a * 255.0f + 0.5f),
+            (uint8_t)(b * a * 255.0f + 0.5f),
+            (uint8_t)(a * 255.0f + 0.5f)
+        };
+        for (int y = 0; y < render_h; y++)
+        {
+            uint8_t* row = cpu_pixels.data() + size_t(y) * storage_width * 4;
+            for (int x = 0; x < render_w; x++)
+                std::memcpy(row + x * 4, clear, 4);
+        }
+
+        nvgSoftwareFramebuffer(vg, cpu_pixels.data(), render_w, render_h, storage_width * 4);
+    }
+    else if (backend == CanvasBackend::OPENGL)
+    {
+        PixelUploadStream::collectGarbage();
+
+        glBindFramebuffer(GL_FRAMEBUFFER, target.fbo);
+        glViewport(0, 0, render_w, render_h);
+        glClearColor(r, g, b, a);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    }
 
     nvgBeginFrame(vg, 
         static_cast<float>(fbo_width), 
         static_cast<float>(fbo_height),
-        static_cast<float>(global_scale) // Improve render quality on high DPR devices
+        static_cast<float>(global_scale * render_scale) // Improve render quality on high DPR devices
     );
 }
 
 void Canvas::end()
 {
+    // Software: rasterizes the frame
     nvgEndFrame(vg);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (backend == CanvasBackend::OPENGL)
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void Canvas::readPixels(std::vector<uint8_t>& out) const
+{
+    // Only the SOFTWARE backend keeps the frame in cpu_pixels
+    if (backend != CanvasBackend::SOFTWARE || cpu_pixels.empty())
+    {
+        out.clear();
+        return;
+    }
+
+    const int render_w = frameWidth();
+    const int render_h = frameHeight();
+
+    out.resize(size_t(render_w) * render_h * 4);
+    for (int y = 0; y < render_h; y++)
+    {
+        const uint8_t* row = cpu_pixels.data() + size_t(y) * storage_width * 4;
+        uint8_t* dst = out.data() + size_t(y) * render_w * 4;
+        for (int x = 0; x < render_w; x++)
+        {
+            const uint8_t* p = row + x * 4;
+            uint8_t a = p[3];
+            for (int c = 0; c < 3; c++)
+                dst[x * 4 + c] = a ? (uint8_t)std::min(255, (p[c] * 255 + a / 2) / a) : 0;
+            dst[x * 4 + 3] = a;
+        }
+    }
 }
 
 BL_END_NS
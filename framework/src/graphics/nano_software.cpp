@@ -0,0 +1,853 @@
+#include "nano_software.h"
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+
+#include "threads.h"
+
+BL_BEGIN_NS
+
+struct SoftwareTexture
+{
+    int type = 0;               // NVG_TEXTURE_ALPHA / NVG_TEXTURE_RGBA (0 = free slot)
+    int width = 0;
+    int height = 0;
+    int flags = 0;
+    std::vector<uint8_t> data;
+};
+
+struct SoftwareEdge
+{
+    float x0, y0, x1, y1;
+};
+
+// Paint for one call, evaluated at framebuffer pixel centers (as nanovg's GL fragment shader does)
+struct SoftwareShader
+{
+    float paint_mat[6];         // Framebuffer -> paint space
+    float extent[2];
+    float radius;
+    float feather;
+    float inner[4];             // Premultiplied
+    float outer[4];
+    int image = 0;
+    bool solid = true;
+
+    bool scissored = false;
+    float scissor_mat[6];       // Framebuffer -> scissor space
+    float scissor_ext[2];
+    float scissor_scale[2];
+
+    NVGcompositeOperationState blend;
+    bool source_over = true;
+};
+
+struct SoftwareCall
+{
+    enum struct Type { COVERAGE, TRIANGLES } type;
+
+    SoftwareShader shader;
+    int first;                  // Edges (COVERAGE) or vertices (TRIANGLES)
+    int count;
+    float bounds[4];            // Framebuffer pixels
+};
+
+struct SoftwareRenderer
+{
+    std::vector<SoftwareTexture> textures;
+
+    std::vector<SoftwareCall> calls;
+    std::vector<SoftwareEdge> edges;
+    std::vector<NVGvertex> verts;
+
+    float view_width = 1.0f;
+    float view_height = 1.0f;
+
+    uint8_t* target = nullptr;
+    int target_width = 0;
+    int target_height = 0;
+    int target_stride = 0;
+
+    std::vector<std::vector<float>> band_coverage; // Scratch accumulation buffer per band
+
+    [[nodiscard]] float scaleX() const { return (float)target_width / view_width; }
+    [[nodiscard]] float scaleY() const { return (float)target_height / view_height; }
+
+    [[nodiscard]] SoftwareTexture* texture(int id)
+    {
+        if (id <= 0 || id > (int)textures.size() || !textures[id - 1].type)
+            return nullptr;
+        return &textures[id - 1];
+    }
+};
+
+/// ======== Paint ========
+
+static void premultiplied(NVGcolor c, float out[4])
+{
+    out[0] = c.r * c.a;
+    out[1] = c.g * c.a;
+    out[2] = c.b * c.a;
+    out[3] = c.a;
+}
+
+// Composes view -> 'space' (inverse of xform) with framebuffer -> view
+static bool framebufferToSpace(const float* xform, float kx, float ky, float out[6])
+{
+    float inv[6];
+    if (!nvgTransformInverse(inv, xform))
+        return false;
+
+    out[0] = inv[0] * kx; out[1] = inv[1] * kx;
+    out[2] = inv[2] * ky; out[3] = inv[3] * ky;
+    out[4] = inv[4];      out[5] = inv[5];
+    return true;
+}
+
+static void setupShader(const SoftwareRenderer& r, SoftwareShader& s, const NVGpaint* paint,
+    NVGcompositeOperationState blend, const NVGscissor* scissor, float fringe)
+{
+    const float kx = 1.0f / r.scaleX();
+    const float ky = 1.0f / r.scaleY();
+
+    premultiplied(paint->innerColor, s.inner);
+    premultiplied(paint->outerColor, s.outer);
+
+    if (!framebufferToSpace(paint->xform, kx, ky, s.paint_mat))
+    {
+        const float identity[6] = { kx, 0, 0, ky, 0, 0 };
+        std::memcpy(s.paint_mat, identity, sizeof(identity));
+    }
+
+    s.extent[0] = paint->extent[0];
+    s.extent[1] = paint->extent[1];
+    s.radius = paint->radius;
+    s.feather = std::max(paint->feather, 1e-6f);
+    s.image = paint->image;
+    s.solid = !paint->image && std::memcmp(s.inner, s.outer, sizeof(s.inner)) == 0;
+
+    s.scissored = scissor->extent[0] >= -0.5f && framebufferToSpace(scissor->xform, kx, ky, s.scissor_mat);
+    if (s.scissored)
+    {
+        const float* x = scissor->xform;
+        s.scissor_ext[0] = scissor->extent[0];
+        s.scissor_ext[1] = scissor->extent[1];
+        s.scissor_scale[0] = std::sqrt(x[0] * x[0] + x[2] * x[2]) / fringe;
+        s.scissor_scale[1] = std::sqrt(x[1] * x[1] + x[3] * x[3]) / fringe;
+    }
+
+    s.blend = blend;
+    s.source_over =
+        blend.srcRGB == NVG_ONE && blend.dstRGB == NVG_ONE_MINUS_SRC_ALPHA &&
+        blend.srcAlpha == NVG_ONE && blend.dstAlpha == NVG_ONE_MINUS_SRC_ALPHA;
+}
+
+static float sdRoundRect(float x, float y, const float ext[2], float rad)
+{
+    float dx = std::fabs(x) - (ext[0] - rad);
+    float dy = std::fabs(y) - (ext[1] - rad);
+    float ox = std::max(dx, 0.0f), oy = std::max(dy, 0.0f);
+    return std::min(std::max(dx, dy), 0.0f) + std::sqrt(ox * ox + oy * oy) - rad;
+}
+
+static void texel(const SoftwareTexture& t, int x, int y, float out[4])
+{
+    const bool repeat_x = t.flags & NVG_IMAGE_REPEATX;
+    const bool repeat_y = t.flags & NVG_IMAGE_REPEATY;
+
+    x = repeat_x ? ((x % t.width) + t.width) % t.width : std::clamp(x, 0, t.width - 1);
+    y = repeat_y ? ((y % t.height) + t.height) % t.height : std::clamp(y, 0, t.height - 1);
+
+    if (t.type == NVG_TEXTURE_ALPHA)
+    {
+        float a = t.data[size_t(y) * t.width + x] * (1.0f / 255.0f);
+        out[0] = out[1] = out[2] = out[3] = a;
+        return;
+    }
+
+    const uint8_t* p = &t.data[(size_t(y) * t.width + x) * 4];
+    float a = p[3] * (1.0f / 255.0f);
+    float m = (t.flags & NVG_IMAGE_PREMULTIPLIED) ? (1.0f / 255.0f) : (a / 255.0f);
+    out[0] = p[0] * m;
+    out[1] = p[1] * m;
+    out[2] = p[2] * m;
+    out[3] = a;
+}
+
+// Premultiplied sample at normalized (u, v)
+static void sampleTexture(const SoftwareTexture& t, float u, float v, float out[4])
+{
+    float fx = u * (float)t.width;
+    float fy = v * (float)t.height;
+
+    if (t.flags & NVG_IMAGE_NEAREST)
+    {
+        texel(t, (int)std::floor(fx), (int)std::floor(fy), out);
+        return;
+    }
+
+    fx -= 0.5f;
+    fy -= 0.5f;
+    int x0 = (int)std::floor(fx), y0 = (int)std::floor(fy);
+    float tx = fx - (float)x0, ty = fy - (float)y0;
+
+    float c00[4], c10[4], c01[4], c11[4];
+    texel(t, x0, y0, c00);
+    texel(t, x0 + 1, y0, c10);
+    texel(t, x0, y0 + 1, c01);
+    texel(t, x0 + 1, y0 + 1, c11);
+
+    for (int i = 0; i < 4; i++)
+    {
+        float top = c00[i] + (c10[i] - c00[i]) * tx;
+        float bottom = c01[i] + (c11[i] - c01[i]) * tx;
+        out[i] = top + (bottom - top) * ty;
+    }
+}
+
+static float scissorMask(const SoftwareShader& s, float px, float py)
+{
+    if (!s.scissored)
+        return 1.0f;
+
+    const float* m = s.scissor_mat;
+    float sx = std::fabs(m[0] * px + m[2] * py + m[4]) - s.scissor_ext[0];
+    float sy = std::fabs(m[1] * px + m[3] * py + m[5]) - s.scissor_ext[1];
+    sx = std::clamp(0.5f - sx * s.scissor_scale[0], 0.0f, 1.0f);
+    sy = std::clamp(0.5f - sy * s.scissor_scale[1], 0.0f, 1.0f);
+    return sx * sy;
+}
+
+// Paint color (premultiplied) at framebuffer point (px, py)
+static void shadePaint(SoftwareRenderer& r, const SoftwareShader& s, float px, float py, float out[4])
+{
+    if (s.solid)
+    {
+        std::memcpy(out, s.inner, sizeof(s.inner));
+        return;
+    }
+
+    const float* m = s.paint_mat;
+    float x = m[0] * px + m[2] * py + m[4];
+    float y = m[1] * px + m[3] * py + m[5];
+
+    if (s.image)
+    {
+        const SoftwareTexture* t = r.texture(s.image);
+        if (!t)
+        {
+            out[0] = out[1] = out[2] = out[3] = 0.0f;
+            return;
+        }
+
+        float u = x / s.extent[0];
+        float v = y / s.extent[1];
+        if (t->flags & NVG_IMAGE_FLIPY)
+            v = 1.0f - v;
+
+        sampleTexture(*t, u, v, out);
+        for (int i = 0; i < 4; i++)
+            out[i] *= s.inner[i];
+        return;
+    }
+
+    float d = std::clamp((sdRoundRect(x, y, s.extent, s.radius) + s.feather * 0.5f) / s.feather, 0.0f, 1.0f);
+    for (int i = 0; i < 4; i++)
+        out[i] = s.inner[i] + (s.outer[i] - s.inner[i]) * d;
+}
+
+/// ======== Blending ========
+
+static float blendFactor(int factor, float src, float src_a, float dst, float dst_a, bool alpha)
+{
+    switch (factor)
+    {
+    case NVG_ZERO:                  return 0.0f;
+    case NVG_ONE:                   return 1.0f;
+    case NVG_SRC_COLOR:             return src;
+    case NVG_ONE_MINUS_SRC_COLOR:   return 1.0f - src;
+    case NVG_DST_COLOR:             return dst;
+    case NVG_ONE_MINUS_DST_COLOR:   return 1.0f - dst;
+    case NVG_SRC_ALPHA:             return src_a;
+    case NVG_ONE_MINUS_SRC_ALPHA:   return 1.0f - src_a;
+    case NVG_DST_ALPHA:             return dst_a;
+    case NVG_ONE_MINUS_DST_ALPHA:   return 1.0f - dst_a;
+    case NVG_SRC_ALPHA_SATURATE:    return alpha ? 1.0f : std::min(src_a, 1.0f - dst_a);
+    default:                        return 0.0f;
+    }
+}
+
+static void blendPixel(uint8_t* dst, const float src[4], const SoftwareShader& s)
+{
+    constexpr float k = 1.0f / 255.0f;
+    float d[4] = { dst[0] * k, dst[1] * k, dst[2] * k, dst[3] * k };
+    float out[4];
+
+    if (s.source_over)
+    {
+        float inv_a = 1.0f - src[3];
+        for (int i = 0; i < 4; i++)
+            out[i] = src[i] + d[i] * inv_a;
+    }
+    else
+    {
+        const NVGcompositeOperationState& b = s.blend;
+        for (int i = 0; i < 3; i++)
+        {
+            out[i] = src[i] * blendFactor(b.srcRGB, src[i], src[3], d[i], d[3], false) +
+                     d[i] * blendFactor(b.dstRGB, src[i], src[3], d[i], d[3], false);
+        }
+        out[3] = src[3] * blendFactor(b.srcAlpha, src[3], src[3], d[3], d[3], true) +
+                 d[3] * blendFactor(b.dstAlpha, src[3], src[3], d[3], d[3], true);
+    }
+
+    for (int i = 0; i < 4; i++)
+        dst[i] = (uint8_t)(std::clamp(out[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+/// ======== Coverage ========
+//
+// Each edge adds its signed area to the cells it crosses. A running sum along each row
+// then gives every pixel's exact coverage, with winding (|sum| clamped to 1, so nonzero)
+
+// Edge within [0, w] horizontally, clipped to rows [0, h)
+static void accumulateLine(float* acc, int stride, int w, int h, float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1)
+        return;
+
+    float dir = 1.0f;
+    if (y0 > y1)
+    {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1.0f;
+    }
+
+    if (y1 <= 0.0f || y0 >= (float)h)
+        return;
+
+    const float fw = (float)w;
+    const float dxdy = (x1 - x0) / (y1 - y0);
+    const float ys = std::max(y0, 0.0f);
+    const float ye = std::min(y1, (float)h);
+    const int row_end = (int)std::ceil(ye);
+
+    float x = std::clamp(x0 + (ys - y0) * dxdy, 0.0f, fw);
+    for (int row = (int)ys; row < row_end; row++)
+    {
+        float dy = std::min((float)row + 1.0f, ye) - std::max((float)row, ys);
+        float x_next = std::clamp(x + dxdy * dy, 0.0f, fw);
+        float d = dy * dir;
+        float* a = acc + size_t(row) * stride;
+
+        float xa = std::min(x, x_next);
+        float xb = std::max(x, x_next);
+        float xa_floor = std::floor(xa);
+        float xb_ceil = std::ceil(xb);
+        int xai = (int)xa_floor;
+        int xbi = (int)xb_ceil;
+
+        if (xbi <= xai + 1)
+        {
+            // Within one cell, split by the edge's mean x
+            float xmf = 0.5f * (x + x_next) - xa_floor;
+            a[xai] += d - d * xmf;
+            a[xai + 1] += d * xmf;
+        }
+        else
+        {
+            float s = 1.0f / (xb - xa);
+            float xaf = xa - xa_floor;
+            float a0 = 0.5f * s * (1.0f - xaf) * (1.0f - xaf);
+            float xbf = xb - xb_ceil + 1.0f;
+            float am = 0.5f * s * xbf * xbf;
+
+            a[xai] += d * a0;
+            if (xbi == xai + 2)
+            {
+                a[xai + 1] += d * (1.0f - a0 - am);
+            }
+            else
+            {
+                float a1 = s * (1.5f - xaf);
+                a[xai + 1] += d * (a1 - a0);
+                for (int xi = xai + 2; xi < xbi - 1; xi++)
+                    a[xi] += d * s;
+                float a2 = a1 + (float)(xbi - xai - 3) * s;
+                a[xbi - 1] += d * (1.0f - a2 - am);
+            }
+            a[xbi] += d * am;
+        }
+
+        x = x_next;
+    }
+}
+
+// Splits the edge where it leaves [0, w]. The parts outside are flattened onto that side
+// (the left side covers everything to its right, the right side nothing), so pixels inside
+// get the same coverage as from the unclipped edge
+static void accumulateEdge(float* acc, int stride, int w, int h, float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1 || (y0 <= 0.0f && y1 <= 0.0f) || (y0 >= (float)h && y1 >= (float)h))
+        return;
+
+    float t[4] = { 0.0f, 1.0f, 1.0f, 1.0f };
+    int n = 1;
+    for (float side : { 0.0f, (float)w })
+    {
+        if ((x0 < side) != (x1 < side))
+            t[n++] = (side - x0) / (x1 - x0);
+    }
+    t[n] = 1.0f;
+    std::sort(t, t + n + 1);
+
+    const float fw = (float)w;
+    for (int i = 0; i < n; i++)
+    {
+        float ax = x0 + (x1 - x0) * t[i],     ay = y0 + (y1 - y0) * t[i];
+        float bx = x0 + (x1 - x0) * t[i + 1], by = y0 + (y1 - y0) * t[i + 1];
+        accumulateLine(acc, stride, w, h,
+            std::clamp(ax, 0.0f, fw), ay,
+            std::clamp(bx, 0.0f, fw), by);
+    }
+}
+
+/// ======== Band rasterization ========
+
+static void rasterizeCoverage(SoftwareRenderer& r, const SoftwareCall& call,
+    int x0, int y0, int x1, int y1, std::vector<float>& acc)
+{
+    const int w = x1 - x0;
+    const int h = y1 - y0;
+    const int stride = w + 2;
+
+    // Left zeroed by every use
+    if (acc.size() < size_t(stride) * h)
+        acc.resize(size_t(stride) * h, 0.0f);
+
+    for (int i = call.first; i < call.first + call.count; i++)
+    {
+        const SoftwareEdge& e = r.edges[i];
+        accumulateEdge(acc.data(), stride, w, h,
+            e.x0 - (float)x0, e.y0 - (float)y0,
+            e.x1 - (float)x0, e.y1 - (float)y0);
+    }
+
+    const SoftwareShader& s = call.shader;
+    for (int row = 0; row < h; row++)
+    {
+        float* a = acc.data() + size_t(row) * stride;
+        uint8_t* dst = r.target + size_t(y0 + row) * r.target_stride + size_t(x0) * 4;
+        const float py = (float)(y0 + row) + 0.5f;
+
+        float sum = 0.0f;
+        for (int i = 0; i < w; i++, dst += 4)
+        {
+            sum += a[i];
+            a[i] = 0.0f;
+
+            float coverage = std::min(std::fabs(sum), 1.0f);
+            if (coverage < 1.0f / 512.0f)
+                continue;
+
+            const float px = (float)(x0 + i) + 0.5f;
+            float color[4];
+            shadePaint(r, s, px, py, color);
+
+            coverage *= scissorMask(s, px, py);
+            for (float& c : color)
+                c *= coverage;
+
+            blendPixel(dst, color, s);
+        }
+        a[w] = a[w + 1] = 0.0f;
+    }
+}
+
+static float edgeFunction(const NVGvertex& a, const NVGvertex& b, float px, float py)
+{
+    return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+}
+
+// Top-left rule, so pixels on an edge shared by two triangles are only drawn once
+static bool edgeOwnsPixel(const NVGvertex& a, const NVGvertex& b, float w)
+{
+    if (w != 0.0f) return w > 0.0f;
+    float dy = b.y - a.y;
+    return dy > 0.0f || (dy == 0.0f && b.x < a.x);
+}
+
+// Textured triangles (text), sampled at pixel centers
+static void rasterizeTriangles(SoftwareRenderer& r, const SoftwareCall& call, int x0, int y0, int x1, int y1)
+{
+    const SoftwareShader& s = call.shader;
+    const SoftwareTexture* tex = r.texture(s.image);
+
+    for (int i = call.first; i + 2 < call.first + call.count; i += 3)
+    {
+        const NVGvertex& v0 = r.verts[i];
+        const NVGvertex* v1 = &r.verts[i + 1];
+        const NVGvertex* v2 = &r.verts[i + 2];
+
+        float area = edgeFunction(v0, *v1, v2->x, v2->y);
+        if (std::fabs(area) < 1e-12f)
+            continue;
+        if (area < 0.0f)
+        {
+            std::swap(v1, v2);
+            area = -area;
+        }
+
+        int tx0 = std::max(x0, (int)std::floor(std::min({ v0.x, v1->x, v2->x })));
+        int ty0 = std::max(y0, (int)std::floor(std::min({ v0.y, v1->y, v2->y })));
+        int tx1 = std::min(x1, (int)std::ceil(std::max({ v0.x, v1->x, v2->x })));
+        int ty1 = std::min(y1, (int)std::ceil(std::max({ v0.y, v1->y, v2->y })));
+
+        const float inv_area = 1.0f / area;
+        for (int y = ty0; y < ty1; y++)
+        {
+            const float py = (float)y + 0.5f;
+            uint8_t* dst = r.target + size_t(y) * r.target_stride + size_t(tx0) * 4;
+
+            for (int x = tx0; x < tx1; x++, dst += 4)
+            {
+                const float px = (float)x + 0.5f;
+                float w0 = edgeFunction(*v1, *v2, px, py);
+                float w1 = edgeFunction(*v2, v0, px, py);
+                float w2 = edgeFunction(v0, *v1, px, py);
+
+                if (!edgeOwnsPixel(*v1, *v2, w0) || !edgeOwnsPixel(*v2, v0, w1) || !edgeOwnsPixel(v0, *v1, w2))
+                    continue;
+
+                w0 *= inv_area; w1 *= inv_area; w2 *= inv_area;
+
+                float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                if (tex)
+                {
+                    float u = v0.u * w0 + v1->u * w1 + v2->u * w2;
+                    float v = v0.v * w0 + v1->v * w1 + v2->v * w2;
+                    sampleTexture(*tex, u, v, color);
+                }
+
+                float mask = scissorMask(s, px, py);
+                for (int c = 0; c < 4; c++)
+                    color[c] *= s.inner[c] * mask;
+
+                if (color[3] > 0.0f || !s.source_over)
+                    blendPixel(dst, color, s);
+            }
+        }
+    }
+}
+
+static void rasterizeBand(SoftwareRenderer& r, int band_y0, int band_y1, std::vector<float>& acc)
+{
+    for (const SoftwareCall& call : r.calls)
+    {
+        int x0 = std::max(0, (int)std::floor(call.bounds[0]));
+        int y0 = std::max(band_y0, (int)std::floor(call.bounds[1]));
+        int x1 = std::min(r.target_width, (int)std::ceil(call.bounds[2]));
+        int y1 = std::min(band_y1, (int)std::ceil(call.bounds[3]));
+        if (x0 >= x1 || y0 >= y1)
+            continue;
+
+        if (call.type == SoftwareCall::Type::COVERAGE)
+            rasterizeCoverage(r, call, x0, y0, x1, y1, acc);
+        else
+            rasterizeTriangles(r, call, x0, y0, x1, y1);
+    }
+}
+
+/// ======== nanovg renderer callbacks ========
+
+static int swRenderCreate(void*)
+{
+    return 1;
+}
+
+static int swCreateTexture(void* uptr, int type, int w, int h, int image_flags, const unsigned char* data)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+
+    size_t slot = 0;
+    while (slot < r->textures.size() && r->textures[slot].type)
+        slot++;
+    if (slot == r->textures.size())
+        r->textures.emplace_back();
+
+    SoftwareTexture& t = r->textures[slot];
+    t.type = type;
+    t.width = w;
+    t.height = h;
+    t.flags = image_flags;
+
+    size_t bytes = size_t(w) * h * (type == NVG_TEXTURE_RGBA ? 4 : 1);
+    if (data)
+        t.data.assign(data, data + bytes);
+    else
+        t.data.assign(bytes, 0);
+
+    return (int)slot + 1;
+}
+
+static int swDeleteTexture(void* uptr, int image)
+{
+    SoftwareTexture* t = ((SoftwareRenderer*)uptr)->texture(image);
+    if (!t)
+        return 0;
+
+    *t = SoftwareTexture{};
+    return 1;
+}
+
+// 'data' is the whole image, of which only the rect is copied
+static int swUpdateTexture(void* uptr, int image, int x, int y, int w, int h, const unsigned char* data)
+{
+    SoftwareTexture* t = ((SoftwareRenderer*)uptr)->texture(image);
+    if (!t)
+        return 0;
+
+    const size_t bpp = t->type == NVG_TEXTURE_RGBA ? 4 : 1;
+    const size_t row_bytes = size_t(w) * bpp;
+    for (int row = y; row < y + h; row++)
+    {
+        size_t offset = (size_t(row) * t->width + x) * bpp;
+        std::memcpy(t->data.data() + offset, data + offset, row_bytes);
+    }
+    return 1;
+}
+
+static int swGetTextureSize(void* uptr, int image, int* w, int* h)
+{
+    SoftwareTexture* t = ((SoftwareRenderer*)uptr)->texture(image);
+    if (!t)
+        return 0;
+
+    *w = t->width;
+    *h = t->height;
+    return 1;
+}
+
+static void swViewport(void* uptr, float width, float height, float)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+    r->view_width = std::max(width, 1.0f);
+    r->view_height = std::max(height, 1.0f);
+}
+
+static void swCancel(void* uptr)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+    r->calls.clear();
+    r->edges.clear();
+    r->verts.clear();
+}
+
+static void swFlush(void* uptr)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+
+    if (r->target && !r->calls.empty())
+    {
+        // Bands short enough to spread across the workers, tall enough to be worth a task
+        constexpr int min_band_rows = 32;
+        const int bands = std::clamp((int)Thread::workerCount(), 1, std::max(1, r->target_height / min_band_rows));
+
+        if (r->band_coverage.size() < (size_t)bands)
+            r->band_coverage.resize(bands);
+
+        if (bands == 1)
+        {
+            rasterizeBand(*r, 0, r->target_height, r->band_coverage[0]);
+        }
+        else
+        {
+            Thread::TaskGroup group;
+            auto ranges = Thread::splitRanges(r->target_height, bands);
+            for (int i = 0; i < bands; i++)
+            {
+                auto [y0, y1] = ranges[i];
+                Thread::submit(Thread::Priority::INTERACTIVE, [r, i, y0, y1]()
+                {
+                    rasterizeBand(*r, y0, y1, r->band_coverage[i]);
+                }, &group);
+            }
+            group.wait();
+        }
+    }
+
+    swCancel(uptr);
+}
+
+static void swFill(void* uptr, NVGpaint* paint, NVGcompositeOperationState blend, NVGscissor* scissor,
+    float fringe, const float* bounds, const NVGpath* paths, int npaths)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+    if (!r->target)
+        return;
+
+    const float sx = r->scaleX(), sy = r->scaleY();
+
+    SoftwareCall call;
+    call.type = SoftwareCall::Type::COVERAGE;
+    call.first = (int)r->edges.size();
+    setupShader(*r, call.shader, paint, blend, scissor, fringe);
+
+    for (int p = 0; p < npaths; p++)
+    {
+        const NVGvertex* v = paths[p].fill;
+        const int n = paths[p].nfill;
+        for (int i = 0; i < n; i++)
+        {
+            const NVGvertex& a = v[i];
+            const NVGvertex& b = v[(i + 1) % n];
+            r->edges.push_back({ a.x * sx, a.y * sy, b.x * sx, b.y * sy });
+        }
+    }
+
+    call.count = (int)r->edges.size() - call.first;
+    call.bounds[0] = bounds[0] * sx;
+    call.bounds[1] = bounds[1] * sy;
+    call.bounds[2] = bounds[2] * sx;
+    call.bounds[3] = bounds[3] * sy;
+
+    if (call.count)
+        r->calls.push_back(call);
+}
+
+// Strokes arrive as triangle strips. Each triangle's coverage is accumulated (consistently
+// wound), so overlaps at joins don't blend twice
+static void swStroke(void* uptr, NVGpaint* paint, NVGcompositeOperationState blend, NVGscissor* scissor,
+    float fringe, float, const NVGpath* paths, int npaths)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+    if (!r->target)
+        return;
+
+    const float sx = r->scaleX(), sy = r->scaleY();
+
+    SoftwareCall call;
+    call.type = SoftwareCall::Type::COVERAGE;
+    call.first = (int)r->edges.size();
+    call.bounds[0] = call.bounds[1] = INFINITY;
+    call.bounds[2] = call.bounds[3] = -INFINITY;
+    setupShader(*r, call.shader, paint, blend, scissor, fringe);
+
+    for (int p = 0; p < npaths; p++)
+    {
+        const NVGvertex* v = paths[p].stroke;
+        for (int i = 0; i + 2 < paths[p].nstroke; i++)
+        {
+            float ax = v[i].x * sx,     ay = v[i].y * sy;
+            float bx = v[i + 1].x * sx, by = v[i + 1].y * sy;
+            float cx = v[i + 2].x * sx, cy = v[i + 2].y * sy;
+
+            float area = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+            if (std::fabs(area) < 1e-9f)
+                continue;
+            if (area < 0.0f)
+            {
+                std::swap(bx, cx);
+                std::swap(by, cy);
+            }
+
+            r->edges.push_back({ ax, ay, bx, by });
+            r->edges.push_back({ bx, by, cx, cy });
+            r->edges.push_back({ cx, cy, ax, ay });
+
+            call.bounds[0] = std::min({ call.bounds[0], ax, bx, cx });
+            call.bounds[1] = std::min({ call.bounds[1], ay, by, cy });
+            call.bounds[2] = std::max({ call.bounds[2], ax, bx, cx });
+            call.bounds[3] = std::max({ call.bounds[3], ay, by, cy });
+        }
+    }
+
+    call.count = (int)r->edges.size() - call.first;
+    if (call.count)
+        r->calls.push_back(call);
+}
+
+static void swTriangles(void* uptr, NVGpaint* paint, NVGcompositeOperationState blend, NVGscissor* scissor,
+    const NVGvertex* verts, int nverts, float fringe)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)uptr;
+    if (!r->target || nverts < 3)
+        return;
+
+    const float sx = r->scaleX(), sy = r->scaleY();
+
+    SoftwareCall call;
+    call.type = SoftwareCall::Type::TRIANGLES;
+    call.first = (int)r->verts.size();
+    call.count = nverts;
+    call.bounds[0] = call.bounds[1] = INFINITY;
+    call.bounds[2] = call.bounds[3] = -INFINITY;
+    setupShader(*r, call.shader, paint, blend, scissor, fringe);
+
+    for (int i = 0; i < nverts; i++)
+    {
+        NVGvertex v = { verts[i].x * sx, verts[i].y * sy, verts[i].u, verts[i].v };
+        r->verts.push_back(v);
+
+        call.bounds[0] = std::min(call.bounds[0], v.x);
+        call.bounds[1] = std::min(call.bounds[1], v.y);
+        call.bounds[2] = std::max(call.bounds[2], v.x);
+        call.bounds[3] = std::max(call.bounds[3], v.y);
+    }
+
+    r->calls.push_back(call);
+}
+
+static void swRenderDelete(void* uptr)
+{
+    delete (SoftwareRenderer*)uptr;
+}
+
+/// ======== Public ========
+
+NVGcontext* nvgCreateSoftware()
+{
+    NVGparams params = {};
+    params.userPtr = new SoftwareRenderer;
+    params.renderCreate = swRenderCreate;
+    params.renderCreateTexture = swCreateTexture;
+    params.renderDeleteTexture = swDeleteTexture;
+    params.renderUpdateTexture = swUpdateTexture;
+    params.renderGetTextureSize = swGetTextureSize;
+    params.renderViewport = swViewport;
+    params.renderCancel = swCancel;
+    params.renderFlush = swFlush;
+    params.renderFill = swFill;
+    params.renderStroke = swStroke;
+    params.renderTriangles = swTriangles;
+    params.renderDelete = swRenderDelete;
+
+    // Coverage is exact, so nanovg needn't add anti-aliasing fringes
+    params.edgeAntiAlias = 0;
+
+    return nvgCreateInternal(&params); // Deletes the renderer on failure
+}
+
+void nvgDeleteSoftware(NVGcontext* vg)
+{
+    nvgDeleteInternal(vg);
+}
+
+bool nvgIsSoftware(NVGcontext* vg)
+{
+    return vg && nvgInternalParams(vg)->renderCreate == swRenderCreate;
+}
+
+void nvgSoftwareFramebuffer(NVGcontext* vg, uint8_t* pixels, int width, int height, int stride)
+{
+    SoftwareRenderer* r = (SoftwareRenderer*)nvgInternalParams(vg)->userPtr;
+    r->target = (width > 0 && height > 0) ? pixels : nullptr;
+    r->target_width = width;
+    r->target_height = height;
+    r->target_stride = stride;
+}
+
+BL_END_NS
@@ -0,0 +1,101 @@
+#include "text_layout.h"
+#include "value_hash.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+BL_BEGIN_NS
+
+// Layout state minus the atlas generation (which only decides whether quads are still valid)
+static bool sameShape(const NVGtextLayoutState& a, const NVGtextLayoutState& b)
+{
+    return a.fontId == b.fontId && a.align == b.align && a.flipped == b.flipped &&
+        a.size == b.size && a.spacing == b.spacing && a.blur == b.blur && a.scale == b.scale;
+}
+
+TextLayoutCache& TextLayoutCache::of(NVGcontext* vg)
+{
+    static std::mutex caches_mutex;
+    static std::vector<std::unique_ptr<TextLayoutCache>> caches;
+
+    std::lock_guard lock(caches_mutex);
+    for (auto& cache : caches)
+    {
+        if (cache->vg == vg)
+            return *cache;
+    }
+
+    caches.push_back(std::make_unique<TextLayoutCache>(vg));
+    return *caches.back();
+}
+
+TextLayoutCache::Layout* TextLayoutCache::find(std::string_view txt)
+{
+    NVGtextLayoutState state;
+    nvgTextLayoutState(vg, &state);
+    if (state.fontId < 0)
+        return nullptr;
+
+    size_t key = std::hash<std::string_view>()(txt);
+    syncHashCombine(key, syncHashBytes(&state.fontId, sizeof(int) * 3));
+    syncHashCombine(key, syncHashBytes(&state.size, sizeof(float) * 4));
+
+    auto it = layouts.find(key);
+    if (it != layouts.end() && it->second.text == txt && sameShape(it->second.state, state))
+    {
+        it->second.state.atlasGeneration = state.atlasGeneration;
+        return &it->second;
+    }
+
+    if (it == layouts.end() && layouts.size() >= max_layouts)
+        layouts.clear();
+
+    // New (or colliding) key
+    Layout& layout = layouts[key];
+    layout = Layout{};
+    layout.text = txt;
+    layout.state = state;
+    return &layout;
+}
+
+float TextLayoutCache::bounds(std::string_view txt, float out[4])
+{
+    Layout* layout = find(txt);
+    if (!layout)
+    {
+        out[0] = out[1] = out[2] = out[3] = 0.0f;
+        return 0.0f;
+    }
+
+    if (!layout->measured)
+    {
+        layout->advance = nvgTextBounds(vg, 0, 0, txt.data(), txt.data() + txt.size(), layout->bounds);
+        layout->measured = true;
+    }
+
+    std::copy(layout->bounds, layout->bounds + 4, out);
+    return layout->advance;
+}
+
+void TextLayoutCache::fillText(float x, float y, std::string_view txt)
+{
+    Layout* layout = find(txt);
+    if (!layout)
+        return;
+
+    if (layout->quads_generation != layout->state.atlasGeneration)
+    {
+        layout->quads.resize(txt.size() * 6);
+        int n = nvgTextLayout(vg, txt.data(), txt.data() + txt.size(), layout->quads.data(), (int)layout->quads.size());
+        layout->quads.resize(n);
+
+        // Shaping may have started a new atlas
+        NVGtextLayoutState state;
+        nvgTextLayoutState(vg, &state);
+        layout->quads_generation = state.atlasGeneration;
+    }
+
+    nvgTextLayoutDraw(vg, x, y, layout->quads.data(), (int)layout->quads.size());
+}
+
+BL_END_NS
@@ -264,6 +264,16 @@ bool ImGradient::operator==(const ImGradient& rhs) const
     return true;
 }
 
+size_t ImGradient::hash() const
+{
+    size_t h = std::hash<std::string_view>()(std::string_view(
+        reinterpret_cast<const char*>(m_marks.data()), m_marks.size() * sizeof(ImGradientMark)));
+
+    h ^= std::hash<int>()(dragging_uid) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= std::hash<int>()(selected_uid) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+}
+
 
 // Assumes m_marks is kept sorted by .position in ascending order
 void ImGradient::computeColorAt(float position, float* color) const
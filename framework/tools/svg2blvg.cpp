@@ -0,0 +1,180 @@
+// svg2blvg - converts an SVG into packed vector paths (.blvg), see vector_paths.h
+//
+//   svg2blvg <input.svg> <output.blvg> [dpi]
+//
+// Only solid paints are packed. Gradients are reduced to the average of their stops,
+// and the fill rule is left to nanovg (nonzero)
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#define NANOSVG_IMPLEMENTATION
+#include "nanosvg/nanosvg.h"
+#include "nanovg/nanovg.h"
+
+#include "vector_paths.h"
+
+using namespace BL;
+
+// Scales alpha of a nanosvg color (ABGR, i.e. RGBA8 with r in the low byte)
+static uint32_t applyOpacity(uint32_t color, float opacity)
+{
+    uint32_t a = (uint32_t)std::lround(float(color >> 24) * opacity);
+    return (color & 0x00ffffffu) | (std::min(a, 255u) << 24);
+}
+
+static bool resolvePaint(const NSVGpaint& paint, float opacity, uint32_t& out)
+{
+    switch (paint.type)
+    {
+    case NSVG_PAINT_COLOR:
+        out = applyOpacity(paint.color, opacity);
+        return true;
+
+    case NSVG_PAINT_LINEAR_GRADIENT:
+    case NSVG_PAINT_RADIAL_GRADIENT:
+    {
+        const NSVGgradient* g = paint.gradient;
+        if (!g || g->nstops == 0)
+            return false;
+
+        float sum[4] = { 0, 0, 0, 0 };
+        for (int i = 0; i < g->nstops; i++)
+            for (int c = 0; c < 4; c++)
+                sum[c] += float((g->stops[i].color >> (c * 8)) & 0xff);
+
+        uint32_t color = 0;
+        for (int c = 0; c < 4; c++)
+            color |= (uint32_t)std::lround(sum[c] / (float)g->nstops) << (c * 8);
+
+        out = applyOpacity(color, opacity);
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+// nanosvg stores lines as cubics with control points at 1/3 and 2/3
+static bool isLine(const float* p)
+{
+    float dx = p[6] - p[0], dy = p[7] - p[1];
+    float eps = 1e-4f * std::max(1.0f, std::max(std::fabs(dx), std::fabs(dy)));
+    return std::fabs(p[2] - (p[0] + dx / 3.0f)) < eps && std::fabs(p[3] - (p[1] + dy / 3.0f)) < eps &&
+           std::fabs(p[4] - (p[6] - dx / 3.0f)) < eps && std::fabs(p[5] - (p[7] - dy / 3.0f)) < eps;
+}
+
+static uint8_t lineCap(char cap)
+{
+    switch (cap)
+    {
+    case NSVG_CAP_ROUND:  return NVG_ROUND;
+    case NSVG_CAP_SQUARE: return NVG_SQUARE;
+    default:              return NVG_BUTT;
+    }
+}
+
+static uint8_t lineJoin(char join)
+{
+    switch (join)
+    {
+    case NSVG_JOIN_ROUND: return NVG_ROUND;
+    case NSVG_JOIN_BEVEL: return NVG_BEVEL;
+    default:              return NVG_MITER;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        printf("usage: svg2blvg <input.svg> <output.blvg> [dpi]\n");
+        return 1;
+    }
+
+    float dpi = argc > 3 ? (float)std::atof(argv[3]) : 96.0f;
+    NSVGimage* image = nsvgParseFromFile(argv[1], "px", dpi);
+    if (!image)
+    {
+        printf("Could not open SVG image: %s\n", argv[1]);
+        return 1;
+    }
+
+    VectorPaths paths;
+    float* bounds = paths.bounds;
+    bounds[0] = bounds[1] = INFINITY;
+    bounds[2] = bounds[3] = -INFINITY;
+
+    for (NSVGshape* shape = image->shapes; shape; shape = shape->next)
+    {
+        if (!(shape->flags & NSVG_FLAGS_VISIBLE))
+            continue;
+
+        VectorPaths::Shape packed;
+        if (resolvePaint(shape->fill, shape->opacity, packed.fill))
+            packed.flags |= VectorPaths::SHAPE_FILL;
+        if (shape->strokeWidth > 0.0f && resolvePaint(shape->stroke, shape->opacity, packed.stroke))
+            packed.flags |= VectorPaths::SHAPE_STROKE;
+
+        if (!packed.flags)
+            continue;
+
+        packed.stroke_width = shape->strokeWidth;
+        packed.line_cap = lineCap(shape->strokeLineCap);
+        packed.line_join = lineJoin(shape->strokeLineJoin);
+
+        size_t first_command = paths.commands.size();
+        for (NSVGpath* path = shape->paths; path; path = path->next)
+        {
+            if (path->npts < 1)
+                continue;
+
+            paths.commands.push_back(VectorPaths::Command::MOVE_TO);
+            paths.coords.insert(paths.coords.end(), path->pts, path->pts + 2);
+
+            for (int i = 0; i + 3 < path->npts; i += 3)
+            {
+                const float* p = &path->pts[i * 2];
+                if (isLine(p))
+                {
+                    paths.commands.push_back(VectorPaths::Command::LINE_TO);
+                    paths.coords.insert(paths.coords.end(), p + 6, p + 8);
+                }
+                else
+                {
+                    paths.commands.push_back(VectorPaths::Command::BEZIER_TO);
+                    paths.coords.insert(paths.coords.end(), p + 2, p + 8);
+                }
+            }
+
+            if (path->closed)
+                paths.commands.push_back(VectorPaths::Command::CLOSE);
+
+            bounds[0] = std::min(bounds[0], path->bounds[0]);
+            bounds[1] = std::min(bounds[1], path->bounds[1]);
+            bounds[2] = std::max(bounds[2], path->bounds[2]);
+            bounds[3] = std::max(bounds[3], path->bounds[3]);
+        }
+
+        packed.command_count = (uint32_t)(paths.commands.size() - first_command);
+        if (packed.command_count)
+            paths.shapes.push_back(packed);
+    }
+
+    nsvgDelete(image);
+
+    if (paths.empty())
+        bounds[0] = bounds[1] = bounds[2] = bounds[3] = 0.0f;
+
+    if (!paths.save(argv[2]))
+    {
+        printf("Could not write: %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("%s: %zu shapes, %zu commands\n", argv[2], paths.shapes.size(), paths.commands.size());
+    return 0;
+}